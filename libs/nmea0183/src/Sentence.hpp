@@ -41,6 +41,8 @@
 ** You can use it any way you like.
 */
 
+#include <vector>
+
 class LATLONG;
 
 class SENTENCE 
@@ -58,6 +60,23 @@ class SENTENCE
 
       wxString Sentence;
 
+      /*
+      ** Where every field starts and ends, built when a sentence is
+      ** assigned. Field() and the typed accessors read from it, so they
+      ** neither rescan the sentence nor share any static buffer: separate
+      ** SENTENCE objects may be parsed on separate threads. Code that
+      ** changes Sentence directly instead of through the operators gets
+      ** the index rebuilt on next use when the length differs, else it
+      ** should call Index() itself.
+      */
+
+      struct FIELD
+      {
+         int start;
+         int end;
+         int stars;    // '*' separators before this field
+      };
+
       /*
       ** Methods
       */
@@ -67,7 +86,9 @@ class SENTENCE
       virtual COMMUNICATIONS_MODE CommunicationsMode( int field_number ) const;
       virtual double Double( int field_number ) const;
       virtual EASTWEST EastOrWest( int field_number ) const;
-      virtual const wxString& Field( int field_number ) const;
+      virtual wxString Field( int field_number ) const;
+      virtual wxChar Char( int field_number ) const;
+      virtual void Index( void ) const;
       virtual void Finish( void );
       virtual int GetNumberOfDataFields( void ) const;
       virtual int Integer( int field_number ) const;
@@ -94,6 +115,18 @@ class SENTENCE
       virtual const SENTENCE& operator += ( TRANSDUCER_TYPE transducer );
       virtual const SENTENCE& operator += ( NMEA0183L_BOOLEAN boolean );
       virtual const SENTENCE& operator += ( LATLONG& source );
+
+   private:
+
+      const FIELD* Find( int field_number ) const;
+      int Length( int field_number ) const;
+      wxChar Single( int field_number ) const;
+      bool Number( int field_number, char* buffer, size_t size ) const;
+
+      mutable std::vector<FIELD> fields;
+      mutable size_t indexed_length;
+      mutable unsigned char checksum;
+      mutable bool indexed;
 };
  
 #endif // SENTENCE_CLASS_HEADER
@@ -40,9 +40,9 @@
 ** You can use it any way you like.
 */
 
-wxString& expand_talker_id( const wxString &identifier )
+wxString expand_talker_id( const wxString &identifier )
 {
-    static wxString expanded_identifier;
+    wxString expanded_identifier;
 
     char first_character  = 0x00;
     char second_character = 0x00;
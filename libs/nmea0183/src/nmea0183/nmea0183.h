@@ -145,9 +145,9 @@ typedef enum
 
 int HexValue( const wxString& hex_string );
 
-wxString& expand_talker_id( const wxString & );
+wxString expand_talker_id( const wxString & );
 wxString& Hex( int value );
-wxString& talker_id( const wxString& sentence );
+wxString talker_id( const wxString& sentence );
 
 #include "nmea0183.hpp"
 
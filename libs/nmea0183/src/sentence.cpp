@@ -58,6 +58,9 @@ static const long long lNaN = 0xfff8000000000000;
 SENTENCE::SENTENCE()
 {
    Sentence.Empty();
+   indexed = false;
+   indexed_length = 0;
+   checksum = 0;
 }
 
 SENTENCE::~SENTENCE()
@@ -69,15 +72,13 @@ NMEA0183L_BOOLEAN SENTENCE::Boolean( int field_number ) const
 {
 //   ASSERT_VALID( this );
 
-   wxString field_data;
+   wxChar field_data = Char( field_number );
 
-   field_data = Field( field_number );
-
-   if ( field_data.StartsWith(_T("A")) )
+   if ( field_data == 'A' )
    {
       return( NTrue );
    }
-   else if ( field_data.StartsWith(_T("V")) )
+   else if ( field_data == 'V' )
    {
       return( NFalse );
    }
@@ -91,47 +92,45 @@ COMMUNICATIONS_MODE SENTENCE::CommunicationsMode( int field_number ) const
 {
 //   ASSERT_VALID( this );
 
-   wxString field_data;
-
-   field_data = Field( field_number );
+   wxChar field_data = Single( field_number );
 
-   if ( field_data == _T("d") )
+   if ( field_data == 'd' )
    {
       return( F3E_G3E_SimplexTelephone );
    }
-   else if ( field_data == _T("e") )
+   else if ( field_data == 'e' )
    {
       return( F3E_G3E_DuplexTelephone );
    }
-   else if ( field_data == _T("m") )
+   else if ( field_data == 'm' )
    {
       return( J3E_Telephone );
    }
-   else if ( field_data == _T("o") )
+   else if ( field_data == 'o' )
    {
       return( H3E_Telephone );
    }
-   else if ( field_data == _T("q") )
+   else if ( field_data == 'q' )
    {
       return( F1B_J2B_FEC_NBDP_TelexTeleprinter );
    }
-   else if ( field_data == _T("s") )
+   else if ( field_data == 's' )
    {
       return( F1B_J2B_ARQ_NBDP_TelexTeleprinter );
    }
-   else if ( field_data == _T("w") )
+   else if ( field_data == 'w' )
    {
       return( F1B_J2B_ReceiveOnlyTeleprinterDSC );
    }
-   else if ( field_data == _T("x") )
+   else if ( field_data == 'x' )
    {
       return( A1A_MorseTapeRecorder );
    }
-   else if ( field_data == _T("{") )
+   else if ( field_data == '{' )
    {
       return( A1A_MorseKeyHeadset );
    }
-   else if ( field_data == _T("|") )
+   else if ( field_data == '|' )
    {
       return( F1C_F2C_F3C_FaxMachine );
    }
@@ -143,35 +142,173 @@ COMMUNICATIONS_MODE SENTENCE::CommunicationsMode( int field_number ) const
 
 unsigned char SENTENCE::ComputeChecksum( void ) const
 {
-   unsigned char checksum_value = 0;
+   Find( 0 );   // the checksum is taken while indexing
+
+   return( checksum );
+}
+
+void SENTENCE::Index( void ) const
+{
+   int string_length = Sentence.Len();
+   bool summing      = true;
+
+   fields.clear();
+   checksum = 0;
+
+   FIELD field = { 1, -1, 0 }; // Skip over the $ at the begining of the sentence
+
+   wxString::const_iterator it = Sentence.begin();
+   if ( it != Sentence.end() )
+   {
+      ++it;
+   }
+
+   for( int index = 1; it != Sentence.end(); ++it, index++ )
+   {
+      wxChar c = *it;
+
+      if ( c == '*' || c == CARRIAGE_RETURN || c == LINE_FEED )
+      {
+         summing = false;
+      }
+
+      if ( summing )
+      {
+         checksum ^= (char) c;
+      }
+
+      if ( c == ',' || c == '*' )
+      {
+         if ( field.end < 0 )
+         {
+            field.end = index;
+         }
+
+         fields.push_back( field );
+
+         field.start = index + 1;
+         field.end   = -1;
+
+         if ( c == '*' )
+         {
+            field.stars++;
+         }
+      }
+      else if ( c == 0x00 && field.end < 0 )
+      {
+         field.end = index;
+      }
+   }
+
+   if ( field.end < 0 )
+   {
+      field.end = string_length;
+   }
+
+   fields.push_back( field );
+
+   indexed_length = string_length;
+   indexed        = true;
+}
+
+const SENTENCE::FIELD* SENTENCE::Find( int field_number ) const
+{
+   if ( !indexed || indexed_length != Sentence.Len() )
+   {
+      Index();
+   }
+
+   if ( field_number < 0 || field_number >= (int) fields.size() )
+   {
+      return( NULL );
+   }
+
+   return( &fields[ field_number ] );
+}
+
+/*
+** Length of Field( field_number ), without building it
+*/
+
+int SENTENCE::Length( int field_number ) const
+{
+   const FIELD* field = Find( field_number );
+
+   if ( field == NULL )
+   {
+      return( fields.back().stars );
+   }
+
+   return( field->stars + wxMax( 0, field->end - field->start ) );
+}
+
+wxChar SENTENCE::Char( int field_number ) const
+{
+   const FIELD* field = Find( field_number );
 
-   int string_length = Sentence.Length();
-   int index = 1; // Skip over the $ at the begining of the sentence
+   if ( field == NULL )
+   {
+      return( fields.back().stars ? '*' : 0 );
+   }
 
-   while( index < string_length    &&
-       Sentence[ index ] != '*' &&
-       Sentence[ index ] != CARRIAGE_RETURN &&
-       Sentence[ index ] != LINE_FEED )
+   if ( field->stars > 0 )
    {
-       checksum_value ^= (char)Sentence[ index ];
-         index++;
+      return( '*' );
+   }
+
+   return( field->end > field->start ? (wxChar) Sentence[ field->start ] : 0 );
+}
+
+/*
+** The field if it is exactly one character, else 0
+*/
+
+wxChar SENTENCE::Single( int field_number ) const
+{
+   return( Length( field_number ) == 1 ? Char( field_number ) : 0 );
+}
+
+/*
+** The field as a C string for atof/atoi, which stop at the first character
+** that is not part of a number anyway
+*/
+
+bool SENTENCE::Number( int field_number, char* buffer, size_t size ) const
+{
+   const FIELD* field = Find( field_number );
+
+   if ( field == NULL || field->stars > 0 )
+   {
+      buffer[ 0 ] = 0x00;
+      return( Length( field_number ) > 0 );
+   }
+
+   size_t n = 0;
+   for( int index = field->start; index < field->end && n + 1 < size; index++ )
+   {
+      wxChar c = Sentence[ index ];
+
+      if ( c < 0x20 || c > 0x7E )
+      {
+         break;
+      }
+
+      buffer[ n++ ] = (char) c;
    }
+   buffer[ n ] = 0x00;
 
-   return( checksum_value );
+   return( field->end > field->start );
 }
 
 double SENTENCE::Double( int field_number ) const
 {
  //  ASSERT_VALID( this );
-      if(Field( field_number ).Len() == 0)
+      char buffer[ 64 ];
+
+      if ( !Number( field_number, buffer, sizeof( buffer ) ) )
             return (NAN);
 
-      wxCharBuffer abuf = Field( field_number).ToUTF8();
-      if( !abuf.data() )                            // badly formed sentence?
-        return (NAN);
-      
-      return( ::atof( abuf.data() ));
-      
+      return( ::atof( buffer ));
 }
 
 
@@ -179,15 +316,13 @@ EASTWEST SENTENCE::EastOrWest( int field_number ) const
 {
 //   ASSERT_VALID( this );
 
-   wxString field_data;
-
-   field_data = Field( field_number );
+   wxChar field_data = Single( field_number );
 
-   if ( field_data == _T("E") )
+   if ( field_data == 'E' )
    {
       return( East );
    }
-   else if ( field_data == _T("W") )
+   else if ( field_data == 'W' )
    {
       return( West );
    }
@@ -197,44 +332,20 @@ EASTWEST SENTENCE::EastOrWest( int field_number ) const
    }
 }
 
-const wxString& SENTENCE::Field( int desired_field_number ) const
+wxString SENTENCE::Field( int desired_field_number ) const
 {
 //   ASSERT_VALID( this );
 
-   static wxString return_string;
-   return_string.Empty();
-
-   int index                = 1; // Skip over the $ at the begining of the sentence
-   int current_field_number = 0;
-   int string_length        = 0;
+   const FIELD* field = Find( desired_field_number );
 
-   string_length = Sentence.Len();
+   // a field after the checksum separator reads as "*..."
+   wxString return_string( '*', field ? field->stars : fields.back().stars );
 
-   while( current_field_number < desired_field_number && index < string_length )
+   if ( field != NULL && field->end > field->start )
    {
-      if ( Sentence[ index ] == ',' || Sentence[ index ] == '*' )
-      {
-         current_field_number++;
-      }
-
-      if( Sentence[ index ] == '*')
-          return_string += Sentence[ index ];
-      index++;
+      return_string += Sentence.Mid( field->start, field->end - field->start );
    }
 
-   if ( current_field_number == desired_field_number )
-   {
-      while( index < string_length    &&
-             Sentence[ index ] != ',' &&
-             Sentence[ index ] != '*' &&
-             Sentence[ index ] != 0x00 )
-      {
-         return_string += Sentence[ index ];
-         index++;
-      }
-   }
-
-
    return( return_string );
 }
 
@@ -242,28 +353,17 @@ int SENTENCE::GetNumberOfDataFields( void ) const
 {
 //   ASSERT_VALID( this );
 
-   int index                = 1; // Skip over the $ at the begining of the sentence
-   int current_field_number = 0;
-   int string_length        = 0;
+   Find( 0 );
 
-   string_length = Sentence.Len();
+   int current_field_number = 0;
 
-   while( index < string_length )
+   while( current_field_number + 1 < (int) fields.size() &&
+          fields[ current_field_number + 1 ].stars == 0 )
    {
-      if ( Sentence[ index ] == '*' )
-      {
-         return( (int) current_field_number );
-      }
-
-      if ( Sentence[ index ] == ',' )
-      {
-         current_field_number++;
-      }
-
-      index++;
+      current_field_number++;
    }
 
-   return( (int) current_field_number );
+   return( current_field_number );
 }
 
 void SENTENCE::Finish( void )
@@ -281,11 +381,11 @@ void SENTENCE::Finish( void )
 int SENTENCE::Integer( int field_number ) const
 {
 //   ASSERT_VALID( this );
-    wxCharBuffer abuf = Field( field_number).ToUTF8();
-    if( !abuf.data() )                            // badly formed sentence?
-        return 0;
+    char buffer[ 32 ];
+
+    Number( field_number, buffer, sizeof( buffer ) );
 
-    return( ::atoi( abuf.data() ));
+    return( ::atoi( buffer ));
 }
 
 NMEA0183L_BOOLEAN SENTENCE::IsChecksumBad( int checksum_field_number ) const
@@ -316,15 +416,13 @@ LEFTRIGHT SENTENCE::LeftOrRight( int field_number ) const
 {
 //   ASSERT_VALID( this );
 
-   wxString field_data;
-
-   field_data = Field( field_number );
+   wxChar field_data = Single( field_number );
 
-   if ( field_data == _T("L") )
+   if ( field_data == 'L' )
    {
       return( Left );
    }
-   else if ( field_data == _T("R") )
+   else if ( field_data == 'R' )
    {
       return( Right );
    }
@@ -338,15 +436,13 @@ NORTHSOUTH SENTENCE::NorthOrSouth( int field_number ) const
 {
 //   ASSERT_VALID( this );
 
-   wxString field_data;
+   wxChar field_data = Single( field_number );
 
-   field_data = Field( field_number );
-
-   if ( field_data == _T("N") )
+   if ( field_data == 'N' )
    {
       return( North );
    }
-   else if ( field_data == _T("S") )
+   else if ( field_data == 'S' )
    {
       return( South );
    }
@@ -360,27 +456,25 @@ REFERENCE SENTENCE::Reference( int field_number ) const
 {
 //   ASSERT_VALID( this );
 
-   wxString field_data;
-
-   field_data = Field( field_number );
+   wxChar field_data = Single( field_number );
 
-   if ( field_data == _T("B") )
+   if ( field_data == 'B' )
    {
       return( BottomTrackingLog );
    }
-   else if ( field_data == _T("M") )
+   else if ( field_data == 'M' )
    {
       return( ManuallyEntered );
    }
-   else if ( field_data == _T("W") )
+   else if ( field_data == 'W' )
    {
       return( WaterReferenced );
    }
-   else if ( field_data == _T("R") )
+   else if ( field_data == 'R' )
    {
       return( RadarTrackingOfFixedTarget );
    }
-   else if ( field_data == _T("P") )
+   else if ( field_data == 'P' )
    {
       return( PositioningSystemGroundReference );
    }
@@ -394,47 +488,45 @@ TRANSDUCER_TYPE SENTENCE::TransducerType( int field_number ) const
 {
 //   ASSERT_VALID( this );
 
-   wxString field_data;
-
-   field_data = Field( field_number );
+   wxChar field_data = Single( field_number );
 
-   if ( field_data == _T("A") )
+   if ( field_data == 'A' )
    {
       return( AngularDisplacementTransducer );
    }
-   else if ( field_data == _T("D") )
+   else if ( field_data == 'D' )
    {
       return( LinearDisplacementTransducer );
    }
-   else if ( field_data == _T("C") )
+   else if ( field_data == 'C' )
    {
       return( TemperatureTransducer );
    }
-   else if ( field_data == _T("F") )
+   else if ( field_data == 'F' )
    {
       return( FrequencyTransducer );
    }
-   else if ( field_data == _T("N") )
+   else if ( field_data == 'N' )
    {
       return( ForceTransducer );
    }
-   else if ( field_data == _T("P") )
+   else if ( field_data == 'P' )
    {
       return( PressureTransducer );
    }
-   else if ( field_data == _T("R") )
+   else if ( field_data == 'R' )
    {
       return( FlowRateTransducer );
    }
-   else if ( field_data == _T("T") )
+   else if ( field_data == 'T' )
    {
       return( TachometerTransducer );
    }
-   else if ( field_data == _T("H") )
+   else if ( field_data == 'H' )
    {
       return( HumidityTransducer );
    }
-   else if ( field_data == _T("V") )
+   else if ( field_data == 'V' )
    {
       return( VolumeTransducer );
    }
@@ -460,6 +552,7 @@ const SENTENCE& SENTENCE::operator = ( const SENTENCE& source )
 //   ASSERT_VALID( this );
 
    Sentence = source.Sentence;
+   Index();
 
    return( *this );
 }
@@ -469,6 +562,7 @@ const SENTENCE& SENTENCE::operator = ( const wxString& source )
 //   ASSERT_VALID( this );
 
    Sentence = source;
+   Index();
 
    return( *this );
 }
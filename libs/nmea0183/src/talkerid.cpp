@@ -40,11 +40,9 @@
 ** You can use it any way you like.
 */
 
-wxString& talker_id( const wxString &sentence )
+wxString talker_id( const wxString &sentence )
 {
-    static wxString return_string;
-
-    return_string.Empty();
+    wxString return_string;
 
     if ( sentence.Len() >= 3 )
     {
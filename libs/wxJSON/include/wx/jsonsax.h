@@ -0,0 +1,92 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        jsonsax.h
+// Purpose:     event driven (SAX style) JSON parser
+// Licence:     wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#if !defined( _WX_JSONSAX_H )
+#define _WX_JSONSAX_H
+
+#include "wx/wxprec.h"
+
+#ifndef WX_PRECOMP
+    #include <wx/string.h>
+#endif
+
+#include <string>
+
+#include "json_defs.h"
+#include "jsonval.h"
+
+//! Receives the events of wxJSONSaxReader.
+/*!
+ Strings and keys are passed as UTF-8 pointer/length pairs that are only
+ valid during the call; they point straight into the input unless the
+ string contained escape sequences. Integers that fit into 64 bits are
+ reported by Int() / UInt(), which forward to Double() by default, so a
+ handler interested in numbers only needs to override Double().
+
+ Returning \c false from any callback stops the parser.
+*/
+class WXDLLIMPEXP_JSON wxJSONSaxHandler
+{
+public:
+    virtual ~wxJSONSaxHandler() {}
+
+    virtual bool StartObject() { return true; }
+    virtual bool EndObject() { return true; }
+    virtual bool StartArray() { return true; }
+    virtual bool EndArray() { return true; }
+    virtual bool Key( const char* str, size_t len ) { return true; }
+    virtual bool String( const char* str, size_t len ) { return true; }
+    virtual bool Int( wxInt64 i ) { return Double( (double) i ); }
+    virtual bool UInt( wxUint64 ui ) { return Double( (double) ui ); }
+    virtual bool Double( double d ) { return true; }
+    virtual bool Bool( bool b ) { return true; }
+    virtual bool Null() { return true; }
+};
+
+//! Single pass JSON parser working on a UTF-8 buffer.
+/*!
+ Numbers are converted directly from the input characters, independent of
+ the C locale, without building any wxString. The DOM overload of Parse()
+ builds the same wxJSONValue tree as wxJSONReader::Parse() and returns the
+ number of errors, so existing callers can switch without other changes.
+ C and C++ comments are skipped as wxJSONReader does by default.
+*/
+class WXDLLIMPEXP_JSON wxJSONSaxReader
+{
+public:
+    wxJSONSaxReader( int maxDepth = 256 );
+
+    bool Parse( const char* text, size_t len, wxJSONSaxHandler& handler );
+    bool Parse( const wxString& text, wxJSONSaxHandler& handler );
+    int  Parse( const wxString& text, wxJSONValue* val );
+
+    //! The handler returned \c false, this is not an error
+    bool   IsAborted() const { return m_aborted; }
+    size_t GetErrorOffset() const { return m_errorOffset; }
+    const wxString& GetError() const { return m_error; }
+
+protected:
+    bool ParseValue( wxJSONSaxHandler& handler, int depth );
+    bool ParseString( wxJSONSaxHandler& handler, bool key );
+    bool ParseNumber( wxJSONSaxHandler& handler );
+    bool ParseLiteral( const char* literal, size_t len );
+    bool SkipWhiteSpace();
+    bool Error( const char* descr );
+    bool Abort();
+
+    const char* m_begin;
+    const char* m_cur;
+    const char* m_end;
+    int         m_maxDepth;
+    bool        m_aborted;
+    size_t      m_errorOffset;
+    wxString    m_error;
+
+    //! Unescaped copy of the current string, reused between strings
+    std::string m_scratch;
+};
+
+#endif // _WX_JSONSAX_H
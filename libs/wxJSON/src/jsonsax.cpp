@@ -0,0 +1,485 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        jsonsax.cpp
+// Purpose:     event driven (SAX style) JSON parser
+// Licence:     wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include <wx/jsonsax.h>
+
+#include <math.h>
+#include <vector>
+
+static const double s_pow10[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+wxJSONSaxReader::wxJSONSaxReader( int maxDepth )
+{
+    m_begin = m_cur = m_end = 0;
+    m_maxDepth = maxDepth;
+    m_aborted = false;
+    m_errorOffset = 0;
+}
+
+bool
+wxJSONSaxReader::Parse( const wxString& text, wxJSONSaxHandler& handler )
+{
+    const wxScopedCharBuffer utf8 = text.utf8_str();
+    return Parse( utf8.data(), utf8.length(), handler );
+}
+
+bool
+wxJSONSaxReader::Parse( const char* text, size_t len, wxJSONSaxHandler& handler )
+{
+    m_begin = m_cur = text;
+    m_end = text + len;
+    m_aborted = false;
+    m_errorOffset = 0;
+    m_error.clear();
+
+    if ( !SkipWhiteSpace() || m_cur == m_end )
+        return Error( "no JSON value found" );
+    if ( !ParseValue( handler, 0 ) )
+        return false;
+    if ( !SkipWhiteSpace() )
+        return false;
+    if ( m_cur != m_end )
+        return Error( "unexpected text after the JSON value" );
+    return true;
+}
+
+bool
+wxJSONSaxReader::Error( const char* descr )
+{
+    if ( m_error.empty() )  {
+        m_errorOffset = m_cur - m_begin;
+        m_error = wxString::Format( "%s at offset %lu", descr,
+                                    (unsigned long) m_errorOffset );
+    }
+    return false;
+}
+
+bool
+wxJSONSaxReader::Abort()
+{
+    m_aborted = true;
+    return false;
+}
+
+bool
+wxJSONSaxReader::SkipWhiteSpace()
+{
+    while ( m_cur < m_end )  {
+        char ch = *m_cur;
+        if ( ch == ' ' || ch == '\t' || ch == '\n' || ch == '\r' )  {
+            m_cur++;
+        }
+        else if ( ch == '/' && m_cur + 1 < m_end && m_cur[1] == '/' )  {
+            while ( m_cur < m_end && *m_cur != '\n' )
+                m_cur++;
+        }
+        else if ( ch == '/' && m_cur + 1 < m_end && m_cur[1] == '*' )  {
+            m_cur += 2;
+            while ( m_cur + 1 < m_end && !( m_cur[0] == '*' && m_cur[1] == '/' ) )
+                m_cur++;
+            if ( m_cur + 1 >= m_end )
+                return Error( "unterminated comment" );
+            m_cur += 2;
+        }
+        else
+            break;
+    }
+    return true;
+}
+
+bool
+wxJSONSaxReader::ParseLiteral( const char* literal, size_t len )
+{
+    if ( (size_t) ( m_end - m_cur ) < len )
+        return Error( "invalid literal" );
+    for ( size_t i = 0; i < len; i++ )  {
+        if ( m_cur[i] != literal[i] )
+            return Error( "invalid literal" );
+    }
+    m_cur += len;
+    return true;
+}
+
+bool
+wxJSONSaxReader::ParseValue( wxJSONSaxHandler& handler, int depth )
+{
+    if ( depth > m_maxDepth )
+        return Error( "nesting too deep" );
+
+    switch ( *m_cur )  {
+        case '{':
+            m_cur++;
+            if ( !handler.StartObject() )
+                return Abort();
+            if ( !SkipWhiteSpace() )
+                return false;
+            if ( m_cur < m_end && *m_cur == '}' )  {
+                m_cur++;
+                return handler.EndObject() ? true : Abort();
+            }
+            while ( true )  {
+                if ( m_cur == m_end || *m_cur != '"' )
+                    return Error( "object key expected" );
+                if ( !ParseString( handler, true ) )
+                    return false;
+                if ( !SkipWhiteSpace() )
+                    return false;
+                if ( m_cur == m_end || *m_cur != ':' )
+                    return Error( "':' expected" );
+                m_cur++;
+                if ( !SkipWhiteSpace() )
+                    return false;
+                if ( m_cur == m_end )
+                    return Error( "value expected" );
+                if ( !ParseValue( handler, depth + 1 ) )
+                    return false;
+                if ( !SkipWhiteSpace() )
+                    return false;
+                if ( m_cur == m_end )
+                    return Error( "'}' expected" );
+                if ( *m_cur == ',' )  {
+                    m_cur++;
+                    if ( !SkipWhiteSpace() )
+                        return false;
+                    continue;
+                }
+                if ( *m_cur == '}' )  {
+                    m_cur++;
+                    return handler.EndObject() ? true : Abort();
+                }
+                return Error( "',' or '}' expected" );
+            }
+
+        case '[':
+            m_cur++;
+            if ( !handler.StartArray() )
+                return Abort();
+            if ( !SkipWhiteSpace() )
+                return false;
+            if ( m_cur < m_end && *m_cur == ']' )  {
+                m_cur++;
+                return handler.EndArray() ? true : Abort();
+            }
+            while ( true )  {
+                if ( m_cur == m_end )
+                    return Error( "value expected" );
+                if ( !ParseValue( handler, depth + 1 ) )
+                    return false;
+                if ( !SkipWhiteSpace() )
+                    return false;
+                if ( m_cur == m_end )
+                    return Error( "']' expected" );
+                if ( *m_cur == ',' )  {
+                    m_cur++;
+                    if ( !SkipWhiteSpace() )
+                        return false;
+                    continue;
+                }
+                if ( *m_cur == ']' )  {
+                    m_cur++;
+                    return handler.EndArray() ? true : Abort();
+                }
+                return Error( "',' or ']' expected" );
+            }
+
+        case '"':
+            return ParseString( handler, false );
+
+        case 't':
+            if ( !ParseLiteral( "true", 4 ) )
+                return false;
+            return handler.Bool( true ) ? true : Abort();
+
+        case 'f':
+            if ( !ParseLiteral( "false", 5 ) )
+                return false;
+            return handler.Bool( false ) ? true : Abort();
+
+        case 'n':
+            if ( !ParseLiteral( "null", 4 ) )
+                return false;
+            return handler.Null() ? true : Abort();
+
+        default:
+            if ( *m_cur == '-' || ( *m_cur >= '0' && *m_cur <= '9' ) )
+                return ParseNumber( handler );
+            return Error( "unexpected character" );
+    }
+}
+
+static int
+HexDigit( char ch )
+{
+    if ( ch >= '0' && ch <= '9' ) return ch - '0';
+    if ( ch >= 'a' && ch <= 'f' ) return ch - 'a' + 10;
+    if ( ch >= 'A' && ch <= 'F' ) return ch - 'A' + 10;
+    return -1;
+}
+
+static void
+AppendUTF8( std::string& s, unsigned long cp )
+{
+    if ( cp < 0x80 )  {
+        s += (char) cp;
+    }
+    else if ( cp < 0x800 )  {
+        s += (char) ( 0xC0 | ( cp >> 6 ) );
+        s += (char) ( 0x80 | ( cp & 0x3F ) );
+    }
+    else if ( cp < 0x10000 )  {
+        s += (char) ( 0xE0 | ( cp >> 12 ) );
+        s += (char) ( 0x80 | ( ( cp >> 6 ) & 0x3F ) );
+        s += (char) ( 0x80 | ( cp & 0x3F ) );
+    }
+    else  {
+        s += (char) ( 0xF0 | ( cp >> 18 ) );
+        s += (char) ( 0x80 | ( ( cp >> 12 ) & 0x3F ) );
+        s += (char) ( 0x80 | ( ( cp >> 6 ) & 0x3F ) );
+        s += (char) ( 0x80 | ( cp & 0x3F ) );
+    }
+}
+
+bool
+wxJSONSaxReader::ParseString( wxJSONSaxHandler& handler, bool key )
+{
+    const char* start = ++m_cur;    // skip the opening quote
+
+    // fast path: no escapes, the string is passed without copying
+    while ( m_cur < m_end && *m_cur != '"' && *m_cur != '\\' )
+        m_cur++;
+    if ( m_cur == m_end )
+        return Error( "unterminated string" );
+
+    const char* str = start;
+    size_t len = m_cur - start;
+
+    if ( *m_cur == '\\' )  {
+        m_scratch.assign( start, m_cur - start );
+        while ( m_cur < m_end && *m_cur != '"' )  {
+            if ( *m_cur != '\\' )  {
+                m_scratch += *m_cur++;
+                continue;
+            }
+            if ( ++m_cur == m_end )
+                break;
+            switch ( *m_cur++ )  {
+                case '"':  m_scratch += '"';  break;
+                case '\\': m_scratch += '\\'; break;
+                case '/':  m_scratch += '/';  break;
+                case 'b':  m_scratch += '\b'; break;
+                case 'f':  m_scratch += '\f'; break;
+                case 'n':  m_scratch += '\n'; break;
+                case 'r':  m_scratch += '\r'; break;
+                case 't':  m_scratch += '\t'; break;
+                case 'u':  {
+                    unsigned long cp = 0;
+                    for ( int i = 0; i < 4; i++ )  {
+                        int h = ( m_cur < m_end ) ? HexDigit( *m_cur++ ) : -1;
+                        if ( h < 0 )
+                            return Error( "invalid \\u escape" );
+                        cp = ( cp << 4 ) | h;
+                    }
+                    // a surrogate pair encodes a character outside the BMP
+                    if ( cp >= 0xD800 && cp <= 0xDBFF && m_end - m_cur >= 6 &&
+                         m_cur[0] == '\\' && m_cur[1] == 'u' )  {
+                        unsigned long lo = 0;
+                        bool ok = true;
+                        for ( int i = 2; i < 6 && ok; i++ )  {
+                            int h = HexDigit( m_cur[i] );
+                            ok = h >= 0;
+                            lo = ( lo << 4 ) | ( ok ? h : 0 );
+                        }
+                        if ( ok && lo >= 0xDC00 && lo <= 0xDFFF )  {
+                            cp = 0x10000 + ( ( cp - 0xD800 ) << 10 ) + ( lo - 0xDC00 );
+                            m_cur += 6;
+                        }
+                    }
+                    AppendUTF8( m_scratch, cp );
+                    break;
+                }
+                default:
+                    m_cur--;
+                    return Error( "invalid escape sequence" );
+            }
+        }
+        if ( m_cur == m_end )
+            return Error( "unterminated string" );
+        str = m_scratch.data();
+        len = m_scratch.size();
+    }
+    m_cur++;    // skip the closing quote
+
+    bool r = key ? handler.Key( str, len ) : handler.String( str, len );
+    return r ? true : Abort();
+}
+
+bool
+wxJSONSaxReader::ParseNumber( wxJSONSaxHandler& handler )
+{
+    bool negative = false;
+    bool integer = true;
+    wxUint64 mantissa = 0;
+    int digits = 0;     // significant digits stored in mantissa
+    int exp10 = 0;
+
+    if ( *m_cur == '-' )  {
+        negative = true;
+        m_cur++;
+    }
+    if ( m_cur == m_end || *m_cur < '0' || *m_cur > '9' )
+        return Error( "invalid number" );
+
+    if ( *m_cur == '0' )  {
+        m_cur++;
+    }
+    else  {
+        while ( m_cur < m_end && *m_cur >= '0' && *m_cur <= '9' )  {
+            unsigned d = *m_cur - '0';
+            if ( digits < 19 || ( digits == 19 &&
+                 mantissa <= ( (wxUint64) -1 - d ) / 10 ) )  {
+                mantissa = mantissa * 10 + d;
+                digits++;
+            }
+            else  {
+                exp10++;    // more digits than a wxUint64 holds exactly
+                integer = false;
+            }
+            m_cur++;
+        }
+    }
+
+    if ( m_cur < m_end && *m_cur == '.' )  {
+        integer = false;
+        m_cur++;
+        if ( m_cur == m_end || *m_cur < '0' || *m_cur > '9' )
+            return Error( "invalid number" );
+        while ( m_cur < m_end && *m_cur >= '0' && *m_cur <= '9' )  {
+            if ( digits < 19 )  {
+                mantissa = mantissa * 10 + ( *m_cur - '0' );
+                if ( mantissa != 0 )
+                    digits++;
+                exp10--;
+            }
+            m_cur++;
+        }
+    }
+
+    if ( m_cur < m_end && ( *m_cur == 'e' || *m_cur == 'E' ) )  {
+        integer = false;
+        m_cur++;
+        bool negExp = false;
+        if ( m_cur < m_end && ( *m_cur == '+' || *m_cur == '-' ) )
+            negExp = *m_cur++ == '-';
+        if ( m_cur == m_end || *m_cur < '0' || *m_cur > '9' )
+            return Error( "invalid number" );
+        int e = 0;
+        while ( m_cur < m_end && *m_cur >= '0' && *m_cur <= '9' )  {
+            if ( e < 10000 )
+                e = e * 10 + ( *m_cur - '0' );
+            m_cur++;
+        }
+        exp10 += negExp ? -e : e;
+    }
+
+    bool r;
+    if ( integer )  {
+        if ( !negative && mantissa > (wxUint64) 0x7FFFFFFFFFFFFFFFLL )
+            r = handler.UInt( mantissa );
+        else if ( negative && mantissa > (wxUint64) 0x8000000000000000ULL )
+            r = handler.Double( -(double) mantissa );
+        else if ( negative )
+            r = handler.Int( (wxInt64) ( 0 - mantissa ) );
+        else
+            r = handler.Int( (wxInt64) mantissa );
+    }
+    else  {
+        // exact for the usual coordinates and readings: a mantissa below
+        // 2^53 scaled by a power of ten that is itself exact
+        double d = (double) mantissa;
+        if ( exp10 > 22 || exp10 < -22 )
+            d *= pow( 10.0, exp10 );
+        else if ( exp10 > 0 )
+            d *= s_pow10[exp10];
+        else if ( exp10 < 0 )
+            d /= s_pow10[-exp10];
+        r = handler.Double( negative ? -d : d );
+    }
+    return r ? true : Abort();
+}
+
+
+//! Builds a wxJSONValue tree from the parser events.
+class wxJSONSaxDomBuilder : public wxJSONSaxHandler
+{
+public:
+    wxJSONSaxDomBuilder( wxJSONValue* root ) : m_root( root ) {}
+
+    virtual bool StartObject() {
+        m_stack.push_back( &Store( wxJSONValue( wxJSONTYPE_OBJECT ) ) );
+        return true;
+    }
+    virtual bool StartArray() {
+        m_stack.push_back( &Store( wxJSONValue( wxJSONTYPE_ARRAY ) ) );
+        return true;
+    }
+    virtual bool EndObject() { m_stack.pop_back(); return true; }
+    virtual bool EndArray() { m_stack.pop_back(); return true; }
+    virtual bool Key( const char* str, size_t len ) {
+        m_key = wxString::FromUTF8( str, len );
+        return true;
+    }
+    virtual bool String( const char* str, size_t len ) {
+        Store( wxJSONValue( wxString::FromUTF8( str, len ) ) );
+        return true;
+    }
+    virtual bool Int( wxInt64 i ) {
+#if defined( wxJSON_64BIT_INT )
+        Store( wxJSONValue( i ) );
+#else
+        Store( wxJSONValue( (int) i ) );
+#endif
+        return true;
+    }
+    virtual bool UInt( wxUint64 ui ) {
+#if defined( wxJSON_64BIT_INT )
+        Store( wxJSONValue( ui ) );
+#else
+        Store( wxJSONValue( (unsigned int) ui ) );
+#endif
+        return true;
+    }
+    virtual bool Double( double d ) { Store( wxJSONValue( d ) ); return true; }
+    virtual bool Bool( bool b ) { Store( wxJSONValue( b ) ); return true; }
+    virtual bool Null() { Store( wxJSONValue( wxJSONTYPE_NULL ) ); return true; }
+
+private:
+    wxJSONValue& Store( const wxJSONValue& v ) {
+        if ( m_stack.empty() )  {
+            *m_root = v;
+            return *m_root;
+        }
+        wxJSONValue* parent = m_stack.back();
+        if ( parent->IsArray() )
+            return parent->Append( v );
+        wxJSONValue& item = ( *parent )[m_key];
+        item = v;
+        return item;
+    }
+
+    wxJSONValue*              m_root;
+    std::vector<wxJSONValue*> m_stack;
+    wxString                  m_key;
+};
+
+int
+wxJSONSaxReader::Parse( const wxString& text, wxJSONValue* val )
+{
+    wxJSONValue temp;
+    wxJSONSaxDomBuilder builder( val ? val : &temp );
+    return Parse( text, builder ) ? 0 : 1;
+}
@@ -0,0 +1,480 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef WX_PRECOMP
+#include <wx/wx.h>
+#endif
+
+#include <wx/dir.h>
+#include <wx/filename.h>
+#include <wx/stopwatch.h>
+#include <wx/textfile.h>
+#include <wx/txtstrm.h>
+#include <wx/wfstream.h>
+
+#ifdef __WXMSW__
+#include <windows.h>
+#define PSAPI_VERSION 2
+#include <psapi.h>
+#elif defined __WXOSX__
+#include <mach/mach.h>
+#else
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+#include <cmath>
+
+#include "Benchmark.h"
+#include "CrewList.h"
+#include "Logbook.h"
+#include "LogbookDialog.h"
+#include "Maintenance.h"
+#include "Options.h"
+#include "OverView.h"
+#include "boat.h"
+#include "config.h"
+#include "logbook_pi.h"
+
+using namespace std;
+
+#define PI 3.14159265
+
+static const int defaultRows[] = {1000, 10000, 100000};
+
+LogbookGenerator::LogbookGenerator(Options* o, unsigned long seed) {
+  opt = o;
+  state = seed ? seed : 1;
+}
+
+unsigned long LogbookGenerator::next() {
+  // 32bit LCG, identical on every platform
+  state = (state * 1664525UL + 1013904223UL) & 0xFFFFFFFFUL;
+  return state >> 8;
+}
+
+double LogbookGenerator::uniform(double from, double to) {
+  return from + (to - from) * (next() % 100000) / 100000.0;
+}
+
+bool LogbookGenerator::write(wxString path, int rows) {
+  dt.Set(1, wxDateTime::Jan, 2000, 8, 0, 0);
+  lat = 54.3;
+  lon = 10.15;
+  dtotal = 0;
+  route = 1;
+  motorMin = 0;
+  fuelTotal = 0;
+
+  wxFileOutputStream output(path);
+  if (!output.IsOk()) return false;
+  wxTextOutputStream stream(output, wxEOL_NATIVE, wxConvUTF8);
+
+  stream.WriteString(
+      wxString::Format("#1.2#\tBenchmark %i rows\n", rows));
+  for (int row = 0; row < rows; row++) stream.WriteString(line(row));
+
+  output.Close();
+  return true;
+}
+
+wxString LogbookGenerator::guid(int n) {
+  return wxString::Format("%08x-%04x-4%03x-a%03x-%012x", n * 2654435761U,
+                          n & 0xFFFF, n & 0xFFF, (n >> 4) & 0xFFF, n);
+}
+
+wxString LogbookGenerator::position(double la, double lo) {
+  double ala = fabs(la), alo = fabs(lo);
+  return wxString::Format("%02d%s %07.4f' %c\n%03d%s %07.4f' %c", (int)ala,
+                          opt->Deg.c_str(), (ala - (int)ala) * 60.0,
+                          (la < 0) ? 'S' : 'N', (int)alo, opt->Deg.c_str(),
+                          (alo - (int)alo) * 60.0, (lo < 0) ? 'W' : 'E');
+}
+
+wxString LogbookGenerator::remarks(int row) {
+  switch (next() % 6) {
+    case 0:
+      return wxEmptyString;
+    case 1:
+      return "Course changed";
+    case 2:
+      return wxString::Format("Waypoint %i arrived\nNext waypoint %i",
+                              row % 17, row % 17 + 1);
+    case 3:
+      return "Reefed main\nWind increasing\nSea state rough";
+    case 4:
+      return wxString::Format("Watch change %i", row % 4);
+    default:
+      return "Position checked with bearings\nCross-check ok";
+  }
+}
+
+wxString LogbookGenerator::line(int row) {
+  // a new route on average every 275 rows, each with its own route and
+  // track GUID
+  if (row > 0 && next() % 275 == 0) route++;
+
+  double sog = uniform(0.0, 8.5);
+  double cog = uniform(0.0, 360.0);
+  double dist = sog * uniform(0.8, 1.2);
+  dtotal += dist;
+  lat += dist / 60.0 * cos(cog * PI / 180.0);
+  lon += dist / 60.0 * sin(cog * PI / 180.0) / cos(lat * PI / 180.0);
+  bool motor = sog < 3.0;
+  if (motor) {
+    motorMin += 60;
+    fuelTotal += 2.5;
+  }
+
+  wxArrayString f;
+  f.Add(wxString::Format("Route %i", route));
+  f.Add(wxString::Format("%i", dt.GetMonth()));
+  f.Add(wxString::Format("%i", dt.GetDay()));
+  f.Add(wxString::Format("%i", dt.GetYear()));
+  f.Add(wxString::Format("%i", dt.GetHour()));
+  f.Add(wxString::Format("%i", dt.GetMinute()));
+  f.Add(wxString::Format("%i", dt.GetSecond()));
+  f.Add(motor ? "M" : "S");
+  f.Add(wxString::Format("Watch %c", 'A' + (dt.GetHour() / 4) % 3));
+  f.Add(wxString::Format("%.2f %s", dist, opt->showDistance.c_str()));
+  f.Add(wxString::Format("%.2f %s", dtotal, opt->showDistance.c_str()));
+  f.Add(position(lat, lon));
+  f.Add(wxString::Format("%.2f%s", cog, opt->Deg.c_str()));
+  f.Add(wxString::Format("%.2f%s", fmod(cog + uniform(-5, 5) + 360, 360),
+                         opt->Deg.c_str()));
+  f.Add(wxString::Format("%.2f %s", sog, opt->showBoatSpeed.c_str()));
+  f.Add(wxString::Format("%.2f %s", sog * 0.95, opt->showBoatSpeed.c_str()));
+  f.Add(wxString::Format("%.1f %s", uniform(2, 80), opt->meter.c_str()));
+  f.Add(remarks(row));
+  f.Add(wxString::Format("%.0f %s", uniform(990, 1035), opt->baro.c_str()));
+  f.Add(wxString::Format("%.0f%s", uniform(0, 360), opt->Deg.c_str()));
+  f.Add(wxString::Format("%.1f %s", uniform(0, 35),
+                         opt->showWindSpeed.c_str()));
+  f.Add(wxString::Format("%.0f%s", uniform(0, 360), opt->Deg.c_str()));
+  f.Add(wxString::Format("%.1f %s", uniform(0, 2), opt->showBoatSpeed.c_str()));
+  f.Add(wxString::Format("%.1f %s", uniform(0, 3), opt->meter.c_str()));
+  f.Add(wxString::Format("%.1f %s", uniform(0, 2), opt->meter.c_str()));
+  f.Add((next() % 3) ? "sunny" : "overcast\nlight rain");
+  f.Add("Cu");
+  f.Add("good");
+  f.Add(motor ? "01:00" : "00:00");
+  f.Add(wxString::Format("%02d:%02d %s", motorMin / 60, motorMin % 60,
+                         opt->motorh.c_str()));
+  f.Add(wxString::Format("%.1f %s", motor ? -2.5 : 0.0, opt->vol.c_str()));
+  f.Add(wxString::Format("%.1f %s", 200 - fmod(fuelTotal, 200),
+                         opt->vol.c_str()));
+  f.Add(motor ? wxString() : wxString("Main, Genoa"));
+  f.Add((next() % 4) ? wxString() : wxString("1. reef"));
+  f.Add(wxString::Format("%.1f %s", -uniform(0, 5), opt->vol.c_str()));
+  f.Add(wxString::Format("%.1f %s", uniform(50, 300), opt->vol.c_str()));
+  f.Add(motor ? "Engine #1 running" : " ");
+  f.Add(wxString::Format("%.0f%%", uniform(40, 95)));
+  f.Add(wxString::Format("%.1f %s", uniform(5, 30),
+                         opt->temperature.c_str()));
+  f.Add(wxString::Format("%.1f %s", uniform(8, 26),
+                         opt->temperature.c_str()));
+  f.Add("00:00");
+  f.Add(wxString::Format("00:00 %s", opt->motorh.c_str()));
+  f.Add("00:00");
+  f.Add(wxString::Format("00:00 %s", opt->motorh.c_str()));
+  f.Add(wxString::Format("%.2f %s", -uniform(0, 10), opt->ampereh.c_str()));
+  f.Add(wxString::Format("%.2f %s", uniform(100, 400), opt->ampereh.c_str()));
+  f.Add(wxString::Format("%.2f %s", -uniform(0, 5), opt->ampereh.c_str()));
+  f.Add(wxString::Format("%.2f %s", uniform(50, 200), opt->ampereh.c_str()));
+  f.Add("00:00");
+  f.Add(wxString::Format("00:00 %s", opt->motorh.c_str()));
+  f.Add(wxString::Format("0.00 %s", opt->vol.c_str()));
+  f.Add(guid(route));
+  f.Add(guid(route + 100000));
+  f.Add(motor ? wxString::Format("%.0f (%s)", uniform(1200, 2600),
+                                 opt->engine.c_str())
+              : wxString());
+  f.Add(wxString());
+  f.Add(wxString::Format("%.0f%s", uniform(0, 360), opt->Deg.c_str()));
+  f.Add(wxString::Format("%.1f %s", uniform(0, 40),
+                         opt->showWindSpeed.c_str()));
+
+  dt += wxTimeSpan(1, (int)(next() % 10), 0);
+
+  wxString s;
+  for (unsigned int i = 0; i < f.Count(); i++) {
+    f[i].Replace("\n", "\\n");
+    s += f[i] + " \t";
+  }
+  s.RemoveLast();
+  return s + "\n";
+}
+
+////////////////////////////////////////////////////////////
+
+LogbookBenchmark::LogbookBenchmark(LogbookDialog* d) {
+  dialog = d;
+  opt = d->logbookPlugIn->opt;
+  dir = d->data + "benchmark";
+  if (!wxDir::Exists(dir)) wxMkdir(dir);
+  dialog->appendOSDirSlash(&dir);
+}
+
+LogbookBenchmark::~LogbookBenchmark(void) {}
+
+// the resident set right now; the high-water mark of the process only
+// ever grows and would hide every exporter after the largest one
+long LogbookBenchmark::currentMemoryKB() {
+#ifdef __WXMSW__
+  PROCESS_MEMORY_COUNTERS pmc;
+  if (GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc)))
+    return (long)(pmc.WorkingSetSize / 1024);
+  return 0;
+#elif defined __WXOSX__
+  mach_task_basic_info_data_t info;
+  mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+  if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, (task_info_t)&info,
+                &count) != KERN_SUCCESS)
+    return 0;
+  return (long)(info.resident_size / 1024);
+#else
+  long pages = 0, resident = 0;
+  FILE* statm = fopen("/proc/self/statm", "r");
+  if (statm) {
+    if (fscanf(statm, "%ld %ld", &pages, &resident) != 2) resident = 0;
+    fclose(statm);
+    return resident * (sysconf(_SC_PAGESIZE) / 1024);
+  }
+  // no procfs, the high-water mark is all there is
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+  return usage.ru_maxrss;
+#endif
+}
+
+wxThread::ExitCode LogbookBenchmark::Sampler::Entry() {
+  while (!TestDestroy()) {
+    long kb = currentMemoryKB();
+    {
+      wxMutexLocker locker(lock);
+      if (kb > peak) peak = kb;
+    }
+    Sleep(SAMPLEMS);
+  }
+  return (ExitCode)0;
+}
+
+long LogbookBenchmark::Sampler::highest() {
+  wxMutexLocker locker(lock);
+  return peak;
+}
+
+wxString LogbookBenchmark::layoutFor(int section, wxChoice* choice) {
+  if (choice->GetCount() == 0) return wxEmptyString;
+  wxString layout = choice->GetString(
+      (choice->GetSelection() == wxNOT_FOUND) ? 0 : choice->GetSelection());
+  if (section == LogbookDialog::LOGBOOK) {
+    if (opt->filterLayout[section])
+      layout.Prepend(opt->engineStr[opt->engines] +
+                     opt->layoutPrefix[section]);
+  } else if (opt->filterLayout[section])
+    layout.Prepend(opt->layoutPrefix[section]);
+  return layout;
+}
+
+wxString LogbookBenchmark::tempFile(wxString name, int rows, wxString ext) {
+  wxString file = dir + wxString::Format("%s_%i.%s", name.c_str(), rows,
+                                         ext.c_str());
+  if (wxFileExists(file)) wxRemoveFile(file);
+  return file;
+}
+
+void LogbookBenchmark::measure(wxString name, int rows, wxString out,
+                               std::function<void(wxString)> exporter) {
+  result r;
+  long base = currentMemoryKB();
+  Sampler sampler(base);
+  bool sampling = sampler.Run() == wxTHREAD_NO_ERROR;
+  wxStopWatch sw;
+  exporter(out);
+  r.ms = sw.TimeInMicro().ToDouble() / 1000.0;
+  // blocks until the sampler has left Entry()
+  if (sampling) sampler.Delete(NULL, wxTHREAD_WAIT_BLOCK);
+  r.exporter = name;
+  r.rows = rows;
+  r.bytes = wxFileExists(out) ? wxFileName::GetSize(out) : wxULongLong(0);
+  // highest resident set seen while this exporter ran, over that before
+  r.peakKB = wxMax(sampler.highest(), currentMemoryKB()) - base;
+  results.push_back(r);
+}
+
+wxJSONValue LogbookBenchmark::run(wxJSONValue& request) {
+  vector<int> rowCounts;
+  if (request.HasMember("Rows"))
+    for (int i = 0; i < request["Rows"].Size(); i++)
+      rowCounts.push_back(request["Rows"][i].AsInt());
+  if (rowCounts.empty())
+    rowCounts.assign(defaultRows,
+                     defaultRows + sizeof(defaultRows) / sizeof(int));
+  unsigned long seed =
+      request.HasMember("Seed") ? request["Seed"].AsUInt() : 1;
+
+  Logbook* logbook = dialog->logbook;
+  logbook->update();
+  wxString current = logbook->data_locn;
+  wxString voyage = logbook->voyage;
+  bool actual = (current == logbook->logbookData_actual) && voyage.IsEmpty();
+
+  wxString logLayout = layoutFor(LogbookDialog::LOGBOOK, dialog->logbookChoice);
+  bool logHTML = dialog->m_radioBtnHTML->GetValue();
+
+  results.clear();
+  for (unsigned int n = 0; n < rowCounts.size(); n++) {
+    int rows = rowCounts[n];
+    wxString file = dir + wxString::Format(
+                              "until_2000-01-01_bench%i_logbook.txt", rows);
+    LogbookGenerator gen(opt, seed);
+    if (!gen.write(file, rows)) continue;
+
+    measure("Load", rows, file,
+            [&](wxString path) { logbook->loadSelectedData(path); });
+    if (!logLayout.IsEmpty()) {
+      if (logHTML)
+        measure("Logbook HTML", rows, tempFile("logbook", rows, "html"),
+                [&](wxString path) { logbook->toHTML(path, logLayout, true); });
+      else
+        measure("Logbook ODT", rows, tempFile("logbook", rows, "odt"),
+                [&](wxString path) { logbook->toODT(path, logLayout, true); });
+    }
+    measure("Logbook KML", rows, tempFile("logbook", rows, "kml"),
+            [&](wxString path) { logbook->toKML(path); });
+    measure("Logbook ODS", rows, tempFile("logbook", rows, "ods"),
+            [&](wxString path) { logbook->toODS(path); });
+    measure("Logbook XML", rows, tempFile("logbook", rows, "xml"),
+            [&](wxString path) { logbook->toXML(path); });
+    measure("Logbook CSV", rows, tempFile("logbook", rows, "csv"),
+            [&](wxString path) { logbook->toCSV(path); });
+    // the three above in one pass over the grids
+    measure("Logbook CSV+XML+ODS", rows, tempFile("tables", rows, "csv"),
+            [&](wxString path) {
+              logbook->toTables(path, tempFile("tables", rows, "xml"),
+                                tempFile("tables", rows, "ods"));
+            });
+  }
+
+  // the other tabs are timed once on the data the user has loaded
+  wxString layout = layoutFor(LogbookDialog::CREW, dialog->crewChoice);
+  int rows = dialog->m_gridCrew->GetNumberRows();
+  if (!layout.IsEmpty()) {
+    if (dialog->m_radioBtnHTMLCrew->GetValue())
+      measure("Crew HTML", rows, tempFile("crew", rows, "html"),
+              [&](wxString path) {
+                dialog->crewList->saveHTML(path, layout, false);
+              });
+    else
+      measure("Crew ODT", rows, tempFile("crew", rows, "odt"),
+              [&](wxString path) {
+                dialog->crewList->saveODT(path, layout, true);
+              });
+  }
+  measure("Crew ODS", rows, tempFile("crew", rows, "ods"),
+          [&](wxString path) { dialog->crewList->saveODS(path); });
+
+  layout = layoutFor(LogbookDialog::BOAT, dialog->boatChoice);
+  rows = dialog->m_gridEquipment->GetNumberRows();
+  if (!layout.IsEmpty()) {
+    if (dialog->m_radioBtnHTMLBoat->GetValue())
+      measure("Boat HTML", rows, tempFile("boat", rows, "html"),
+              [&](wxString path) { dialog->boat->toHTML(path, layout, true); });
+    else
+      measure("Boat ODT", rows, tempFile("boat", rows, "odt"),
+              [&](wxString path) { dialog->boat->toODT(path, layout, true); });
+  }
+
+  layout = layoutFor(LogbookDialog::GSERVICE,
+                     dialog->m_choiceSelectLayoutService);
+  rows = dialog->m_gridMaintanence->GetNumberRows();
+  if (!layout.IsEmpty()) {
+    if (dialog->m_radioBtnHTMLService->GetValue())
+      measure("Service HTML", rows, tempFile("service", rows, "html"),
+              [&](wxString path) {
+                dialog->maintenance->toHTML(0, path, layout, 2);
+              });
+    else
+      measure("Service ODT", rows, tempFile("service", rows, "odt"),
+              [&](wxString path) {
+                dialog->maintenance->toODT(0, path, layout, 2);
+              });
+  }
+
+  layout = layoutFor(LogbookDialog::OVERVIEW, dialog->overviewChoice);
+  rows = dialog->m_gridOverview->GetNumberRows();
+  if (!layout.IsEmpty()) {
+    if (dialog->m_radioBtnHTMLOverview->GetValue())
+      measure("Overview HTML", rows, tempFile("overview", rows, "html"),
+              [&](wxString path) {
+                dialog->overview->toHTML(path, layout, 2);
+              });
+    else
+      measure("Overview ODT", rows, tempFile("overview", rows, "odt"),
+              [&](wxString path) { dialog->overview->toODT(path, layout, 2); });
+  }
+
+  if (actual)
+    logbook->switchToActualLogbook();
+  else if (!voyage.IsEmpty())
+    logbook->loadVoyage(wxSplit(voyage, ';', '\0'));
+  else
+    logbook->loadSelectedData(current);
+
+  writeReport();
+
+  wxJSONValue out;
+  for (unsigned int i = 0; i < results.size(); i++) {
+    result& r = results[i];
+    out[i]["Exporter"] = r.exporter;
+    out[i]["Rows"] = r.rows;
+    out[i]["Milliseconds"] = r.ms;
+    out[i]["Bytes"] = r.bytes.ToDouble();
+    out[i]["BytesPerSecond"] =
+        (r.ms > 0) ? r.bytes.ToDouble() / (r.ms / 1000.0) : 0.0;
+    out[i]["PeakRSSGrowthKB"] = (int)r.peakKB;
+  }
+  return out;
+}
+
+void LogbookBenchmark::writeReport() {
+  wxString report = dir + "benchmark.csv";
+  bool header = !wxFileExists(report);
+
+  wxFFileOutputStream output(report, "a");
+  if (!output.IsOk()) return;
+  wxTextOutputStream stream(output, wxEOL_NATIVE, wxConvUTF8);
+
+  if (header)
+    stream << "Date,Version,Exporter,Rows,Milliseconds,Bytes,BytesPerSecond,"
+              "PeakRSSGrowthKB\n";
+
+  wxString now = wxDateTime::Now().FormatISOCombined(' ');
+  wxString version = wxString::Format("%i.%i", PLUGIN_VERSION_MAJOR,
+                                      PLUGIN_VERSION_MINOR);
+  for (unsigned int i = 0; i < results.size(); i++) {
+    result& r = results[i];
+    double bps = (r.ms > 0) ? r.bytes.ToDouble() / (r.ms / 1000.0) : 0.0;
+    stream << wxString::Format("%s,%s,%s,%i,%.2f,%s,%.0f,%ld\n", now.c_str(),
+                               version.c_str(), r.exporter.c_str(), r.rows,
+                               r.ms, r.bytes.ToString().c_str(), bps,
+                               r.peakKB);
+  }
+}
@@ -0,0 +1,116 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#ifndef _BENCHMARK_H_
+#define _BENCHMARK_H_
+
+#ifndef  WX_PRECOMP
+#include "wx/wx.h"
+#endif //precompiled headers
+
+#include <wx/jsonval.h>
+#include <wx/thread.h>
+
+#include <functional>
+#include <vector>
+
+class LogbookDialog;
+class Options;
+
+/**
+ * Deterministic generator for synthetic logbooks in the #1.2# file format.
+ * The same seed and row count always produce the same file, so timings
+ * taken with different releases can be compared.
+ */
+class LogbookGenerator
+{
+public:
+    LogbookGenerator( Options* o, unsigned long seed );
+
+    bool     write( wxString path, int rows );
+
+private:
+    wxString line( int row );
+    wxString position( double lat, double lon );
+    wxString remarks( int row );
+    wxString guid( int n );
+    unsigned long next();
+    double   uniform( double from, double to );
+
+    Options* opt;
+    unsigned long state;
+
+    wxDateTime dt;
+    double   lat, lon;
+    double   dtotal;
+    int      route;
+    int      motorMin;
+    double   fuelTotal;
+};
+
+/**
+ * Times every exporter against generated logbooks. Triggered by the
+ * LOGBOOK_BENCHMARK_REQUEST plugin message, answered with
+ * LOGBOOK_BENCHMARK_RESPONSE and appended to benchmark.csv in the data dir.
+ */
+class LogbookBenchmark
+{
+public:
+    LogbookBenchmark( LogbookDialog* d );
+    ~LogbookBenchmark( void );
+
+    wxJSONValue run( wxJSONValue& request );
+
+    struct result
+    {
+        wxString exporter;
+        int      rows;
+        double   ms;
+        wxULongLong bytes;
+        long     peakKB;
+    };
+
+private:
+    void     measure( wxString name, int rows, wxString out,
+                      std::function<void( wxString )> exporter );
+    wxString layoutFor( int section, wxChoice* choice );
+    wxString tempFile( wxString name, int rows, wxString ext );
+    void     writeReport();
+    static long currentMemoryKB();
+
+    // polls the resident set while an exporter runs
+    class Sampler : public wxThread
+    {
+    public:
+        enum { SAMPLEMS = 5 };
+        Sampler( long kb ) : wxThread( wxTHREAD_JOINABLE ), peak( kb ) {}
+        virtual ExitCode Entry();
+        long     highest();
+    private:
+        wxMutex  lock;
+        long     peak;
+    };
+
+    LogbookDialog* dialog;
+    Options* opt;
+    wxString dir;
+    std::vector<result> results;
+};
+#endif
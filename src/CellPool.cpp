@@ -0,0 +1,53 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef WX_PRECOMP
+#include <wx/wx.h>
+#endif
+
+#include "CellPool.h"
+
+using namespace std;
+
+const wxString CellPool::Cell::empty;
+
+// never destroyed, grids may outlive static destructors on unload
+CellPool& CellPool::pool() {
+  static CellPool* p = new CellPool;
+  return *p;
+}
+
+CellPool::Cell& CellPool::Cell::operator=(const Cell& c) {
+  if (c.e) c.e->second++;
+  if (e) CellPool::pool().release(e);
+  e = c.e;
+  return *this;
+}
+
+CellPool::entry* CellPool::intern(const wxString& s) {
+  if (s.IsEmpty()) return NULL;
+  entry& e = *entries.insert(make_pair(s, 0u)).first;
+  e.second++;
+  return &e;
+}
+
+void CellPool::release(entry* e) {
+  if (--e->second == 0) entries.erase(entries.find(e->first));
+}
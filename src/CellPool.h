@@ -0,0 +1,77 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#ifndef _CELLPOOL_H_
+#define _CELLPOOL_H_
+
+#ifndef  WX_PRECOMP
+#include "wx/wx.h"
+#endif //precompiled headers
+
+#include <wx/string.h>
+
+#include <unordered_map>
+#include <utility>
+
+/**
+ * One copy of every distinct text in the logbook, crew and maintenance
+ * grids. Most cells repeat (route, sails, units, weather), so a grid only
+ * keeps a Cell per cell, a pointer into the pool, and equal texts are equal
+ * pointers. Entries are reference counted and leave the pool with their
+ * last Cell. The empty text is the null Cell and not pooled.
+ *
+ * Like the grids, the pool belongs to the GUI thread.
+ */
+class CellPool
+{
+public:
+    typedef std::pair<const wxString, unsigned int> entry;
+
+    class Cell
+    {
+    public:
+        Cell() : e( NULL ) {}
+        explicit Cell( const wxString& s ) : e( CellPool::pool().intern( s ) ) {}
+        Cell( const Cell& c ) : e( c.e ) { if ( e ) e->second++; }
+        ~Cell() { if ( e ) CellPool::pool().release( e ); }
+
+        Cell&     operator=( const Cell& c );
+        bool      operator==( const Cell& c ) const { return e == c.e; }
+        bool      operator!=( const Cell& c ) const { return e != c.e; }
+
+        const wxString& str() const { return e ? e->first : empty; }
+        bool      IsEmpty() const { return e == NULL; }
+
+    private:
+        static const wxString empty;
+        entry*    e;
+    };
+
+    static CellPool& pool();
+    size_t    size() const { return entries.size(); }
+
+private:
+    entry*    intern( const wxString& s );
+    void      release( entry* e );
+
+    std::unordered_map<wxString, unsigned int, wxStringHash, wxStringEqual>
+              entries;
+};
+#endif
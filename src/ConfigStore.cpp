@@ -0,0 +1,73 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef WX_PRECOMP
+#include <wx/wx.h>
+#endif
+
+#include "ConfigStore.h"
+
+using namespace std;
+
+ConfigStore::ConfigStore(wxFileConfig* c, const wxString& p,
+                         function<void()> s)
+    : conf(c), path(p), save(s), changed(false) {}
+
+void ConfigStore::load() {
+  values.clear();
+  if (!conf) return;
+  conf->SetPath(path);
+
+  wxString key;
+  long cookie;
+  for (bool more = conf->GetFirstEntry(key, cookie); more;
+       more = conf->GetNextEntry(key, cookie))
+    conf->Read(key, &values[key]);
+}
+
+void ConfigStore::write(const wxString& key, const wxString& value) {
+  map<wxString, wxString>::iterator it = values.find(key);
+  if (!conf || (it != values.end() && it->second == value)) return;
+
+  conf->SetPath(path);
+  conf->Write(key, value);
+  values[key] = value;
+  changed = true;
+}
+
+// as wxConfig writes numbers, so what was read compares equal
+void ConfigStore::write(const wxString& key, long value) {
+  write(key, wxString::Format("%ld", value));
+}
+
+void ConfigStore::write(const wxString& key, double value) {
+  write(key, wxString::FromCDouble(value));
+}
+
+void ConfigStore::schedule() { Start(DEBOUNCEMS, wxTIMER_ONE_SHOT); }
+
+void ConfigStore::commit() {
+  Stop();
+  if (save) save();
+  if (changed && conf) conf->Flush();
+  changed = false;
+}
+
+void ConfigStore::Notify() { commit(); }
@@ -0,0 +1,74 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+#ifndef _CONFIGSTORE_H_
+#define _CONFIGSTORE_H_
+
+#ifndef  WX_PRECOMP
+#include "wx/wx.h"
+#endif //precompiled headers
+
+#include <wx/fileconf.h>
+#include <wx/timer.h>
+
+#include <functional>
+#include <map>
+
+/**
+ * The plugin's group of the OpenCPN config with what is known to be on
+ * disk. load() takes that once after the options have been read, write()
+ * then hands a key to wxFileConfig only when its value differs, so a
+ * save that changed nothing leaves the config file clean and OpenCPN
+ * does not rewrite it.
+ *
+ * schedule() is for bursts of changes: the save callback runs once,
+ * DEBOUNCEMS after the last call, and the config is flushed when a key
+ * was written. commit() runs a pending save right away.
+ */
+class ConfigStore : public wxTimer
+{
+public:
+    enum { DEBOUNCEMS = 2000 };
+
+    ConfigStore( wxFileConfig* conf, const wxString& path,
+                 std::function<void()> save );
+
+    void      load();
+    void      write( const wxString& key, const wxString& value );
+    void      write( const wxString& key, long value );
+    void      write( const wxString& key, int value ) { write( key, (long)value ); }
+    void      write( const wxString& key, bool value ) { write( key, (long)value ); }
+    void      write( const wxString& key, double value );
+
+    void      schedule();
+    void      commit();
+    bool      dirty() const { return changed; }
+
+    virtual void Notify();
+
+private:
+    wxFileConfig* conf;
+    wxString      path;
+    std::function<void()> save;
+    std::map<wxString, wxString> values;
+    bool          changed;
+};
+#endif
@@ -21,11 +21,13 @@
 #include <wx/wx.h>
 #endif
 
+#include <algorithm>
 #include <memory>
 
 #include <wx/arrstr.h>
 #include <wx/filename.h>
 #include <wx/mimetype.h>
+#include <wx/textfile.h>
 #include <wx/tokenzr.h>
 #include <wx/txtstrm.h>
 #include <wx/wfstream.h>
@@ -34,8 +36,11 @@
 
 #include "CrewList.h"
 #include "Export.h"
+#include "ExportPipeline.h"
 #include "LogbookDialog.h"
 #include "Logbook.h"
+#include "LogbookScheduler.h"
+#include "ODSWriter.h"
 #include "logbook_pi.h"
 #include "Options.h"
 
@@ -273,7 +278,8 @@ void CrewList::loadData() {
 
   setMembersInMenu();
 
-  dayNow(false);
+  buildWatchPlan();
+  dayNow();
   if (day != 0) {
     dialog->m_textCtrlWatchStartDate->Enable(false);
     dialog->m_textCtrlWatchStartTime->Enable(false);
@@ -952,8 +958,9 @@ void CrewList::Calculate() {
                        shift, dialog->m_textCtrlWakeTrip->GetValue().c_str()),
       0);
   watchListFile->Write();
+  buildWatchPlan();
   day = 1;
-  dayNow(false);
+  dayNow();
   setDayButtons(shift);
   setMembersInMenu();
 }
@@ -1082,6 +1089,7 @@ void CrewList::setAsNewWatchbase() {
   dialog->m_textCtrlWatchStartDate->SetValue(
       start.Format(dialog->logbookPlugIn->opt->sdateformat));
   watchListFile->Clear();
+  buildWatchPlan();
   day = 0;
   dialog->m_textCtrlWakeDay->SetValue("0");
   dialog->m_buttonCalculate->Enable(true);
@@ -1246,6 +1254,7 @@ void CrewList::setDayButtons(bool shift) {
 void CrewList::clearWake() {
   watchListFile->Clear();
   watchListFile->Write();
+  buildWatchPlan();
 
   gridWake->BeginBatch();
   gridWake->DeleteCols(0, gridWake->GetNumberCols());
@@ -1289,83 +1298,110 @@ void CrewList::dayMinus() {
     gridWake->SetCellBackgroundColour(2, ActualWatch::col, wxColor(0, 255, 0));
 }
 
-void CrewList::dayNow(bool mode) {
-  wxString s, sd, st, date, time, timedf, ttmp, str;
-  wxDateTime dtstart, dtend, now;
-  wxTimeSpan ed(0, 0, 0, 1);
-  long d;
-  int lineno;
-  unsigned int col = 0, daylast = 1;
+void CrewList::dayNow() {
+  wxDateTime now;
 
   if (dialog->logbook->sDate != wxEmptyString)
     now = dialog->logbook->mCorrectedDateTime;
   else
     now = wxDateTime::Now();
 
-  if ((lineno = getDayOne(1)) == -1) {
+  if (watchPlan.empty()) {
     statusText(DEFAULTWATCH);
     return;
   }
 
   ActualWatch::active = false;
-  while (lineno < (int)watchListFile->GetLineCount()) {
-    s = watchListFile->GetLine(lineno);
-    wxStringTokenizer tkz(s, "\t");
+  int i = watchAt(now);
+  if (i != -1) {
+    WatchEntry& w = watchPlan[i];
+    readRecord(w.day);
+    gridWake->SetCellBackgroundColour(2, w.col, wxColor(0, 255, 0));
+    gridWake->MakeCellVisible(0, w.col);
+
+    ActualWatch::active = true;
+    ActualWatch::day = w.day;
+    ActualWatch::col = w.col;
+    ActualWatch::time = w.time;
+    ActualWatch::start = w.start;
+    ActualWatch::end = w.end - wxTimeSpan(0, 0, 0, 1);
+    ActualWatch::member = w.member;
+
+    statusText(ALTERDAY);
+    return;
+  }
+
+  readRecord(1);
+  statusText(ALTERDAY);
+}
+
+static bool watchStartsBefore(const WatchEntry& a, const WatchEntry& b) {
+  return a.start < b.start;
+}
+
+static bool startsAfter(const wxDateTime& t, const WatchEntry& w) {
+  return t < w.start;
+}
+
+// Reads the watch list once into start/end instants sorted by start, so
+// finding the actual watch and the next change is a binary search.
+void CrewList::buildWatchPlan() {
+  watchPlan.clear();
+  watchChanges.clear();
+
+  int lineno = getDayOne(1);
+  unsigned int col = 0, daylast = 1;
+  while (lineno != -1 && lineno < (int)watchListFile->GetLineCount()) {
+    wxStringTokenizer tkz(watchListFile->GetLine(lineno++), "\t");
+    WatchEntry w;
+    long d;
     tkz.GetNextToken().ToLong(&d);
     if ((unsigned int)d != daylast) col = 0;
+    daylast = w.day = d;
+    w.col = col++;
 
     tkz.GetNextToken();
-
-    timedf = tkz.GetNextToken();
-    wxStringTokenizer tkzdf(timedf, ":");
-    long h, m;
+    wxStringTokenizer tkzdf(tkz.GetNextToken(), ":");
+    long h = 0, m = 0;
     tkzdf.GetNextToken().ToLong(&h);
     tkzdf.GetNextToken().ToLong(&m);
-    wxTimeSpan df(h, m);
-
-    date = tkz.GetNextToken();
-    getStartEndDate(date, dtstart, dtend);
+    w.time = wxTimeSpan(h, m);
 
-    ttmp = tkz.GetNextToken();
-    wxStringTokenizer timetkz(ttmp, ",");
-    time = timetkz.GetNextToken();
+    wxString date = tkz.GetNextToken();
+    wxStringTokenizer timetkz(tkz.GetNextToken(), ",");
+    wxString time = timetkz.GetNextToken();
     time += ":" + timetkz.GetNextToken();
 
-    dtstart = stringToDateTime(date, time, mode);
-    dtend = dtstart;
+    w.start = stringToDateTime(date, time, false);
+    if (!w.start.IsValid()) continue;
+    w.end = w.start + w.time;
+    w.member = dialog->restoreDangerChar(tkz.GetNextToken());
 
-    dtend.Add(df);
-    dtend.Subtract(ed);
-    //		wxMessageBox(dtstart.FormatDate()+"
-    //"+dtstart.FormatTime()+"\n"+now.FormatDate()+"
-    //"+now.FormatTime()+"\n"+dtend.FormatDate()+" "+dtend.FormatTime());
-    str = tkz.GetNextToken();
-    if (now.IsBetween(dtstart, dtend)) {
-      readRecord(d);
-      gridWake->SetCellBackgroundColour(2, col, wxColor(0, 255, 0));
-      gridWake->MakeCellVisible(0, col);
-
-      ActualWatch::active = true;
-      ActualWatch::day = d;
-      ActualWatch::col = col;
-      ActualWatch::time = df;
-      ActualWatch::start = dtstart;
-      ActualWatch::end = dtend;
-      ActualWatch::member = dialog->restoreDangerChar(str);
-
-      statusText(ALTERDAY);
-      return;
-    }
-    col++;
-    daylast = d;
-    lineno++;
+    watchPlan.push_back(w);
+    watchChanges.push_back(w.start);
+    watchChanges.push_back(w.end);
   }
 
-  if (watchListFile->GetLineCount() > 0) {
-    readRecord(1);
-    statusText(ALTERDAY);
-  } else
-    statusText(DEFAULTWATCH);
+  stable_sort(watchPlan.begin(), watchPlan.end(), watchStartsBefore);
+  sort(watchChanges.begin(), watchChanges.end());
+  watchChanges.erase(unique(watchChanges.begin(), watchChanges.end()),
+                     watchChanges.end());
+
+  if (dialog->scheduler) dialog->scheduler->reschedule();
+}
+
+int CrewList::watchAt(const wxDateTime& t) {
+  vector<WatchEntry>::iterator it =
+      upper_bound(watchPlan.begin(), watchPlan.end(), t, startsAfter);
+  if (it == watchPlan.begin()) return -1;
+  --it;
+  return (t < it->end) ? (int)(it - watchPlan.begin()) : -1;
+}
+
+wxDateTime CrewList::nextWatchChange(const wxDateTime& t) {
+  vector<wxDateTime>::iterator it =
+      upper_bound(watchChanges.begin(), watchChanges.end(), t);
+  return (it != watchChanges.end()) ? *it : wxInvalidDateTime;
 }
 
 void CrewList::statusText(int i) {
@@ -1608,6 +1644,7 @@ void CrewList::updateLine() {
       watchListFile->RemoveLine(lineno);
   }
   watchListFile->Write();
+  buildWatchPlan();
 }
 
 int CrewList::getDayOne(int dayone) {
@@ -1686,40 +1723,6 @@ bool CrewList::checkHourFormat(wxString s, int row, int col, wxDateTime* dt) {
   return true;
 }
 
-void CrewList::saveCSV(wxString path) {
-  wxString result;
-
-  saveData();
-
-  wxTextFile csvFile(path);
-
-  if (csvFile.Exists()) {
-    ::wxRemoveFile(path);
-    csvFile.Create();
-  }
-
-  crewListFile->Open();
-
-  for (unsigned int i = 0; i < crewListFile->GetLineCount(); i++) {
-    wxString line = crewListFile->GetLine(i);
-    wxStringTokenizer tkz(line, "\t", wxTOKEN_RET_EMPTY);
-
-    while (tkz.HasMoreTokens()) {
-      wxString s;
-      s += tkz.GetNextToken().RemoveLast();
-      s = dialog->restoreDangerChar(s);
-      result += "\"" + s + "\",";
-    }
-    result.RemoveLast();
-    csvFile.AddLine(result);
-    result = "";
-  }
-
-  csvFile.Write();
-  csvFile.Close();
-  crewListFile->Close();
-}
-
 void CrewList::saveHTML(wxString savePath, wxString layout, bool mode) {
   wxString path;
 
@@ -2539,153 +2542,48 @@ void CrewList::deleteRow(int row) {
   }
 }
 
-void CrewList::saveXML(wxString path) {
-  wxString s = "";
-  wxString line;
-  wxString temp;
-
-  wxTextFile* xmlFile = new wxTextFile(path);
-
-  if (xmlFile->Exists()) {
-    ::wxRemoveFile(path);
-    xmlFile->Create();
-  }
-
-  crewListFile->Open();
-
-  if (crewListFile->GetLineCount() <= 0) {
-    wxMessageBox(_("Sorry, Logbook has no lines"), _("Information"), wxOK);
-    return;
-  }
-
-  xmlFile->AddLine(dialog->xmlHead);
-  for (unsigned int i = 0; i < crewListFile->GetLineCount(); i++) {
-    line = crewListFile->GetLine(i);
-    wxStringTokenizer tkz(line, "\t", wxTOKEN_RET_EMPTY);
-    s = wxString::Format("<Row ss:Height=\"%u\">",
-                         dialog->m_gridGlobal->GetRowHeight(i));
-
-    while (tkz.HasMoreTokens()) {
-      s += "<Cell>\n";
-      s += "<Data ss:Type=\"String\">#DATA#</Data>\n";
-      temp = tkz.GetNextToken().RemoveLast();
-      temp.Replace("\\n", "&#10;");
-      temp.Replace("&", "&amp;");
-      temp.Replace("\"", "&quot;");
-      temp.Replace("<", "&lt;");
-      temp.Replace(">", "&gt;");
-      temp.Replace("'", "&apos;");
-      s.Replace("#DATA#", temp);
-      s += "</Cell>";
-    }
-    s += "</Row>>";
-    xmlFile->AddLine(s);
-  }
-
-  xmlFile->AddLine(dialog->xmlEnd);
-  xmlFile->Write();
-  crewListFile->Close();
-  xmlFile->Close();
-}
-
 void CrewList::backup(wxString path) { wxCopyFile(data_locn, path); }
 
 void CrewList::saveODS(wxString path) {
-  wxString s = "";
-  wxString line;
-  wxString temp;
-
-  wxFileInputStream input(data_locn);
-  wxTextInputStream* stream = new wxTextInputStream(input);
-
-  wxFFileOutputStream out(path);
-  wxZipOutputStream zip(out);
-  wxTextOutputStream txt(zip);
-  wxString sep(wxFileName::GetPathSeparator());
-
-  temp = dialog->content;
-  temp.Replace("table:number-columns-repeated=\"33\"",
-               "table:number-columns-repeated=\"14\"");
-  temp.Replace("Logbook", "CrewList");
-  zip.PutNextEntry("content.xml");
-  txt << temp;
-
-  txt << "<table:table-row table:style-name=\"ro2\">";
-
-  for (int i = 0; i < dialog->m_gridCrew->GetNumberCols(); i++) {
-    txt << "<table:table-cell office:value-type=\"string\">";
-    txt << "<text:p>";
-    txt << dialog->m_gridCrew->GetColLabelValue(i);
-    txt << "</text:p>";
-    txt << "</table:table-cell>";
-  }
-
-  txt << "</table:table-row>";
+  wxArrayString labels;
+  vector<ExportRecord> rows;
+  snapshot(labels, rows);
 
-  long emptyCol = 0;
+  unique_ptr<ExportSink> sink(odsSink(path));
+  if (!sink->begin(labels)) return;
+  for (size_t i = 0; i < rows.size(); i++) sink->write(rows[i]);
+  sink->end();
+}
 
-  while (input.Eof()) {
-    line = stream->ReadLine();
-    while (true) {
-      wxString line = stream->ReadLine();
-      if (input.Eof()) break;
-      txt << "<table:table-row table:style-name=\"ro2\">";
-      wxStringTokenizer tkz(line, "\t", wxTOKEN_RET_EMPTY);
+ExportSink* CrewList::odsSink(wxString path) {
+  vector<int> types(gridCrew->GetNumberCols(), ODSWriter::AUTO);
+  types[BIRTHDATE] = types[EST_ON] = ODSWriter::DATE;
+  return new ODSSink(path, LogbookDialog::datePattern, "CrewList", types);
+}
 
-      while (tkz.HasMoreTokens()) {
-        wxString s = dialog->restoreDangerChar(tkz.GetNextToken().RemoveLast());
-        if (s == "") {
-          txt << "<table:table-cell />";
-          emptyCol++;
-          continue;
-        }
+// read from the grid, so unsaved edits are exported without saving them
+void CrewList::snapshot(wxArrayString& labels, vector<ExportRecord>& rows) {
+  labels.Clear();
+  for (int i = 0; i < gridCrew->GetNumberCols(); i++)
+    labels.Add(gridCrew->GetColLabelValue(i));
 
-        txt << "<table:table-cell office:value-type=\"string\">";
-
-        wxStringTokenizer str(s, "\n");
-        while (str.HasMoreTokens()) {
-          wxString e = str.GetNextToken();
-          e.Replace("&", "&amp;");
-          e.Replace("\"", "&quot;");
-          e.Replace("<", "&lt;");
-          e.Replace(">", "&gt;");
-          e.Replace("'", "&apos;");
-          txt << "<text:p>";
-          txt << e;
-          txt << "</text:p>";
-        }
-        txt << "</table:table-cell>";
+  rows.clear();
+  for (int row = 0; row < gridCrew->GetNumberRows(); row++) {
+    ExportRecord r;
+    r.row = row;
+    r.height = gridCrew->GetRowHeight(row);
+    for (int c = 0; c < gridCrew->GetNumberCols(); c++) {
+      wxString s = gridCrew->GetCellValue(row, c);
+      // dates as shown follow the options, the sinks get them as ISO
+      if ((c == BIRTHDATE || c == EST_ON) && !s.IsEmpty() &&
+          s.GetChar(0) != ' ') {
+        wxDateTime dt;
+        if (dialog->myParseDate(s, dt)) s = dt.FormatISODate();
       }
-      txt << "</table:table-row>";
-      ;
+      r.cells.Add(s);
     }
+    rows.push_back(r);
   }
-  txt << dialog->contentEnd;
-
-  zip.PutNextEntry("mimetype");
-  txt << "application/vnd.oasis.opendocument.spreadsheet";
-
-  zip.PutNextEntry("styles.xml");
-  txt << dialog->styles;
-
-  zip.PutNextEntry("meta.xml");
-  txt << dialog->meta;
-
-  zip.PutNextEntry("META-INF" + sep + "manifest.xml");
-  txt << dialog->manifest;
-
-  zip.PutNextEntry("Thumbnails" + sep);
-
-  zip.PutNextEntry("Configurations2" + sep + "floater");
-  zip.PutNextEntry("Configurations2" + sep + "menubar");
-  zip.PutNextEntry("Configurations2" + sep + "popupmenu");
-  zip.PutNextEntry("Configurations2" + sep + "progressbar");
-  zip.PutNextEntry("Configurations2" + sep + "statusbar");
-  zip.PutNextEntry("Configurations2" + sep + "toolbar");
-  zip.PutNextEntry("Configurations2" + sep + "images" + sep + "Bitmaps");
-
-  zip.Close();
-  out.Close();
 }
 
 void LogbookDialog::OnGridBeginDragWatch(wxGridEvent& event) {
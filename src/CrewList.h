@@ -30,9 +30,13 @@
 #include <wx/tokenzr.h>
 #include "Options.h"
 
+#include <vector>
+
 #define CREWFIELDS 13
 
 class LogbookDialog;
+class ExportSink;
+struct ExportRecord;
 
 /////////////////////////////// holds actual Watch ///////////////
 class ActualWatch
@@ -47,6 +51,16 @@ public:
     static wxArrayString menuMembers;
 };
 
+/////////////////////////////// one watch of the plan ///////////////
+struct WatchEntry
+{
+    wxDateTime   start, end;     // end is the instant of the next change
+    unsigned int day;
+    int          col;
+    wxTimeSpan   time;
+    wxString     member;
+};
+
 class CrewList
 {
 public:
@@ -63,11 +77,11 @@ public:
     void addCrew( wxGrid* grid, wxGrid* wake );
     void changeCrew( wxGrid* grid, int row, int col, int offset );
     void changeCrewWake( wxGrid* grid, int row, int col, bool* toggle );
-    void saveCSV( wxString path );
     void saveHTML( wxString path,wxString layout, bool mode );
     void saveODT( wxString path,wxString layout, bool mode );
-    void saveXML( wxString path );
     void saveODS( wxString path );
+    ExportSink* odsSink( wxString path );
+    void snapshot( wxArrayString& labels, std::vector<ExportRecord>& rows );
     void backup( wxString path );
     void viewHTML( wxString path,wxString layout );
     void viewODT( wxString path,wxString layout );
@@ -84,7 +98,7 @@ public:
     void readRecord( int nr );
     void dayPlus();
     void dayMinus();
-    void dayNow( bool mode );
+    void dayNow();
     void dateTextCtrlClicked();
     void timeTextCtrlTextEntered( wxCommandEvent& event );
     void wakeMemberDrag( int row, int col );
@@ -106,6 +120,9 @@ public:
     void firstColumn();
     void statusText( int i );
     void flipWatches();
+    void buildWatchPlan();
+    int  watchAt( const wxDateTime& t );
+    wxDateTime nextWatchChange( const wxDateTime& t );
 
     LogbookDialog*	dialog;
     wxGrid*			gridCrew;
@@ -144,6 +161,10 @@ private:
     wxTextFile* watchListFile;
     int			linenoStart,linenoEnd;
 
+    // the watch list compiled into instants, rebuilt whenever it is written
+    std::vector<WatchEntry> watchPlan;
+    std::vector<wxDateTime> watchChanges;
+
     int			rowHeight;
     wxString	statustext[4];
 
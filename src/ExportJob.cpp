@@ -0,0 +1,173 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef WX_PRECOMP
+#include <wx/wx.h>
+#endif
+
+#include <wx/filename.h>
+
+#include "ExportJob.h"
+#include "LogbookDialog.h"
+
+using namespace std;
+
+ExportJob::ExportJob(LogbookDialog* d, ExportSink* s, const wxString& p,
+                     function<void(bool)> f)
+    : dialog(d), sink(s), path(p), done(f) {
+  nextChunk = written = 0;
+  flushing = cancelled = false;
+  finished = true;
+}
+
+ExportJob::~ExportJob() {
+  Stop();
+  if (!finished) {
+    cancel();
+    for (size_t i = 0; i < renderers.size(); i++) {
+      renderers[i]->Wait();
+      delete renderers[i];
+    }
+    sink->end();
+    wxRemoveFile(path);
+    showProgress(wxEmptyString);
+  }
+  delete sink;
+}
+
+// an empty text hides the export bar
+void ExportJob::showProgress(const wxString& text) {
+  dialog->exportText->SetLabel(text);
+  dialog->exportGauge->SetValue(0);
+  dialog->exportCancel->Enable();
+  dialog->exportBar->Show(!text.IsEmpty());
+  dialog->Layout();
+}
+
+bool ExportJob::start(const wxString& title, const wxArrayString& labels,
+                      vector<ExportRecord>& records) {
+  // the job owns the rows from here on
+  rows.swap(records);
+  if (!sink->begin(labels)) return false;
+
+  size_t n = (rows.size() + CHUNKROWS - 1) / CHUNKROWS;
+  chunks.assign(n, vector<wxString>());
+  ready.assign(n, false);
+  finished = false;
+
+  int threads = wxMin((int)n, wxThread::GetCPUCount());
+  for (int i = 0; i < threads; i++) {
+    Renderer* r = new Renderer(this);
+    if (r->Run() == wxTHREAD_NO_ERROR)
+      renderers.push_back(r);
+    else
+      delete r;
+  }
+  // no thread to be had, then it is done right here
+  if (renderers.empty()) render();
+
+  showProgress(title + ": " + wxFileName(path).GetFullName());
+  Start(100);
+  return true;
+}
+
+void ExportJob::cancel() {
+  wxMutexLocker locker(lock);
+  cancelled = true;
+}
+
+wxThread::ExitCode ExportJob::Renderer::Entry() {
+  job->render();
+  return (ExitCode)0;
+}
+
+void ExportJob::render() {
+  for (;;) {
+    size_t c;
+    {
+      wxMutexLocker locker(lock);
+      if (cancelled || nextChunk >= chunks.size()) return;
+      c = nextChunk++;
+    }
+
+    // row by row, the sink may treat a row on its own (ODS empty rows)
+    vector<wxString> text;
+    size_t last = wxMin(rows.size(), (c + 1) * (size_t)CHUNKROWS);
+    for (size_t row = c * CHUNKROWS; row < last; row++)
+      text.push_back(sink->render(rows[row]));
+
+    {
+      wxMutexLocker locker(lock);
+      chunks[c].swap(text);
+      ready[c] = true;
+    }
+    flush();
+  }
+}
+
+// appends the finished chunks in order, one thread at a time
+void ExportJob::flush() {
+  for (;;) {
+    vector<wxString> text;
+    {
+      wxMutexLocker locker(lock);
+      if (flushing || cancelled || written >= chunks.size() || !ready[written])
+        return;
+      flushing = true;
+      text.swap(chunks[written]);
+    }
+    for (size_t i = 0; i < text.size(); i++) sink->append(text[i]);
+    {
+      wxMutexLocker locker(lock);
+      written++;
+      flushing = false;
+    }
+  }
+}
+
+void ExportJob::Notify() {
+  size_t w, n = chunks.size();
+  bool stopped;
+  {
+    wxMutexLocker locker(lock);
+    w = written;
+    stopped = cancelled;
+  }
+
+  if (stopped) dialog->exportCancel->Disable();
+  dialog->exportGauge->SetValue(n ? (int)(w * 100 / n) : 100);
+  if (stopped || w >= n) finish();
+}
+
+void ExportJob::finish() {
+  Stop();
+  for (size_t i = 0; i < renderers.size(); i++) {
+    renderers[i]->Wait();
+    delete renderers[i];
+  }
+  renderers.clear();
+  rows.clear();
+
+  bool ok = sink->end() && !cancelled;
+  if (cancelled) wxRemoveFile(path);
+  finished = true;
+
+  showProgress(wxEmptyString);
+  if (done) done(ok);
+}
@@ -0,0 +1,94 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#ifndef _EXPORTJOB_H_
+#define _EXPORTJOB_H_
+
+#ifndef  WX_PRECOMP
+#include "wx/wx.h"
+#endif //precompiled headers
+
+#include <wx/thread.h>
+#include <wx/timer.h>
+
+#include <functional>
+#include <vector>
+
+#include "ExportPipeline.h"
+
+class LogbookDialog;
+
+/**
+ * An export that runs behind the dialog instead of in the button handler.
+ *
+ * start() takes the rows of a table snapshot, e.g. from the logbook grids
+ * through ExportPipeline, so the table may be edited while the job runs.
+ * The rows are cut into chunks of CHUNKROWS, rendered on one thread per
+ * core and appended to the sink in row order by whichever thread finishes
+ * the next chunk. The timer shows the progress in the export bar below
+ * the pages of the dialog, which stays usable; its Cancel stops the job
+ * and removes the half written file. done is called on the main thread
+ * with the outcome, e.g. to open the file with startApplication().
+ */
+class ExportJob : public wxTimer
+{
+public:
+    enum { CHUNKROWS = 500 };
+
+    ExportJob( LogbookDialog* d, ExportSink* s, const wxString& path,
+               std::function<void( bool )> done );
+    ~ExportJob();
+
+    bool      start( const wxString& title, const wxArrayString& labels,
+                     std::vector<ExportRecord>& records );
+    void      cancel();
+    bool      running() const { return !finished; }
+
+    virtual void Notify();
+
+private:
+    class Renderer : public wxThread
+    {
+    public:
+        Renderer( ExportJob* j ) : wxThread( wxTHREAD_JOINABLE ), job( j ) {}
+        virtual ExitCode Entry();
+        ExportJob* job;
+    };
+
+    void      render();
+    void      flush();
+    void      finish();
+    void      showProgress( const wxString& text );
+
+    LogbookDialog* dialog;
+    ExportSink*    sink;
+    wxString       path;
+    std::function<void( bool )> done;
+
+    std::vector<ExportRecord> rows;
+    std::vector<std::vector<wxString> > chunks;  // rendered rows
+    std::vector<bool>         ready;
+    std::vector<Renderer*>    renderers;
+
+    wxMutex   lock;
+    size_t    nextChunk, written;
+    bool      flushing, cancelled, finished;
+};
+#endif
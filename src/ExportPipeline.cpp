@@ -0,0 +1,155 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef WX_PRECOMP
+#include <wx/wx.h>
+#endif
+
+#include <wx/grid.h>
+#include <wx/tokenzr.h>
+
+#include "ExportPipeline.h"
+#include "LogbookDialog.h"
+#include "LogbookHTML.h"
+
+using namespace std;
+
+// ----------------------------------------------------------- pipeline
+
+ExportPipeline::Channel::Channel(ExportSink* s)
+    : wxThread(wxTHREAD_JOINABLE),
+      sink(s),
+      notEmpty(lock),
+      notFull(lock),
+      closed(false) {}
+
+void ExportPipeline::Channel::push(const ExportRecord& r) {
+  wxMutexLocker locker(lock);
+  while (queue.size() >= QUEUED) notFull.Wait();
+  queue.push_back(r);
+  notEmpty.Signal();
+}
+
+void ExportPipeline::Channel::close() {
+  wxMutexLocker locker(lock);
+  closed = true;
+  notEmpty.Signal();
+}
+
+wxThread::ExitCode ExportPipeline::Channel::Entry() {
+  for (;;) {
+    ExportRecord r;
+    {
+      wxMutexLocker locker(lock);
+      while (queue.empty() && !closed) notEmpty.Wait();
+      if (queue.empty()) break;
+      r = queue.front();
+      queue.pop_front();
+      notFull.Signal();
+    }
+    sink->write(r);
+  }
+  return (ExitCode)0;
+}
+
+ExportPipeline::ExportPipeline(LogbookDialog* d, bool t)
+    : parent(d), threaded(t) {}
+
+ExportPipeline::~ExportPipeline() {
+  for (size_t i = 0; i < sinks.size(); i++) delete sinks[i];
+}
+
+void ExportPipeline::add(ExportSink* sink) { sinks.push_back(sink); }
+
+void ExportPipeline::labels(LogbookDialog* d, wxArrayString& labels) {
+  labels.Clear();
+  for (int n = 0; n < d->numPages; n++)
+    for (int i = 0; i < d->logGrids[n]->GetNumberCols(); i++)
+      labels.Add(d->logGrids[n]->GetColLabelValue(i));
+}
+
+void ExportPipeline::read(LogbookDialog* d, int row, ExportRecord& r) {
+  r.row = row;
+  r.height = d->m_gridGlobal->GetRowHeight(row);
+  r.cells.Clear();
+  for (int grid = 0; grid < d->numPages; grid++)
+    for (int col = 0; col < d->logGrids[grid]->GetNumberCols(); col++)
+      r.cells.Add(d->logGrids[grid]->GetCellValue(row, col));
+
+  wxStringTokenizer p(r.cells[LogbookHTML::POSITION], "\n");
+  r.lat = p.GetNextToken();
+  r.lon = p.GetNextToken();
+}
+
+void ExportPipeline::table(wxGrid* grid, wxArrayString& labels,
+                           vector<ExportRecord>& rows) {
+  labels.Clear();
+  for (int col = 0; col < grid->GetNumberCols(); col++)
+    labels.Add(grid->GetColLabelValue(col));
+
+  rows.resize(grid->GetNumberRows());
+  for (int row = 0; row < grid->GetNumberRows(); row++) {
+    ExportRecord& r = rows[row];
+    r.row = row;
+    r.height = grid->GetRowHeight(row);
+    r.cells.Clear();
+    for (int col = 0; col < grid->GetNumberCols(); col++)
+      r.cells.Add(grid->GetCellValue(row, col));
+  }
+}
+
+bool ExportPipeline::run() {
+  wxArrayString head;
+  labels(parent, head);
+
+  // a sink that cannot open its file is left out
+  vector<ExportSink*> open;
+  for (size_t i = 0; i < sinks.size(); i++)
+    if (sinks[i]->begin(head)) open.push_back(sinks[i]);
+
+  // without a thread of its own a sink is written inline
+  vector<Channel*> channels;
+  vector<ExportSink*> direct;
+  for (size_t i = 0; i < open.size(); i++) {
+    Channel* c = threaded ? new Channel(open[i]) : NULL;
+    if (c && c->Run() == wxTHREAD_NO_ERROR)
+      channels.push_back(c);
+    else {
+      delete c;
+      direct.push_back(open[i]);
+    }
+  }
+
+  ExportRecord r;
+  for (int row = 0; row < parent->m_gridGlobal->GetNumberRows(); row++) {
+    read(parent, row, r);
+    for (size_t i = 0; i < channels.size(); i++) channels[i]->push(r);
+    for (size_t i = 0; i < direct.size(); i++) direct[i]->write(r);
+  }
+
+  for (size_t i = 0; i < channels.size(); i++) {
+    channels[i]->close();
+    channels[i]->Wait();
+    delete channels[i];
+  }
+
+  bool ok = open.size() == sinks.size();
+  for (size_t i = 0; i < open.size(); i++) ok = open[i]->end() && ok;
+  return ok;
+}
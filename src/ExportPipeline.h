@@ -0,0 +1,85 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#ifndef _EXPORTPIPELINE_H_
+#define _EXPORTPIPELINE_H_
+
+#ifndef  WX_PRECOMP
+#include "wx/wx.h"
+#endif //precompiled headers
+
+#include <wx/arrstr.h>
+#include <wx/thread.h>
+
+#include <deque>
+#include <vector>
+
+#include "ExportSink.h"
+
+class LogbookDialog;
+class wxGrid;
+
+/**
+ * Walks the logbook grids once and hands every row to each sink, so
+ * exporting to several formats costs one traversal. With threaded set
+ * every sink encodes on its own thread behind a queue of at most QUEUED
+ * rows; the traversal waits when a sink falls that far behind.
+ *
+ * HTML and ODT go through their layout files and KML through the tracks,
+ * they are not sinks.
+ */
+class ExportPipeline
+{
+public:
+    enum { QUEUED = 256 };
+
+    ExportPipeline( LogbookDialog* d, bool threaded );
+    ~ExportPipeline();
+
+    void      add( ExportSink* sink );
+    bool      run();
+
+    static void labels( LogbookDialog* d, wxArrayString& labels );
+    static void read( LogbookDialog* d, int row, ExportRecord& r );
+    static void table( wxGrid* grid, wxArrayString& labels,
+                       std::vector<ExportRecord>& rows );
+
+private:
+    class Channel : public wxThread
+    {
+    public:
+        Channel( ExportSink* s );
+        virtual ExitCode Entry();
+        void      push( const ExportRecord& r );
+        void      close();
+
+        ExportSink* sink;
+    private:
+        wxMutex   lock;
+        wxCondition notEmpty, notFull;
+        std::deque<ExportRecord> queue;
+        bool      closed;
+    };
+
+    LogbookDialog* parent;
+    bool      threaded;
+    std::vector<ExportSink*> sinks;
+};
+#endif
@@ -0,0 +1,174 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef WX_PRECOMP
+#include <wx/wx.h>
+#endif
+
+#include "ExportSink.h"
+#include "ExportTemplates.h"
+#include "LogbookFile.h"
+
+using namespace std;
+
+// a quote inside a field is doubled
+static wxString csvField(wxString s) {
+  s.Replace("\"", "\"\"");
+  return "\"" + s + "\",";
+}
+
+static wxString escapeXML(wxString s) {
+  s.Replace("&", "&amp;");
+  s.Replace("\"", "&quot;");
+  s.Replace("<", "&lt;");
+  s.Replace(">", "&gt;");
+  s.Replace("'", "&apos;");
+  return s;
+}
+
+// ---------------------------------------------------------------- CSV
+
+CSVSink::CSVSink(const wxString& p, bool s)
+    : path(p), split(s), output(NULL), csvFile(NULL) {}
+
+CSVSink::~CSVSink() {
+  delete csvFile;
+  delete output;
+}
+
+bool CSVSink::begin(const wxArrayString& labels) {
+  if (::wxFileExists(path)) ::wxRemoveFile(path);
+
+  output = new wxFileOutputStream(path);
+  if (!output->IsOk()) return false;
+  csvFile = new wxTextOutputStream(*output);
+
+  // the position is written as two columns
+  for (unsigned int i = 0; i < labels.Count(); i++) {
+    wxString str = csvField(labels[i]);
+    if (split && i == LogbookFile::POSITION) *csvFile << str;
+    *csvFile << str;
+  }
+  *csvFile << "\n";
+  return true;
+}
+
+wxString CSVSink::render(const ExportRecord& r) const {
+  wxString s;
+  for (unsigned int i = 0; i < r.cells.Count(); i++) {
+    if (split && i == LogbookFile::POSITION)
+      s += csvField(r.lat) + csvField(r.lon);
+    else
+      s += csvField(r.cells[i]);
+  }
+  s.RemoveLast();
+  return s + "\n";
+}
+
+void CSVSink::append(const wxString& text) {
+  if (csvFile) *csvFile << text;
+}
+
+bool CSVSink::end() { return output && output->Close(); }
+
+// ---------------------------------------------------------------- XML
+
+XMLSink::XMLSink(const wxString& p) : path(p), output(NULL), xmlFile(NULL) {}
+
+XMLSink::~XMLSink() {
+  delete xmlFile;
+  delete output;
+}
+
+bool XMLSink::begin(const wxArrayString& labels) {
+  if (::wxFileExists(path)) ::wxRemoveFile(path);
+
+  output = new wxFileOutputStream(path);
+  if (!output->IsOk()) return false;
+  xmlFile = new wxTextOutputStream(*output);
+
+  *xmlFile << ExportTemplates::xmlHead;
+  wxString s = "<Row>";
+  for (unsigned int i = 0; i < labels.Count(); i++) {
+    s += "<Cell>\n";
+    s += "<Data ss:Type=\"String\">" + labels[i] + "</Data>\n";
+    s += "</Cell>";
+  }
+  s += "</Row>>";
+  *xmlFile << s;
+  return true;
+}
+
+wxString XMLSink::render(const ExportRecord& r) const {
+  // rows read from a file have no height of their own
+  wxString s = r.height > 0
+                   ? wxString::Format("<Row ss:Height=\"%u\">", r.height)
+                   : wxString("<Row>");
+  for (unsigned int i = 0; i < r.cells.Count(); i++) {
+    // a "\n" in the cell becomes a line break in the cell
+    wxString temp = escapeXML(r.cells[i]);
+    temp.Replace("\\n", "&#xA;");
+    s += "<Cell>\n";
+    s += "<Data ss:Type=\"String\">" + temp + "</Data>\n";
+    s += "</Cell>";
+  }
+  s += "</Row>>";
+  return s;
+}
+
+void XMLSink::append(const wxString& text) {
+  if (xmlFile) *xmlFile << text;
+}
+
+bool XMLSink::end() {
+  if (!xmlFile) return false;
+  *xmlFile << ExportTemplates::xmlEnd;
+  return output->Close();
+}
+
+// ---------------------------------------------------------------- ODS
+
+ODSSink::ODSSink(const wxString& p, const wxString& pattern)
+    : path(p),
+      table("Logbook"),
+      ods(pattern),
+      types(LogbookFile::RTIME + 1, ODSWriter::AUTO) {
+  // date and time are the first columns of the first page
+  types[LogbookFile::RDATE] = ODSWriter::DATE;
+  types[LogbookFile::RTIME] = ODSWriter::TIME;
+}
+
+ODSSink::ODSSink(const wxString& p, const wxString& pattern, const wxString& t,
+                 const vector<int>& ty)
+    : path(p), table(t), ods(pattern), types(ty) {}
+
+bool ODSSink::begin(const wxArrayString& labels) {
+  if (!ods.open(path, table, labels.Count())) return false;
+  ods.header(labels);
+  return true;
+}
+
+wxString ODSSink::render(const ExportRecord& r) const {
+  return ods.render(r.cells, &types);
+}
+
+// empty rows come as empty text, row() collapses them
+void ODSSink::append(const wxString& text) { ods.row(text); }
+
+bool ODSSink::end() { return ods.close(); }
@@ -0,0 +1,120 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#ifndef _EXPORTSINK_H_
+#define _EXPORTSINK_H_
+
+#ifndef  WX_PRECOMP
+#include "wx/wx.h"
+#endif //precompiled headers
+
+#include <wx/arrstr.h>
+#include <wx/wfstream.h>
+#include <wx/txtstrm.h>
+
+#include <vector>
+
+#include "ODSWriter.h"
+
+/**
+ * One logbook row as read from the grids: the cells of all pages in page
+ * and column order, the position already split, and the row height. Rows
+ * of the other tables only fill the cells and the height.
+ */
+struct ExportRecord
+{
+    int           row;
+    int           height;
+    wxArrayString cells;
+    wxString      lat, lon;
+};
+
+/**
+ * A file format fed row by row. begin() and end() run on the thread of
+ * the pipeline, write() may run on a thread of its own. render() only
+ * looks at the record, so rows may be rendered on any number of threads
+ * as long as append() gets the text in row order, one row to a call.
+ */
+class ExportSink
+{
+public:
+    virtual ~ExportSink() {}
+    virtual bool      begin( const wxArrayString& labels ) = 0;
+    virtual wxString  render( const ExportRecord& r ) const = 0;
+    virtual void      append( const wxString& text ) = 0;
+    virtual bool      end() = 0;
+    void              write( const ExportRecord& r ) { append( render( r ) ); }
+};
+
+/**
+ * With split the logbook position column is written as latitude and
+ * longitude, the other tables are written cell by cell.
+ */
+class CSVSink : public ExportSink
+{
+public:
+    CSVSink( const wxString& path, bool split = true );
+    virtual ~CSVSink();
+    virtual bool      begin( const wxArrayString& labels );
+    virtual wxString  render( const ExportRecord& r ) const;
+    virtual void      append( const wxString& text );
+    virtual bool      end();
+
+private:
+    wxString      path;
+    bool          split;
+    wxFileOutputStream* output;
+    wxTextOutputStream* csvFile;
+};
+
+class XMLSink : public ExportSink
+{
+public:
+    XMLSink( const wxString& path );
+    virtual ~XMLSink();
+    virtual bool      begin( const wxArrayString& labels );
+    virtual wxString  render( const ExportRecord& r ) const;
+    virtual void      append( const wxString& text );
+    virtual bool      end();
+
+private:
+    wxString      path;
+    wxFileOutputStream* output;
+    wxTextOutputStream* xmlFile;
+};
+
+class ODSSink : public ExportSink
+{
+public:
+    ODSSink( const wxString& path, const wxString& datePattern );
+    ODSSink( const wxString& path, const wxString& datePattern,
+             const wxString& table, const std::vector<int>& types );
+    virtual bool      begin( const wxArrayString& labels );
+    virtual wxString  render( const ExportRecord& r ) const;
+    virtual void      append( const wxString& text );
+    virtual bool      end();
+
+private:
+    wxString      path;
+    wxString      table;
+    ODSWriter     ods;
+    std::vector<int> types;
+};
+#endif
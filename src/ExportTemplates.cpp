@@ -0,0 +1,257 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef WX_PRECOMP
+#include <wx/wx.h>
+#endif
+
+#include "ExportTemplates.h"
+
+// the ODS parts as the plugin always wrote them, ODSWriter fills in the
+// table name, the columns and a number style per unit
+const wxString ExportTemplates::content =
+    _T("<?xml version=\"1.0\" encoding=\"UTF-8\" ?>\
+<office:document-content xmlns:office=\"urn:oasis:names:tc:opendocument:xmlns:office:1.0\" xmlns:style=\"urn:oasis:names:tc:opendocument:xmlns:style:1.0\" xmlns:text=\"urn:oasis:names:tc:opendocument:xmlns:text:1.0\" xmlns:table=\"urn:oasis:names:tc:opendocument:xmlns:table:1.0\" xmlns:draw=\"urn:oasis:names:tc:opendocument:xmlns:drawing:1.0\" xmlns:fo=\"urn:oasis:names:tc:opendocument:xmlns:xsl-fo-compatible:1.0\" xmlns:xlink=\"http://www.w3.org/1999/xlink\" xmlns:dc=\"http://purl.org/dc/elements/1.1/\" xmlns:meta=\"urn:oasis:names:tc:opendocument:xmlns:meta:1.0\" xmlns:number=\"urn:oasis:names:tc:opendocument:xmlns:datastyle:1.0\" xmlns:presentation=\"urn:oasis:names:tc:opendocument:xmlns:presentation:1.0\" xmlns:svg=\"urn:oasis:names:tc:opendocument:xmlns:svg-compatible:1.0\" xmlns:chart=\"urn:oasis:names:tc:opendocument:xmlns:chart:1.0\" xmlns:dr3d=\"urn:oasis:names:tc:opendocument:xmlns:dr3d:1.0\" xmlns:math=\"http://www.w3.org/1998/Math/MathML\" xmlns:form=\"urn:oasis:names:tc:opendocument:xmlns:form:1.0\" xmlns:script=\"urn:oasis:names:tc:opendocument:xmlns:script:1.0\" xmlns:ooo=\"http://openoffice.org/2004/office\" xmlns:ooow=\"http://openoffice.org/2004/writer\" xmlns:oooc=\"http://openoffice.org/2004/calc\" xmlns:dom=\"http://www.w3.org/2001/xml-events\" xmlns:xforms=\"http://www.w3.org/2002/xforms\" xmlns:xsd=\"http://www.w3.org/2001/XMLSchema\" xmlns:xsi=\"http://www.w3.org/2001/XMLSchema-instance\" xmlns:rpt=\"http://openoffice.org/2005/report\" xmlns:of=\"urn:oasis:names:tc:opendocument:xmlns:of:1.2\" xmlns:xhtml=\"http://www.w3.org/1999/xhtml\" xmlns:grddl=\"http://www.w3.org/2003/g/data-view#\" xmlns:field=\"urn:openoffice:names:experimental:ooo-ms-interop:xmlns:field:1.0\" office:version=\"1.2\" grddl:transformation=\"http://docs.oasis-open.org/office/1.2/xslt/odf2rdf.xsl\">\
+<office:scripts />\
+<office:font-face-decls>\
+<style:font-face style:name=\"Arial\" svg:font-family=\"Arial\" style:font-family-generic=\"swiss\" style:font-pitch=\"variable\" />\
+<style:font-face style:name=\"Arial Unicode MS\" svg:font-family=\"'Arial Unicode MS'\" style:font-family-generic=\"system\" style:font-pitch=\"variable\" />\
+<style:font-face style:name=\"Mangal\" svg:font-family=\"Mangal\" style:font-family-generic=\"system\" style:font-pitch=\"variable\" />\
+<style:font-face style:name=\"Tahoma\" svg:font-family=\"Tahoma\" style:font-family-generic=\"system\" style:font-pitch=\"variable\" />\
+</office:font-face-decls>\
+<office:automatic-styles>\
+<style:style style:name=\"co1\" style:family=\"table-column\">\
+<style:table-column-properties fo:break-before=\"auto\" style:column-width=\"2.267cm\" />\
+</style:style>\
+<style:style style:name=\"ro2\" style:family=\"table-row\">\
+<style:table-row-properties style:row-height=\"0.453cm\" fo:break-before=\"auto\" style:use-optimal-row-height=\"true\" />\
+</style:style>\
+<style:style style:name=\"ro3\" style:family=\"table-row\">\
+<style:table-row-properties style:row-height=\"0.894cm\" fo:break-before=\"auto\" style:use-optimal-row-height=\"true\" />\
+</style:style>\
+<style:style style:name=\"ta1\" style:family=\"table\" style:master-page-name=\"Default\">\
+<style:table-properties table:display=\"true\" style:writing-mode=\"lr-tb\" />\
+</style:style>\
+<style:style style:name=\"ta_extref\" style:family=\"table\">\
+<style:table-properties table:display=\"false\" />\
+</style:style>\
+</office:automatic-styles>\
+<office:body>\
+<office:spreadsheet>\
+<table:table table:name=\"Logbook\" table:style-name=\"ta1\" table:print=\"false\">\
+<table:table-column table:style-name=\"co1\" table:number-columns-repeated=\"33\" table:default-cell-style-name=\"Default\" />\
+");
+
+const wxString ExportTemplates::contentEnd = _T(
+    "</table:table></office:spreadsheet></office:body></office:document-content>\
+ ");
+
+const wxString ExportTemplates::manifest =
+    _T("<?xml version=\"1.0\" encoding=\"UTF-8\" ?>\
+<manifest:manifest xmlns:manifest=\"urn:oasis:names:tc:opendocument:xmlns:manifest:1.0\">\
+<manifest:file-entry manifest:media-type=\"application/vnd.oasis.opendocument.spreadsheet\" manifest:version=\"1.2\" manifest:full-path=\"/\" />\
+<manifest:file-entry manifest:media-type=\"\" manifest:full-path=\"Configurations2/statusbar/\" />\
+<manifest:file-entry manifest:media-type=\"\" manifest:full-path=\"Configurations2/accelerator/current.xml\" />\
+<manifest:file-entry manifest:media-type=\"\" manifest:full-path=\"Configurations2/accelerator/\" />\
+<manifest:file-entry manifest:media-type=\"\" manifest:full-path=\"Configurations2/floater/\" />\
+<manifest:file-entry manifest:media-type=\"\" manifest:full-path=\"Configurations2/popupmenu/\" />\
+<manifest:file-entry manifest:media-type=\"\" manifest:full-path=\"Configurations2/progressbar/\" />\
+<manifest:file-entry manifest:media-type=\"\" manifest:full-path=\"Configurations2/menubar/\" />\
+<manifest:file-entry manifest:media-type=\"\" manifest:full-path=\"Configurations2/toolbar/\" />\
+<manifest:file-entry manifest:media-type=\"\" manifest:full-path=\"Configurations2/images/Bitmaps/\" />\
+<manifest:file-entry manifest:media-type=\"\" manifest:full-path=\"Configurations2/images/\" />\
+<manifest:file-entry manifest:media-type=\"application/vnd.sun.xml.ui.configuration\" manifest:full-path=\"Configurations2/\" />\
+<manifest:file-entry manifest:media-type=\"text/xml\" manifest:full-path=\"content.xml\" />\
+<manifest:file-entry manifest:media-type=\"text/xml\" manifest:full-path=\"styles.xml\" />\
+<manifest:file-entry manifest:media-type=\"text/xml\" manifest:full-path=\"meta.xml\" />\
+<manifest:file-entry manifest:media-type=\"\" manifest:full-path=\"Thumbnails/thumbnail.png\" />\
+<manifest:file-entry manifest:media-type=\"\" manifest:full-path=\"Thumbnails/\" />\
+<manifest:file-entry manifest:media-type=\"text/xml\" manifest:full-path=\"settings.xml\" />\
+</manifest:manifest>");
+
+const wxString ExportTemplates::styles =
+    _T("<?xml version=\"1.0\" encoding=\"UTF-8\" ?>\
+<office:document-styles xmlns:office=\"urn:oasis:names:tc:opendocument:xmlns:office:1.0\" xmlns:style=\"urn:oasis:names:tc:opendocument:xmlns:style:1.0\" xmlns:text=\"urn:oasis:names:tc:opendocument:xmlns:text:1.0\" xmlns:table=\"urn:oasis:names:tc:opendocument:xmlns:table:1.0\" xmlns:draw=\"urn:oasis:names:tc:opendocument:xmlns:drawing:1.0\" xmlns:fo=\"urn:oasis:names:tc:opendocument:xmlns:xsl-fo-compatible:1.0\" xmlns:xlink=\"http://www.w3.org/1999/xlink\" xmlns:dc=\"http://purl.org/dc/elements/1.1/\" xmlns:meta=\"urn:oasis:names:tc:opendocument:xmlns:meta:1.0\" xmlns:number=\"urn:oasis:names:tc:opendocument:xmlns:datastyle:1.0\" xmlns:presentation=\"urn:oasis:names:tc:opendocument:xmlns:presentation:1.0\" xmlns:svg=\"urn:oasis:names:tc:opendocument:xmlns:svg-compatible:1.0\" xmlns:chart=\"urn:oasis:names:tc:opendocument:xmlns:chart:1.0\" xmlns:dr3d=\"urn:oasis:names:tc:opendocument:xmlns:dr3d:1.0\" xmlns:math=\"http://www.w3.org/1998/Math/MathML\" xmlns:form=\"urn:oasis:names:tc:opendocument:xmlns:form:1.0\" xmlns:script=\"urn:oasis:names:tc:opendocument:xmlns:script:1.0\" xmlns:ooo=\"http://openoffice.org/2004/office\" xmlns:ooow=\"http://openoffice.org/2004/writer\" xmlns:oooc=\"http://openoffice.org/2004/calc\" xmlns:dom=\"http://www.w3.org/2001/xml-events\" xmlns:rpt=\"http://openoffice.org/2005/report\" xmlns:of=\"urn:oasis:names:tc:opendocument:xmlns:of:1.2\" xmlns:xhtml=\"http://www.w3.org/1999/xhtml\" xmlns:grddl=\"http://www.w3.org/2003/g/data-view#\" office:version=\"1.2\" grddl:transformation=\"http://docs.oasis-open.org/office/1.2/xslt/odf2rdf.xsl\">\
+<office:font-face-decls>\
+<style:font-face style:name=\"Arial\" svg:font-family=\"Arial\" style:font-family-generic=\"swiss\" style:font-pitch=\"variable\" />\
+<style:font-face style:name=\"Arial Unicode MS\" svg:font-family=\"'Arial Unicode MS'\" style:font-family-generic=\"system\" style:font-pitch=\"variable\" />\
+<style:font-face style:name=\"Mangal\" svg:font-family=\"Mangal\" style:font-family-generic=\"system\" style:font-pitch=\"variable\" />\
+<style:font-face style:name=\"Tahoma\" svg:font-family=\"Tahoma\" style:font-family-generic=\"system\" style:font-pitch=\"variable\" />\
+</office:font-face-decls>\
+<office:styles>\
+<style:default-style style:family=\"table-cell\">\
+<style:table-cell-properties style:decimal-places=\"2\" />\
+<style:paragraph-properties style:tab-stop-distance=\"1.25cm\" />\
+<style:text-properties style:font-name=\"Arial\" fo:language=\"de\" fo:country=\"DE\" style:font-name-asian=\"Arial Unicode MS\" style:language-asian=\"zh\" style:country-asian=\"CN\" style:font-name-complex=\"Tahoma\" style:language-complex=\"hi\" style:country-complex=\"IN\" />\
+</style:default-style>\
+<number:number-style style:name=\"N0\">\
+<number:number number:min-integer-digits=\"1\" /> \
+</number:number-style>\
+<number:currency-style style:name=\"N106P0\" style:volatile=\"true\">\
+<number:number number:decimal-places=\"2\" number:min-integer-digits=\"1\" number:grouping=\"true\" /> \
+<number:text />\
+<number:currency-symbol number:language=\"de\" number:country=\"DE\">€</number:currency-symbol>\
+</number:currency-style>\
+<number:currency-style style:name=\"N106\">\
+<style:text-properties fo:color=\"#ff0000\" />\
+<number:text>-</number:text>\
+<number:number number:decimal-places=\"2\" number:min-integer-digits=\"1\" number:grouping=\"true\" />\
+<number:text />\
+<number:currency-symbol number:language=\"de\" number:country=\"DE\">€</number:currency-symbol>\
+<style:map style:condition=\"value()>=0\" style:apply-style-name=\"N106P0\" />\
+</number:currency-style>\
+<style:style style:name=\"Default\" style:family=\"table-cell\">\
+<style:text-properties style:font-name-complex=\"Mangal\" />\
+</style:style>\
+<style:style style:name=\"Result\" style:family=\"table-cell\" style:parent-style-name=\"Default\">\
+<style:text-properties fo:font-style=\"italic\" style:text-underline-style=\"solid\" style:text-underline-width=\"auto\" style:text-underline-color=\"font-color\" fo:font-weight=\"bold\" />\
+</style:style>\
+<style:style style:name=\"Result2\" style:family=\"table-cell\" style:parent-style-name=\"Result\" style:data-style-name=\"N106\" />\
+<style:style style:name=\"Heading\" style:family=\"table-cell\" style:parent-style-name=\"Default\">\
+<style:table-cell-properties style:text-align-source=\"fix\" style:repeat-content=\"false\" />\
+<style:paragraph-properties fo:text-align=\"center\" />\
+<style:text-properties fo:font-size=\"16pt\" fo:font-style=\"italic\" fo:font-weight=\"bold\" />\
+</style:style>\
+<style:style style:name=\"Heading1\" style:family=\"table-cell\" style:parent-style-name=\"Heading\">\
+<style:table-cell-properties style:rotation-angle=\"90\" />\
+</style:style>\
+</office:styles>\
+<office:automatic-styles>\
+<style:page-layout style:name=\"Mpm1\">\
+<style:page-layout-properties style:writing-mode=\"lr-tb\" />\
+<style:header-style>\
+<style:header-footer-properties fo:min-height=\"0.751cm\" fo:margin-left=\"0cm\" fo:margin-right=\"0cm\" fo:margin-bottom=\"0.25cm\" />\
+</style:header-style>\
+<style:footer-style>\
+<style:header-footer-properties fo:min-height=\"0.751cm\" fo:margin-left=\"0cm\" fo:margin-right=\"0cm\" fo:margin-top=\"0.25cm\" />\
+</style:footer-style>\
+</style:page-layout>\
+<style:page-layout style:name=\"Mpm2\">\
+<style:page-layout-properties style:writing-mode=\"lr-tb\" />\
+<style:header-style>\
+<style:header-footer-properties fo:min-height=\"0.751cm\" fo:margin-left=\"0cm\" fo:margin-right=\"0cm\" fo:margin-bottom=\"0.25cm\" fo:border=\"0.088cm solid #000000\" fo:padding=\"0.018cm\"  fo:background-color=\"#c0c0c0\">\
+<style:background-image />\
+</style:header-footer-properties>\
+</style:header-style>\
+<style:footer-style>\
+<style:header-footer-properties fo:min-height=\"0.751cm\" fo:margin-left=\"0cm\" fo:margin-right=\"0cm\" fo:margin-top=\"0.25cm\" fo:border=\"0.088cm solid #000000\" fo:padding=\"0.018cm\" fo:background-color=\"#c0c0c0\">\
+<style:background-image />\
+</style:header-footer-properties>\
+</style:footer-style>\
+</style:page-layout>\
+</office:automatic-styles>\
+<office:master-styles>\
+<style:master-page style:name=\"Default\" style:page-layout-name=\"Mpm1\">\
+<style:header>\
+<text:p>\
+<text:sheet-name>p</text:sheet-name>\
+</text:p>\
+</style:header>\
+<style:header-left style:display=\"false\" />\
+<style:footer>\
+<text:p>\
+Seite\
+<text:page-number>1</text:page-number>\
+</text:p>\
+</style:footer>\
+<style:footer-left style:display=\"false\" />\
+</style:master-page>\
+<style:master-page style:name=\"Report\" style:page-layout-name=\"Mpm2\">\
+<style:header>\
+<style:region-left>\
+<text:p>\
+<text:sheet-name>p</text:sheet-name>(<text:title>p</text:title>)\
+</text:p>\
+</style:region-left>\
+<style:region-right>\
+<text:p>\
+<text:date style:data-style-name=\"N2\" text:date-value=\"2010-11-20\">20.11.2010</text:date>,<text:time>12:55:07</text:time>\
+</text:p>\
+</style:region-right>\
+</style:header>\
+<style:header-left style:display=\"false\" />\
+<style:footer>\
+<text:p>Seite <text:page-number>1</text:page-number>/<text:page-count>99</text:page-count>\
+</text:p>\
+</style:footer>\
+<style:footer-left style:display=\"false\" /> \
+</style:master-page>\
+</office:master-styles>\
+</office:document-styles>\
+");
+
+const wxString ExportTemplates::meta =
+    _T("<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\" ?>\
+<office:document-meta xmlns:office=\"urn:oasis:names:tc:opendocument:xmlns:office:1.0\" xmlns:meta=\"urn:oasis:names:tc:opendocument:xmlns:meta:1.0\" xmlns:dc=\"http://purl.org/dc/elements/1.1/\" xmlns:xlink=\"http://www.w3.org/1999/xlink\" office:version=\"1.1\">\
+<office:meta>\
+<meta:generator>OpenCPN-Logbook</meta:generator>\
+<dc:creator>OpenCPN</dc:creator>\
+<dc:date>2010-11-19T20:43:36Z</dc:date>\
+<meta:editing-duration>PT0S</meta:editing-duration>\
+</office:meta>\
+</office:document-meta>");
+
+const wxString ExportTemplates::xmlHead =
+    _T("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\
+<?mso-application progid=\"Excel.Sheet\"?>\
+<Workbook xmlns:c=\"urn:schemas-microsoft-com:office:component:spreadsheet\" xmlns:html=\"http://www.w3.org/TR/REC-html40\" xmlns:o=\"urn:schemas-microsoft-com:office:office\" xmlns:xsi=\"http://www.w3.org/2001/XMLSchema-instance\" xmlns=\"urn:schemas-microsoft-com:office:spreadsheet\" xmlns:x2=\"http://schemas.microsoft.com/office/excel/2003/xml\" xmlns:ss=\"urn:schemas-microsoft-com:office:spreadsheet\" xmlns:x=\"urn:schemas-microsoft-com:office:excel\">\
+<OfficeDocumentSettings xmlns=\"urn:schemas-microsoft-com:office:office\">\
+<Colors>\
+<Color>\
+<Index>3</Index>\
+<RGB>#c0c0c0</RGB>\
+</Color>\
+<Color>\
+<Index>4</Index>\
+<RGB>#ff0000</RGB>\
+</Color>\
+</Colors>\
+</OfficeDocumentSettings>\
+<ExcelWorkbook xmlns=\"urn:schemas-microsoft-com:office:excel\">\
+<WindowHeight>9000</WindowHeight>\
+<WindowWidth>13860</WindowWidth>\
+<WindowTopX>240</WindowTopX>\
+<WindowTopY>75</WindowTopY>\
+<ProtectStructure>False</ProtectStructure>\
+<ProtectWindows>False</ProtectWindows>\
+</ExcelWorkbook>\
+<Styles>\
+<Style ss:ID=\"Default\" ss:Name=\"Default\"/>\
+<Style ss:ID=\"Result\" ss:Name=\"Result\">\
+<Font ss:Bold=\"1\" ss:Italic=\"1\" ss:Underline=\"Single\"/>\
+</Style>\
+<Style ss:ID=\"Result2\" ss:Name=\"Result2\">\
+<Font ss:Bold=\"1\" ss:Italic=\"1\" ss:Underline=\"Single\"/>\
+<NumberFormat ss:Format=\"Euro Currency\"/>\
+</Style><Style ss:ID=\"Heading\" ss:Name=\"Heading\">\
+<Font ss:Bold=\"1\" ss:Italic=\"1\" ss:Size=\"16\"/>\
+</Style>\
+<Style ss:ID=\"Heading1\" ss:Name=\"Heading1\">\
+<Font ss:Bold=\"1\" ss:Italic=\"1\" ss:Size=\"16\"/>\
+</Style>\
+<Style ss:ID=\"co1\"/><Style ss:ID=\"ta1\"/><Style ss:ID=\"ta_extref\"/>\
+</Styles>\
+<ss:Worksheet ss:Name=\"Tabelle1\">\
+<Table ss:StyleID=\"ta1\">\
+<Column ss:Span=\"1\" ss:Width=\"64.2614\"/>");
+const wxString ExportTemplates::xmlEnd =
+    _T("</Table>\
+<x:WorksheetOptions/>\
+</ss:Worksheet>\
+</Workbook>");
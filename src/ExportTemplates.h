@@ -0,0 +1,44 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#ifndef _EXPORTTEMPLATES_H_
+#define _EXPORTTEMPLATES_H_
+
+#ifndef  WX_PRECOMP
+#include "wx/wx.h"
+#endif //precompiled headers
+
+/**
+ * The fixed parts of the ODS (content.xml, styles.xml, meta.xml and the
+ * manifest) and Excel XML files, kept apart from the dialog so
+ * logbook-cli writes the same files.
+ */
+class ExportTemplates
+{
+public:
+    static const wxString content;
+    static const wxString contentEnd;
+    static const wxString manifest;
+    static const wxString styles;
+    static const wxString meta;
+    static const wxString xmlHead;
+    static const wxString xmlEnd;
+};
+#endif
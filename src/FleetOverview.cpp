@@ -0,0 +1,173 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef WX_PRECOMP
+#include <wx/wx.h>
+#endif
+
+#include <wx/filename.h>
+#include <wx/textfile.h>
+
+#include "FleetOverview.h"
+#include "LogbookArchive.h"
+#include "LogbookFile.h"
+
+#include <functional>
+#include <string>
+
+using namespace std;
+
+// the name on the boat page, else that of the directory
+static wxString boatName(const wxString& dataDir) {
+  wxTextFile txt(dataDir + wxFileName::GetPathSeparator() + "boat.txt");
+  if (txt.Exists() && txt.Open())
+    for (size_t i = 0; i < txt.GetLineCount(); i++) {
+      if (txt[i].IsEmpty() || txt[i].StartsWith("#1.2#")) continue;
+      wxString name = LogbookFile::restore(txt[i].BeforeFirst('\t'));
+      if (!name.Trim().IsEmpty()) return name;
+      break;
+    }
+  wxFileName dn = wxFileName::DirName(dataDir);
+  return dn.GetDirCount() ? dn.GetDirs().Last() : dataDir;
+}
+
+void FleetOverview::add(wxJSONValue& sums, const wxJSONValue& more) {
+  wxArrayString keys = more.GetMemberNames();
+  for (unsigned int i = 0; i < keys.Count(); i++) {
+    wxJSONValue v = more.ItemAt(keys[i]);
+    wxJSONValue& s = sums[keys[i]];
+    // summaries read back from disk may give whole numbers as int
+    if (s.IsNull())
+      s = v;
+    else if (s.IsInt() && v.IsInt())
+      s = s.AsInt() + v.AsInt();
+    else
+      s = (s.IsInt() ? s.AsInt() : s.AsDouble()) +
+          (v.IsInt() ? v.AsInt() : v.AsDouble());
+  }
+}
+
+void FleetOverview::span(wxJSONValue& into, const wxJSONValue& from) {
+  wxString start = from.ItemAt("Start").AsString();
+  wxString end = from.ItemAt("End").AsString();
+  if (!start.IsEmpty() &&
+      (!into.HasMember("Start") || start < into["Start"].AsString()))
+    into["Start"] = start;
+  if (!end.IsEmpty() &&
+      (!into.HasMember("End") || end > into["End"].AsString()))
+    into["End"] = end;
+  into["Rows"] = into["Rows"].AsInt() + from.ItemAt("Rows").AsInt();
+}
+
+wxString FleetOverview::cachePath(const wxString& cacheDir,
+                                  const wxString& dataDir) {
+  if (cacheDir.IsEmpty()) return wxEmptyString;
+  wxFileName dn = wxFileName::DirName(dataDir);
+  dn.Normalize();
+  wxString name = dn.GetDirCount() ? dn.GetDirs().Last() : wxString("data");
+  size_t h = hash<string>()(string(dn.GetFullPath().ToUTF8()));
+  return wxString::Format("%s%c%s-%08lx", cacheDir,
+                          wxFileName::GetPathSeparator(), name,
+                          (unsigned long)h);
+}
+
+wxJSONValue FleetOverview::boat(const wxString& dataDir, bool logbooks,
+                                const wxString& cacheDir) {
+  wxJSONValue b;
+  b["Name"] = boatName(dataDir);
+  b["DataDir"] = dataDir;
+  b["Rows"] = 0;
+  b["Sums"] = wxJSONValue(wxJSONTYPE_OBJECT);
+
+  wxString cache = cachePath(cacheDir, dataDir);
+  wxArrayString files = LogbookFile::archives(dataDir);
+  files.Add(dataDir + wxFileName::GetPathSeparator() + "logbook.txt");
+  for (unsigned int i = 0; i < files.Count(); i++) {
+    if (!wxFileExists(files[i])) continue;
+
+    // the active logbook changes, archives keep their summary, the one
+    // beside them or else the one in the cache
+    wxJSONValue s;
+    bool archive = i + 1 < files.Count();
+    if (archive && !LogbookArchive::read(files[i], s) &&
+        (cache.IsEmpty() || !LogbookArchive::read(files[i], s, cache)) &&
+        !(LogbookArchive::build(files[i], cache) &&
+          LogbookArchive::read(files[i], s, cache)))
+      s = wxJSONValue();
+    if (!s.HasMember("Sums") && !LogbookArchive::compute(files[i], s))
+      continue;
+
+    add(b["Sums"], s["Sums"]);
+    span(b, s);
+    if (logbooks) {
+      wxJSONValue l;
+      l["File"] = wxFileName(files[i]).GetName();
+      l["Rows"] = s["Rows"];
+      l["Start"] = s["Start"];
+      l["End"] = s["End"];
+      l["Sums"] = s["Sums"];
+      b["Logbooks"].Append(l);
+    }
+  }
+  return b;
+}
+
+wxJSONValue FleetOverview::fleet(const wxArrayString& dataDirs, int drillDown,
+                                 int jobs, const wxString& cacheDir) {
+  vector<wxJSONValue> boats(dataDirs.Count());
+  if (jobs <= 0) jobs = wxThread::GetCPUCount();
+  if (jobs > (int)dataDirs.Count()) jobs = dataDirs.Count();
+
+  // boat i goes to worker i % jobs, every worker fills its own slots
+  vector<Worker*> workers;
+  for (int w = 0; w < jobs; w++) {
+    Worker* worker =
+        new Worker(dataDirs, boats, w, jobs, drillDown, cacheDir);
+    if (worker->Run() == wxTHREAD_NO_ERROR) {
+      workers.push_back(worker);
+      continue;
+    }
+    // no thread, do its share here
+    delete worker;
+    for (int i = w; i < (int)dataDirs.Count(); i += jobs)
+      boats[i] =
+          boat(dataDirs[i], drillDown == ALL || drillDown == i, cacheDir);
+  }
+  for (size_t w = 0; w < workers.size(); w++) {
+    workers[w]->Wait();
+    delete workers[w];
+  }
+
+  wxJSONValue f;
+  f["Rows"] = 0;
+  f["Sums"] = wxJSONValue(wxJSONTYPE_OBJECT);
+  f["Boats"] = wxJSONValue(wxJSONTYPE_ARRAY);
+  for (size_t i = 0; i < boats.size(); i++) {
+    add(f["Sums"], boats[i]["Sums"]);
+    span(f, boats[i]);
+    f["Boats"].Append(boats[i]);
+  }
+  return f;
+}
+
+wxThread::ExitCode FleetOverview::Worker::Entry() {
+  for (int i = first; i < (int)dirs.Count(); i += step)
+    result[i] = boat(dirs[i], drillDown == ALL || drillDown == i, cacheDir);
+  return (ExitCode)0;
+}
@@ -0,0 +1,80 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#ifndef _FLEETOVERVIEW_H_
+#define _FLEETOVERVIEW_H_
+
+#ifndef  WX_PRECOMP
+#include "wx/wx.h"
+#endif //precompiled headers
+
+#include <wx/arrstr.h>
+#include <wx/jsonval.h>
+#include <wx/thread.h>
+
+#include <vector>
+
+/**
+ * OverView totals over several data directories, one per boat.
+ *
+ *   { "Boats" : [ { "Name", "DataDir", "Rows", "Start", "End", "Sums",
+ *                   "Logbooks" : [ { "File", "Rows", "Start", "End",
+ *                                    "Sums" }, ... ] }, ... ],
+ *     "Rows", "Start", "End", "Sums" }
+ *
+ * "Sums" are those of LogbookArchive. Archives are taken from their
+ * summary, which is built once where missing, and only the active logbook
+ * is read. Boats are summed up on their own threads. "Logbooks" is filled
+ * in for the boat asked to drill down into, -1 for none, -2 for all.
+ *
+ * With a cacheDir the summaries missing in a data directory are built
+ * into <cacheDir>/<directory name>-<hash of its path> instead, so the
+ * data directories of other plugins are only read.
+ */
+class FleetOverview
+{
+public:
+    enum { NONE = -1, ALL = -2 };
+
+    static wxJSONValue boat( const wxString& dataDir, bool logbooks,
+                             const wxString& cacheDir = wxEmptyString );
+    static wxJSONValue fleet( const wxArrayString& dataDirs, int drillDown, int jobs = 0,
+                              const wxString& cacheDir = wxEmptyString );
+
+private:
+    static void     add( wxJSONValue& sums, const wxJSONValue& more );
+    static void     span( wxJSONValue& into, const wxJSONValue& from );
+    static wxString cachePath( const wxString& cacheDir, const wxString& dataDir );
+
+    class Worker : public wxThread
+    {
+    public:
+        Worker( const wxArrayString& d, std::vector<wxJSONValue>& r, int f, int s, int dd,
+                const wxString& c )
+            : wxThread( wxTHREAD_JOINABLE ), dirs( d ), result( r ), first( f ), step( s ),
+              drillDown( dd ), cacheDir( c ) {}
+        virtual ExitCode Entry();
+        const wxArrayString&      dirs;
+        std::vector<wxJSONValue>& result;
+        int       first, step, drillDown;
+        wxString  cacheDir;
+    };
+};
+#endif
@@ -0,0 +1,405 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef WX_PRECOMP
+#include <wx/wx.h>
+#endif
+
+#include <wx/datetime.h>
+#include <wx/file.h>
+#include <wx/filename.h>
+#include <wx/jsonwriter.h>
+#include <wx/mstream.h>
+#include <wx/textfile.h>
+#include <wx/tokenzr.h>
+#include <wx/zstream.h>
+
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+
+#include "InstrumentRecorder.h"
+#include "ocpn_plugin.h"
+
+using namespace std;
+
+#define CHUNKMS 60000      // a chunk covers about a minute
+#define CHUNKBYTES 16384   // or this much raw data
+#define HEADERSIZE 24
+#define INDEXSIZE 24
+
+// names are part of the plugin message API, never translate them
+static const char* channelNames[InstrumentRecorder::FIXEDCHANNELS] = {
+    "Latitude",          "Longitude",         "SOG",
+    "COG",               "STW",               "Heading",
+    "WindDirection",     "WindSpeed",         "WindAngleApparent",
+    "WindSpeedApparent", "Depth",             "RPM1",
+    "RPM2",              "Pressure",          "AirTemperature",
+    "WaterTemperature",  "Humidity"};
+
+// fixed point factor per channel, XDR channels use 100
+static const double scales[InstrumentRecorder::FIXEDCHANNELS] = {
+    1e6, 1e6, 100, 10, 100, 10, 10, 10, 10, 10, 100, 1, 1, 10, 100, 100, 10};
+
+static double scale(int channel) {
+  return (channel < InstrumentRecorder::FIXEDCHANNELS) ? scales[channel] : 100;
+}
+
+static void putVarint(string& s, unsigned long long v) {
+  while (v >= 0x80) {
+    s += (char)(v | 0x80);
+    v >>= 7;
+  }
+  s += (char)v;
+}
+
+static bool getVarint(const unsigned char*& p, const unsigned char* end,
+                      unsigned long long& v) {
+  v = 0;
+  for (int shift = 0; p < end && shift < 64; shift += 7) {
+    unsigned char b = *p++;
+    v |= (unsigned long long)(b & 0x7f) << shift;
+    if (!(b & 0x80)) return true;
+  }
+  return false;
+}
+
+static void putInt64(string& s, long long v) {
+  for (int i = 0; i < 8; i++) s += (char)((unsigned long long)v >> (8 * i));
+}
+
+static long long getInt64(const unsigned char* p) {
+  unsigned long long v = 0;
+  for (int i = 7; i >= 0; i--) v = (v << 8) | p[i];
+  return (long long)v;
+}
+
+InstrumentRecorder::InstrumentRecorder(wxString dataDir) {
+  path = dataDir + "instruments" + wxFileName::GetPathSeparator();
+  if (!wxDirExists(path)) wxMkdir(path);
+
+  wxTextFile chn(path + "instruments.chn");
+  if (chn.Exists() && chn.Open()) {
+    for (size_t i = 0; i < chn.GetLineCount(); i++) {
+      wxString line = chn[i];
+      long id;
+      if (line.BeforeFirst('\t').ToLong(&id) &&
+          id == XDRCHANNELS + (long)xdrNames.Count()) {
+        xdrChannels[line.AfterFirst('\t')] = (int)id;
+        xdrNames.Add(line.AfterFirst('\t'));
+      }
+    }
+    chn.Close();
+  }
+
+  records = 0;
+  writer = new Writer(this);
+  if (writer->Run() != wxTHREAD_NO_ERROR) {
+    delete writer;
+    writer = NULL;
+  }
+}
+
+InstrumentRecorder::~InstrumentRecorder() {
+  if (!writer) return;
+
+  sample stop;
+  stop.channel = -1;
+  queue.Post(stop);
+  writer->Wait();
+  delete writer;
+}
+
+void InstrumentRecorder::record(int channel, double value) {
+  if (!writer || channel < 0 || channel >= CHANNELS) return;
+
+  sample s;
+  s.time = wxGetUTCTimeMillis();
+  s.channel = channel;
+  s.value = value;
+  queue.Post(s);
+}
+
+// the channel of an XDR transducer, numbered on the first call
+int InstrumentRecorder::xdrChannel(const wxString& name) {
+  wxMutexLocker lock(names);
+  map<wxString, int>::iterator it = xdrChannels.find(name);
+  if (it != xdrChannels.end()) return it->second;
+  if (name.IsEmpty() || (int)xdrNames.Count() >= CHANNELS - XDRCHANNELS)
+    return -1;
+
+  int id = XDRCHANNELS + (int)xdrNames.Count();
+  xdrChannels[name] = id;
+  xdrNames.Add(name);
+
+  wxFile chn(path + "instruments.chn", wxFile::write_append);
+  if (chn.IsOpened()) chn.Write(wxString::Format("%i\t%s\n", id, name));
+  return id;
+}
+
+int InstrumentRecorder::channel(const wxString& name) {
+  for (int i = 0; i < FIXEDCHANNELS; i++)
+    if (name.CmpNoCase(channelNames[i]) == 0) return i;
+
+  wxMutexLocker lock(names);
+  wxString xdr = name.StartsWith("XDR:") ? name.Mid(4) : name;
+  map<wxString, int>::iterator it = xdrChannels.find(xdr);
+  return (it != xdrChannels.end()) ? it->second : -1;
+}
+
+wxString InstrumentRecorder::channelName(int channel) {
+  if (channel >= 0 && channel < FIXEDCHANNELS) return channelNames[channel];
+
+  wxMutexLocker lock(names);
+  if (channel >= XDRCHANNELS && channel - XDRCHANNELS < (int)xdrNames.Count())
+    return "XDR:" + xdrNames[channel - XDRCHANNELS];
+  return wxEmptyString;
+}
+
+wxThread::ExitCode InstrumentRecorder::Writer::Entry() {
+  sample s;
+  while (true) {
+    wxMessageQueueError e = recorder->queue.ReceiveTimeout(CHUNKMS, s);
+    if (e == wxMSGQUEUE_TIMEOUT) {
+      recorder->flush();  // nothing comes in, do not hold the data back
+      continue;
+    }
+    if (e != wxMSGQUEUE_NO_ERROR || s.channel < 0) break;
+
+    recorder->encode(s);
+    if ((s.time - recorder->chunkFirst).GetValue() >= CHUNKMS ||
+        recorder->buffer.size() >= CHUNKBYTES)
+      recorder->flush();
+  }
+  recorder->flush();
+  return (ExitCode)0;
+}
+
+void InstrumentRecorder::encode(const sample& s) {
+  if (records == 0) {
+    chunkFirst = lastTime = s.time;
+    memset(last, 0, sizeof(last));
+  }
+
+  // the clock was set back: keep the order, the sample gets the last time
+  long long dt = (s.time - lastTime).GetValue() / 10;
+  if (dt < 0) dt = 0;
+  lastTime += dt * 10;
+
+  long long v = llround(s.value * scale(s.channel));
+  long long delta = v - last[s.channel];
+  last[s.channel] = v;
+
+  putVarint(buffer, (unsigned long long)dt);
+  buffer += (char)s.channel;
+  putVarint(buffer, ((unsigned long long)delta << 1) ^
+                        (unsigned long long)(delta >> 63));
+  records++;
+}
+
+void InstrumentRecorder::flush() {
+  if (records == 0) return;
+
+  wxMemoryOutputStream mem;
+  {
+    wxZlibOutputStream zlib(mem, wxZ_BEST_SPEED, wxZLIB_ZLIB);
+    zlib.Write(buffer.data(), buffer.size());
+    zlib.Close();
+  }
+  size_t packed = mem.GetSize();
+
+  string header("LBR1");
+  putInt64(header, chunkFirst.GetValue());
+  putInt64(header, ((long long)packed << 32) | (unsigned int)buffer.size());
+  header.append(4, '\0');
+
+  wxFile bin(path + "instruments.bin", wxFile::write_append);
+  wxFile idx(path + "instruments.idx", wxFile::write_append);
+  if (bin.IsOpened() && idx.IsOpened()) {
+    long long offset = bin.Length();
+    string data(packed, '\0');
+    mem.CopyTo(&data[0], packed);
+    bin.Write(header.data(), header.size());
+    bin.Write(data.data(), data.size());
+    bin.Flush();
+
+    // the index entry goes last, readers never see a partial chunk
+    string entry;
+    putInt64(entry, chunkFirst.GetValue());
+    putInt64(entry, lastTime.GetValue());
+    putInt64(entry, offset);
+    idx.Write(entry.data(), entry.size());
+  }
+
+  buffer.clear();
+  records = 0;
+}
+
+bool InstrumentRecorder::readIndex(vector<chunkIndex>& index) {
+  wxFile idx(path + "instruments.idx");
+  if (!idx.IsOpened()) return false;
+
+  size_t n = (size_t)idx.Length() / INDEXSIZE;
+  string raw(n * INDEXSIZE, '\0');
+  if (n == 0 || idx.Read(&raw[0], raw.size()) != (ssize_t)raw.size())
+    return false;
+
+  index.resize(n);
+  const unsigned char* p = (const unsigned char*)raw.data();
+  for (size_t i = 0; i < n; i++, p += INDEXSIZE) {
+    index[i].first = getInt64(p);
+    index[i].last = getInt64(p + 8);
+    index[i].offset = getInt64(p + 16);
+  }
+  return true;
+}
+
+bool InstrumentRecorder::read(wxLongLong from, wxLongLong to,
+                              vector<sample>& out,
+                              const vector<int>& channels, size_t max) {
+  vector<chunkIndex> index;
+  if (!readIndex(index)) return false;
+
+  vector<bool> wanted(CHANNELS, channels.empty());
+  for (unsigned int i = 0; i < channels.size(); i++)
+    if (channels[i] >= 0 && channels[i] < CHANNELS) wanted[channels[i]] = true;
+
+  wxFile bin(path + "instruments.bin");
+  if (!bin.IsOpened()) return false;
+
+  // chunks are appended in time order, find the first one that ends in range
+  size_t lo = 0, hi = index.size();
+  while (lo < hi) {
+    size_t mid = (lo + hi) / 2;
+    if (index[mid].last < from)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  // with max set the chunk that passes it is the last one decoded
+  for (size_t i = lo; i < index.size() && index[i].first <= to &&
+                      (max == 0 || out.size() <= max);
+       i++)
+    if (!decode(bin, index[i], from, to, wanted, out)) return false;
+  return true;
+}
+
+bool InstrumentRecorder::decode(wxFile& file, const chunkIndex& c,
+                                wxLongLong from, wxLongLong to,
+                                const vector<bool>& wanted,
+                                vector<sample>& out) {
+  unsigned char header[HEADERSIZE];
+  if (file.Seek(c.offset.GetValue()) == wxInvalidOffset ||
+      file.Read(header, HEADERSIZE) != HEADERSIZE ||
+      memcmp(header, "LBR1", 4) != 0)
+    return false;
+
+  long long sizes = getInt64(header + 12);
+  size_t packed = (size_t)(sizes >> 32);
+  size_t size = (size_t)(sizes & 0xffffffff);
+
+  string data(packed, '\0');
+  if (file.Read(&data[0], packed) != (ssize_t)packed) return false;
+
+  wxMemoryInputStream mem(data.data(), packed);
+  wxZlibInputStream zlib(mem, wxZLIB_ZLIB);
+  string raw(size, '\0');
+  zlib.Read(&raw[0], size);
+  if (zlib.LastRead() != size) return false;
+
+  long long values[CHANNELS];
+  memset(values, 0, sizeof(values));
+  long long t = getInt64(header + 4);
+
+  const unsigned char* p = (const unsigned char*)raw.data();
+  const unsigned char* end = p + raw.size();
+  while (p < end) {
+    unsigned long long dt, zz;
+    if (!getVarint(p, end, dt) || p >= end) return false;
+    int ch = *p++;
+    if (!getVarint(p, end, zz)) return false;
+
+    t += (long long)dt * 10;
+    values[ch] += (long long)(zz >> 1) ^ -(long long)(zz & 1);
+    if (!wanted[ch] || t < from.GetValue() || t > to.GetValue()) continue;
+
+    sample s;
+    s.time = t;
+    s.channel = ch;
+    s.value = values[ch] / scale(ch);
+    out.push_back(s);
+  }
+  return true;
+}
+
+void InstrumentRecorder::range(wxJSONValue& request) {
+  wxDateTime dt;
+  wxLongLong from = 0, to = wxGetUTCTimeMillis();
+  if (request.HasMember("Start") &&
+      dt.ParseISOCombined(request["Start"].AsString(), 'T'))
+    from = dt.FromTimezone(wxDateTime::UTC).GetValue();
+  if (request.HasMember("End") &&
+      dt.ParseISOCombined(request["End"].AsString(), 'T'))
+    to = dt.FromTimezone(wxDateTime::UTC).GetValue();
+
+  vector<int> channels;
+  if (request.HasMember("Channels"))
+    for (int i = 0; i < request["Channels"].Size(); i++) {
+      int ch = channel(request["Channels"][i].AsString());
+      if (ch >= 0) channels.push_back(ch);
+    }
+
+  long limit = request.HasMember("Limit") ? request["Limit"].AsLong() : 0;
+  if (limit <= 0 || limit > MAXSAMPLES) limit = MAXSAMPLES;
+  int chunkSize =
+      request.HasMember("ChunkSize") ? request["ChunkSize"].AsInt() : 0;
+  if (chunkSize <= 0 || chunkSize > CHUNKSAMPLES) chunkSize = CHUNKSAMPLES;
+
+  vector<sample> samples;
+  read(from, to, samples, channels, limit + 1);
+  bool more = (long)samples.size() > limit;
+  if (more) samples.resize(limit);
+
+  // one time and one value array per channel, chunkSize samples a message
+  int chunk = 0;
+  size_t next = 0;
+  do {
+    wxJSONValue out;
+    if (request.HasMember("Id")) out["Id"] = request["Id"];
+    out["Chunk"] = chunk++;
+    wxJSONValue& result = out["Channels"];
+    size_t last = wxMin(samples.size(), next + chunkSize);
+    for (; next < last; next++) {
+      wxJSONValue& c = result[channelName(samples[next].channel)];
+      c["Time"].Append(samples[next].time.GetValue());
+      c["Value"].Append(samples[next].value);
+    }
+    out["Last"] = next >= samples.size();
+    if (next >= samples.size()) {
+      // with More set the range goes on after the last time sent
+      out["Samples"] = (int)samples.size();
+      out["More"] = more;
+    }
+
+    wxJSONWriter w(wxJSONWRITER_NONE);
+    wxString body;
+    w.Write(out, body);
+    SendPluginMessage("LOGBOOK_INSTRUMENTS_RANGE_RESPONSE", body);
+  } while (next < samples.size());
+}
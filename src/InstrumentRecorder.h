@@ -0,0 +1,117 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#ifndef _INSTRUMENTRECORDER_H_
+#define _INSTRUMENTRECORDER_H_
+
+#ifndef  WX_PRECOMP
+#include "wx/wx.h"
+#endif //precompiled headers
+
+#include <wx/jsonval.h>
+#include <wx/msgqueue.h>
+#include <wx/thread.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * Records decoded instrument values at full rate between log entries.
+ *
+ * instruments.bin is a sequence of independent chunks, each covering about
+ * a minute. A chunk holds one record per sample: time delta (10 ms units),
+ * channel and value delta as varints, the values in fixed point per
+ * channel. The payload is deflated. instruments.idx holds one fixed size
+ * entry per chunk (first/last time, offset) so a range read seeks straight
+ * to the first chunk it needs. XDR channels are numbered when xdrChannel()
+ * first sees their name and listed in instruments.chn.
+ *
+ * record() only queues the sample; encoding and writing happen in a
+ * background thread.
+ */
+class InstrumentRecorder
+{
+public:
+    enum channels {LATITUDE,LONGITUDE,SOG,COG,STW,HEADING,WINDDIR,WINDSPEED,
+                   WINDANGLEAPP,WINDSPEEDAPP,DEPTH,RPM1,RPM2,PRESSURE,
+                   AIRTEMP,WATERTEMP,HUMIDITY,FIXEDCHANNELS,XDRCHANNELS = 32,
+                   CHANNELS = 256};
+    // range() answers with at most MAXSAMPLES, CHUNKSAMPLES to a message
+    enum { MAXSAMPLES = 200000, CHUNKSAMPLES = 5000 };
+
+    struct sample
+    {
+        wxLongLong     time;   // ms since the epoch, UTC
+        int            channel;
+        double         value;
+    };
+
+    InstrumentRecorder( wxString dataDir );
+    ~InstrumentRecorder();
+
+    void      record( int channel, double value );
+    bool      read( wxLongLong from, wxLongLong to, std::vector<sample>& out,
+                    const std::vector<int>& channels, size_t max = 0 );
+
+    int       channel( const wxString& name );
+    int       xdrChannel( const wxString& name );
+    wxString  channelName( int channel );
+    void      range( wxJSONValue& request );
+
+private:
+    class Writer : public wxThread
+    {
+    public:
+        Writer( InstrumentRecorder* r ) : wxThread( wxTHREAD_JOINABLE ), recorder( r ) {}
+        virtual ExitCode Entry();
+        InstrumentRecorder* recorder;
+    };
+
+    struct chunkIndex
+    {
+        wxLongLong     first, last;
+        wxLongLong     offset;
+    };
+
+    void      encode( const sample& s );
+    void      flush();
+    bool      readIndex( std::vector<chunkIndex>& index );
+    bool      decode( wxFile& file, const chunkIndex& c, wxLongLong from,
+                      wxLongLong to, const std::vector<bool>& wanted,
+                      std::vector<sample>& out );
+
+    wxString  path;
+    wxMessageQueue<sample> queue;
+    Writer*   writer;
+
+    // XDR names are assigned in the GUI thread, read by the writer
+    wxMutex   names;
+    std::map<wxString,int> xdrChannels;
+    wxArrayString xdrNames;
+
+    // state of the chunk being written, writer thread only
+    std::string buffer;
+    wxLongLong chunkFirst;
+    wxLongLong lastTime;
+    long long last[CHANNELS];
+    int       records;
+};
+#endif
@@ -0,0 +1,137 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef WX_PRECOMP
+#include <wx/wx.h>
+#endif
+
+#include <math.h>
+
+#include "InstrumentStats.h"
+
+#define PI 3.14159265
+#define GUSTSECONDS 3.0
+
+InstrumentStats::InstrumentStats(bool c) {
+  circular = c;
+  reset();
+}
+
+void InstrumentStats::reset() {
+  count = 0;
+  first = last = 0;
+  value = min = max = 0;
+  shift = weight = sum = sumSq = sumSin = sumCos = 0;
+  smooth = peak = 0;
+}
+
+double InstrumentStats::now() {
+  return wxGetUTCTimeMillis().ToDouble() / 1000;
+}
+
+void InstrumentStats::add(double v) { add(v, now()); }
+
+void InstrumentStats::add(double v, double t) {
+  if (count == 0) {
+    first = last = t;
+    value = min = max = v;
+    shift = v;  // keeps the sums small, pressure is around 1000
+    smooth = peak = v;
+    count = 1;
+    return;
+  }
+
+  double dt = t - last;
+  close(t);
+
+  value = v;
+  if (v < min) min = v;
+  if (v > max) max = v;
+  count++;
+
+  if (!circular && dt > 0) {
+    smooth += (v - smooth) * (1 - exp(-dt / GUSTSECONDS));
+    if (smooth > peak) peak = smooth;
+  }
+}
+
+// the held value counts for the time until t
+void InstrumentStats::close(double t) {
+  double dt = t - last;
+  if (count == 0 || dt <= 0) return;
+
+  weight += dt;
+  if (circular) {
+    sumSin += sin(value * PI / 180) * dt;
+    sumCos += cos(value * PI / 180) * dt;
+  } else {
+    sum += (value - shift) * dt;
+    sumSq += (value - shift) * (value - shift) * dt;
+  }
+  last = t;
+}
+
+double InstrumentStats::mean() {
+  close(now());
+  if (weight <= 0) return value;
+
+  if (circular) {
+    double d = atan2(sumSin, sumCos) * 180 / PI;
+    return (d < 0) ? d + 360 : d;
+  }
+  return shift + sum / weight;
+}
+
+double InstrumentStats::stddev() {
+  close(now());
+  if (weight <= 0) return 0;
+
+  if (circular) {
+    double r = sqrt(sumSin * sumSin + sumCos * sumCos) / weight;
+    if (r >= 1) return 0;
+    if (r <= 0) return 180;
+    return sqrt(-2 * log(r)) * 180 / PI;
+  }
+  double m = sum / weight;
+  double var = sumSq / weight - m * m;
+  return (var > 0) ? sqrt(var) : 0;
+}
+
+double InstrumentStats::duration() {
+  close(now());
+  return last - first;
+}
+
+wxString InstrumentStats::format(const char* fmt) {
+  return wxString::Format(fmt, min, mean(), max);
+}
+
+wxJSONValue InstrumentStats::toJSON() {
+  wxJSONValue v;
+  v["Mean"] = mean();
+  v["StdDev"] = stddev();
+  if (!circular) {
+    v["Min"] = min;
+    v["Max"] = max;
+    v["Gust"] = peak;
+  }
+  v["Samples"] = (int)count;
+  v["Seconds"] = duration();
+  return v;
+}
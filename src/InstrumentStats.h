@@ -0,0 +1,79 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#ifndef _INSTRUMENTSTATS_H_
+#define _INSTRUMENTSTATS_H_
+
+#ifndef  WX_PRECOMP
+#include "wx/wx.h"
+#endif //precompiled headers
+
+#include <wx/jsonval.h>
+
+/**
+ * Statistics of one instrument over the current log interval, updated in
+ * constant time and memory per sample.
+ *
+ * Every value is held until the next one arrives, so the mean is weighted
+ * by time and a fast sender does not outweigh a slow one. Angles (wind
+ * direction, heading) are averaged as unit vectors; their min/max are not
+ * meaningful and the spread is the circular standard deviation.
+ *
+ * The gust is the highest value of a 3 second running mean, the usual
+ * definition for wind; for other instruments it is a smoothed peak.
+ */
+class InstrumentStats
+{
+public:
+    InstrumentStats( bool circular = false );
+
+    void     add( double value );
+    void     add( double value, double seconds );
+    void     reset();
+
+    bool     valid() const { return count > 0; }
+    long     samples() const { return count; }
+    double   mean();
+    double   minimum() const { return min; }
+    double   maximum() const { return max; }
+    double   stddev();
+    double   gust() const { return peak; }
+    double   duration();
+
+    wxString format( const char* fmt = "%03.1f|%03.1f|%03.1f" );
+    wxJSONValue toJSON();
+
+    static double now();
+
+private:
+    void     close( double t );
+
+    bool     circular;
+    long     count;
+    double   first, last;
+    double   value;
+    double   min, max;
+    double   shift;
+    double   weight;
+    double   sum, sumSq;
+    double   sumSin, sumCos;
+    double   smooth, peak;
+};
+#endif
@@ -51,6 +51,7 @@
 #include <wx/generic/gridctrl.h>
 #include <wx/grid.h>
 #include <wx/image.h>
+#include <wx/jsonwriter.h>
 #include <wx/msgdlg.h>
 #include <wx/object.h>
 #include <wx/stdpaths.h>
@@ -62,16 +63,24 @@
 
 
 #include "Logbook.h"
+#include "LogbookArchive.h"
 #include "LogbookDialog.h"
 #include "LogbookHTML.h"
 #include "LogbookOptions.h"
+#include "LogbookScheduler.h"
+#include "NMEAArbiter.h"
 #include "Options.h"
+#include "SealedLogbook.h"
+#include "Units.h"
+#include "VoyageView.h"
 #include "logbook_pi.h"
 #include "nmea0183/nmea0183.h"
 
 Logbook::Logbook(LogbookDialog* parent, wxString data, wxString layout,
                  wxString layoutODT)
-    : LogbookHTML(this, parent, data, layout) {
+    : LogbookHTML(this, parent, data, layout),
+      stHeading(true),
+      stWindDir(true) {
 #ifdef PBVE_DEBUG
   pbvecount = 0;
 #endif
@@ -94,11 +103,9 @@ Logbook::Logbook(LogbookDialog* parent, wxString data, wxString layout,
   dialog->backupFile = "logbook";
 
   wxFileName wxHomeFiledir = logData;
-  if (!wxHomeFiledir.FileExists()) {
-    logbookFile = new wxTextFile(logData);
-    logbookFile->Create();
-  } else
-    logbookFile = new wxTextFile(logData);
+  voyageView = NULL;
+  logbookFile = new wxTextFile(logData);
+  if (!wxHomeFiledir.FileExists()) logbookFile->Create();
 
   data_locn = logData;
   logbookData_actual = logData;
@@ -122,7 +129,7 @@ Logbook::Logbook(LogbookDialog* parent, wxString data, wxString layout,
   courseChange = false;
   everySM = false;
   guardChange = false;
-  dLastMinute = -1;
+  voyageEnded = false;
   oldPosition.latitude = 500;
   activeRoute = wxEmptyString;
   activeRouteGUID = wxEmptyString;
@@ -150,9 +157,22 @@ Logbook::Logbook(LogbookDialog* parent, wxString data, wxString layout,
   rpmSentence = false;
   sVolume = wxEmptyString;
   dVolume = 0;
+  recorder = opt->instrumentRecorder ? new InstrumentRecorder(data) : NULL;
+  arbiter.setPriority(opt->nmeaPriority, opt->nmeaFailover);
+  xdrChannels.configure(opt->xdrChannels, recorder);
+}
+
+Logbook::~Logbook(void) {
+  update();
+  delete recorder;
+  delete voyageView;
+  delete logbookFile;
 }
 
-Logbook::~Logbook(void) { update(); }
+void Logbook::setLogbookFile(const wxString& path) {
+  delete logbookFile;
+  logbookFile = new wxTextFile(path);
+}
 
 void Logbook::setTrackToNewID(wxString target) {
   if (mergeList.Count() == 0) return;
@@ -161,6 +181,13 @@ void Logbook::setTrackToNewID(wxString target) {
   wxArrayString files;
   dir.GetAllFiles(parent->data, &files, "until*.txt", wxDIR_FILES);
 
+  // sealed archives are rewritten as text and sealed again
+  wxArrayString sealed;
+  dir.GetAllFiles(parent->data, &sealed, "until*.lbz", wxDIR_FILES);
+  for (unsigned int i = 0; i < sealed.Count(); i++)
+    if (SealedLogbook::unseal(sealed[i]))
+      files.Add(SealedLogbook::textPath(sealed[i]));
+
   for (unsigned int i = 0; i < files.Count(); i++) {
     wxFileInputStream file(files[i]);
     wxTextInputStream txt(file);
@@ -176,6 +203,9 @@ void Logbook::setTrackToNewID(wxString target) {
     txto << data;
     fileo.Close();
   }
+
+  for (unsigned int i = 0; i < sealed.Count(); i++)
+    SealedLogbook::seal(SealedLogbook::textPath(sealed[i]));
 }
 
 void Logbook::setLayoutLocation(wxString loc) {
@@ -196,38 +226,42 @@ void Logbook::setLayoutLocation(wxString loc) {
 }
 
 void Logbook::SetPosition(PlugIn_Position_Fix& pfix) {
-  if (opt->traditional)
-    sLat = this->toSDMM(1, pfix.Lat, true);
-  else
-    sLat = this->toSDMMOpenCPN(1, pfix.Lat, true);
+  // OpenCPN's fix competes with the NMEA talkers for position and course
+  int owned = arbiter.acceptFix(pfix.FixTime != 0, InstrumentStats::now());
 
-  if (opt->traditional)
-    sLon = this->toSDMM(2, pfix.Lon, true);
-  else
-    sLon = this->toSDMMOpenCPN(2, pfix.Lon, true);
+  if (owned & NMEAArbiter::bit(NMEAArbiter::POSITION)) {
+    if (opt->traditional)
+      sLat = this->toSDMM(1, pfix.Lat, true);
+    else
+      sLat = this->toSDMMOpenCPN(1, pfix.Lat, true);
 
-  if (pfix.FixTime != 0) {
-    double factor = 1;
-    double tspeed = 1;
+    if (opt->traditional)
+      sLon = this->toSDMM(2, pfix.Lon, true);
+    else
+      sLon = this->toSDMMOpenCPN(2, pfix.Lon, true);
 
-    switch (opt->showBoatSpeedchoice) {
-      case 0:
-        factor = 1;
-        break;
-      case 1:
-        factor = 0.51444;
-        break;
-      case 2:
-        factor = 1.852;
-        break;
+    if (recorder) {
+      recorder->record(InstrumentRecorder::LATITUDE, pfix.Lat);
+      recorder->record(InstrumentRecorder::LONGITUDE, pfix.Lon);
     }
+  }
 
-    tspeed = pfix.Sog * factor;
+  if (owned & NMEAArbiter::bit(NMEAArbiter::COURSE)) {
+    double tspeed =
+        Units::fromBase(Units::SPEED, opt->showBoatSpeedchoice, pfix.Sog);
 
     sSOG = wxString::Format("%5.2f %s", tspeed, opt->showBoatSpeed.c_str());
+    stSOG.add(tspeed);
+    if (recorder) {
+      recorder->record(InstrumentRecorder::SOG, pfix.Sog);
+      recorder->record(InstrumentRecorder::COG, pfix.Cog);
+    }
     sCOG = wxString::Format("%5.2f %s", pfix.Cog, opt->Deg.c_str());
+  }
+
+  if (pfix.FixTime != 0)
     SetGPSStatus(true);
-  } else
+  else
     SetGPSStatus(false);
 
   mUTCDateTime.Set(pfix.FixTime);
@@ -241,6 +275,10 @@ void Logbook::SetSentence(wxString& sentence) {
   onOff[0] = _(" off");
   onOff[1] = _(" on");
 
+  // duplicates and talkers that lost their data are not parsed
+  int owned = arbiter.accept(sentence, InstrumentStats::now());
+  if (!owned) return;
+
   m_NMEA0183 << sentence;
 
 #ifdef PBVE_DEBUG
@@ -291,6 +329,8 @@ void Logbook::SetSentence(wxString& sentence) {
           sCOW = wxString::Format("%5.2f%s", m_NMEA0183.Hdt.DegreesTrue,
                                   opt->Deg.c_str());
         dCOW = m_NMEA0183.Hdt.DegreesTrue;
+        stHeading.add(dCOW);
+        if (recorder) recorder->record(InstrumentRecorder::HEADING, dCOW);
         bCOW = true;
         dtCOW = wxDateTime::Now();
       }
@@ -300,6 +340,8 @@ void Logbook::SetSentence(wxString& sentence) {
           sCOW = wxString::Format("%5.2f%s", m_NMEA0183.Hdm.DegreesMagnetic,
                                   opt->Deg.c_str());
         dCOW = m_NMEA0183.Hdm.DegreesMagnetic;
+        stHeading.add(dCOW);
+        if (recorder) recorder->record(InstrumentRecorder::HEADING, dCOW);
         bCOW = true;
         dtCOW = wxDateTime::Now();
       }
@@ -318,6 +360,8 @@ void Logbook::SetSentence(wxString& sentence) {
                                   opt->Deg.c_str());
           dCOW = m_NMEA0183.Hdg.MagneticSensorHeadingDegrees;
         }
+        stHeading.add(dCOW);
+        if (recorder) recorder->record(InstrumentRecorder::HEADING, dCOW);
         bCOW = true;
         dtCOW = wxDateTime::Now();
       }
@@ -335,32 +379,26 @@ void Logbook::SetSentence(wxString& sentence) {
       }
     } else if (m_NMEA0183.LastSentenceIDReceived == "RMC") {
       if (m_NMEA0183.Parse()) {
-        double factor = 1;
         double tboatspeed = 1;
         if (m_NMEA0183.Rmc.IsDataValid == NTrue) {
           SetGPSStatus(true);
-          setPositionString(m_NMEA0183.Rmc.Position.Latitude.Latitude,
-                            m_NMEA0183.Rmc.Position.Latitude.Northing,
-                            m_NMEA0183.Rmc.Position.Longitude.Longitude,
-                            m_NMEA0183.Rmc.Position.Longitude.Easting);
-
-          if (m_NMEA0183.Rmc.SpeedOverGroundKnots != 999.0)
-            switch (opt->showBoatSpeedchoice) {
-              case 0:
-                factor = 1;
-                break;
-              case 1:
-                factor = 0.51444;
-                break;
-              case 2:
-                factor = 1.852;
-                break;
-            }
-
-          tboatspeed = m_NMEA0183.Rmc.SpeedOverGroundKnots * factor;
+          // another talker may own the position, RMC still brings the rest
+          if (owned & NMEAArbiter::bit(NMEAArbiter::POSITION))
+            setPositionString(m_NMEA0183.Rmc.Position.Latitude.Latitude,
+                              m_NMEA0183.Rmc.Position.Latitude.Northing,
+                              m_NMEA0183.Rmc.Position.Longitude.Longitude,
+                              m_NMEA0183.Rmc.Position.Longitude.Easting);
+        }
+        if (m_NMEA0183.Rmc.IsDataValid == NTrue &&
+            (owned & NMEAArbiter::bit(NMEAArbiter::COURSE))) {
+          tboatspeed = m_NMEA0183.Rmc.SpeedOverGroundKnots;
+          if (tboatspeed != 999.0)
+            tboatspeed = Units::fromBase(Units::SPEED,
+                                         opt->showBoatSpeedchoice, tboatspeed);
 
           sSOG = wxString::Format("%5.2f %s", tboatspeed,
                                   opt->showBoatSpeed.c_str());
+          stSOG.add(tboatspeed);
 
           if (m_NMEA0183.Rmc.TrackMadeGoodDegreesTrue != 999.0)
             sCOG = wxString::Format("%5.2f%s",
@@ -369,6 +407,11 @@ void Logbook::SetSentence(wxString& sentence) {
           if (m_NMEA0183.Rmc.TrackMadeGoodDegreesTrue != 999.0)
             dCOG = m_NMEA0183.Rmc.TrackMadeGoodDegreesTrue;
 
+          if (!dialog->logbookPlugIn->eventsEnabled && opt->courseChange)
+            checkCourseChanged();
+        }
+        if (m_NMEA0183.Rmc.IsDataValid == NTrue &&
+            (owned & NMEAArbiter::bit(NMEAArbiter::TIME))) {
           long day, month, year;
           m_NMEA0183.Rmc.Date.SubString(0, 1).ToLong(&day);
           m_NMEA0183.Rmc.Date.SubString(2, 3).ToLong(&month);
@@ -380,67 +423,34 @@ void Logbook::SetSentence(wxString& sentence) {
           dt.ParseFormat(m_NMEA0183.Rmc.UTCTime, "%H%M%S");
 
           setDateTimeString(dt);
-
-          if (!dialog->logbookPlugIn->eventsEnabled && opt->courseChange)
-            checkCourseChanged();
         }
       }
     } else if (m_NMEA0183.LastSentenceIDReceived == "VHW") {
       if (m_NMEA0183.Parse()) {
-        double factor = 1;
-        double tboatspeed = 1;
-        if (m_NMEA0183.Vhw.Knots != 999.0) {
-          switch (opt->showBoatSpeedchoice) {
-            case 0:
-              factor = 1;
-              break;
-            case 1:
-              factor = 0.51444;
-              break;
-            case 2:
-              factor = 1.852;
-              break;
-          }
-        }
-        tboatspeed = m_NMEA0183.Vhw.Knots * factor;
+        double tboatspeed = m_NMEA0183.Vhw.Knots;
+        if (tboatspeed != 999.0)
+          tboatspeed = Units::fromBase(Units::SPEED, opt->showBoatSpeedchoice,
+                                       tboatspeed);
 
         sSOW = wxString::Format("%5.2f %s", tboatspeed,
                                 opt->showBoatSpeed.c_str());
         dtSOW = wxDateTime::Now();
         bSOW = true;
+        stSTW.add(tboatspeed);
+        if (recorder)
+          recorder->record(InstrumentRecorder::STW, m_NMEA0183.Vhw.Knots);
       }
     } else if (m_NMEA0183.LastSentenceIDReceived == "MWV") {
       if (m_NMEA0183.Parse()) {
         double dWind = 0;
-        double factor = 1, twindspeed = 1;
+        int unit = Units::speed(m_NMEA0183.Mwv.WindSpeedUnits);
+        double twindspeed =
+            Units::convert(Units::SPEED, unit, opt->showWindSpeedchoice,
+                           m_NMEA0183.Mwv.WindSpeed);
 
-        switch (opt->showWindSpeedchoice) {
-          case 0:
-            if (m_NMEA0183.Mwv.WindSpeedUnits == 'N')
-              factor = 1;
-            else if (m_NMEA0183.Mwv.WindSpeedUnits == 'M')
-              factor = 1.94384;
-            else if (m_NMEA0183.Mwv.WindSpeedUnits == 'K')
-              factor = 0.53995;
-            break;
-          case 1:
-            if (m_NMEA0183.Mwv.WindSpeedUnits == 'N')
-              factor = 0.51444;
-            else if (m_NMEA0183.Mwv.WindSpeedUnits == 'M')
-              factor = 1;
-            else if (m_NMEA0183.Mwv.WindSpeedUnits == 'K')
-              factor = 0.27777;
-            break;
-          case 2:
-            if (m_NMEA0183.Mwv.WindSpeedUnits == 'N')
-              factor = 1.852;
-            else if (m_NMEA0183.Mwv.WindSpeedUnits == 'M')
-              factor = 3.6;
-            else if (m_NMEA0183.Mwv.WindSpeedUnits == 'K')
-              factor = 1;
-            break;
-        }
-        twindspeed = m_NMEA0183.Mwv.WindSpeed * factor;
+        // the recorder keeps knots whatever the display unit
+        double knots =
+            Units::toBase(Units::SPEED, unit, m_NMEA0183.Mwv.WindSpeed);
 
         if (m_NMEA0183.Mwv.Reference == "T") {
           if (opt->showWindHeading && bCOW) {
@@ -456,11 +466,12 @@ void Logbook::SetSentence(wxString& sentence) {
                                          opt->showWindSpeed.c_str());
           dtWindT = wxDateTime::Now();
           bWindT = true;
-          if (minwindT > twindspeed) minwindT = twindspeed;
-          if (maxwindT < twindspeed) maxwindT = twindspeed;
-          avgwindT = (avgwindT + twindspeed) / 2;
-          swindspeedsT = wxString::Format("%03.1f|%03.1f|%03.1f", minwindT,
-                                          avgwindT, maxwindT);
+          stWindSpeed.add(twindspeed);
+          stWindDir.add(dWind);
+          if (recorder) {
+            recorder->record(InstrumentRecorder::WINDDIR, dWind);
+            recorder->record(InstrumentRecorder::WINDSPEED, knots);
+          }
         } else {
           dWind = m_NMEA0183.Mwv.WindAngle;
           sWindA = wxString::Format("%3.0f%s", dWind, opt->Deg.c_str());
@@ -468,11 +479,11 @@ void Logbook::SetSentence(wxString& sentence) {
                                          opt->showWindSpeed.c_str());
           dtWindA = wxDateTime::Now();
           bWindA = true;
-          if (minwindA > twindspeed) minwindA = twindspeed;
-          if (maxwindA < twindspeed) maxwindA = twindspeed;
-          avgwindA = (avgwindA + twindspeed) / 2;
-          swindspeedsA = wxString::Format("%03.1f|%03.1f|%03.1f", minwindA,
-                                          avgwindA, maxwindA);
+          stWindSpeedA.add(twindspeed);
+          if (recorder) {
+            recorder->record(InstrumentRecorder::WINDANGLEAPP, dWind);
+            recorder->record(InstrumentRecorder::WINDSPEEDAPP, knots);
+          }
         }
       }
     } else if (m_NMEA0183.LastSentenceIDReceived == "VWT") {
@@ -493,30 +504,21 @@ void Logbook::SetSentence(wxString& sentence) {
 
         sWindT = wxString::Format("%3.0f%s", dWind, opt->Deg.c_str());
 
-        double factor, twindspeed;
-
-        switch (opt->showWindSpeedchoice) {
-          case 0:
-            factor = 1;
-            break;
-          case 1:
-            factor = 0.51444;
-            break;
-          case 2:
-            factor = 1.852;
-            break;
-        }
-        twindspeed = m_NMEA0183.Vwt.WindSpeedKnots * factor;
+        double twindspeed =
+            Units::fromBase(Units::SPEED, opt->showWindSpeedchoice,
+                            m_NMEA0183.Vwt.WindSpeedKnots);
 
         sWindSpeedT = wxString::Format("%3.1f %s", twindspeed,
                                        opt->showWindSpeed.c_str());
         dtWindT = wxDateTime::Now();
         bWindT = true;
-        if (minwindT > twindspeed) minwindT = twindspeed;
-        if (maxwindT < twindspeed) maxwindT = twindspeed;
-        avgwindT = (avgwindT + twindspeed) / 2;
-        swindspeedsT = wxString::Format("%03.1f|%03.1f|%03.1f", minwindT,
-                                        avgwindT, maxwindT);
+        stWindSpeed.add(twindspeed);
+        stWindDir.add(dWind);
+        if (recorder) {
+          recorder->record(InstrumentRecorder::WINDDIR, dWind);
+          recorder->record(InstrumentRecorder::WINDSPEED,
+                           m_NMEA0183.Vwt.WindSpeedKnots);
+        }
       }
     } else if (m_NMEA0183.LastSentenceIDReceived == "VWR") {
       if (m_NMEA0183.Parse()) {
@@ -529,42 +531,33 @@ void Logbook::SetSentence(wxString& sentence) {
 
         sWindA = wxString::Format("%3.0f%s", dWind, opt->Deg.c_str());
 
-        double factor, twindspeed;
-
-        switch (opt->showWindSpeedchoice) {
-          case 0:
-            factor = 1;
-            break;
-          case 1:
-            factor = 0.51444;
-            break;
-          case 2:
-            factor = 1.852;
-            break;
-        }
-        twindspeed = m_NMEA0183.Vwt.WindSpeedKnots * factor;
+        double twindspeed =
+            Units::fromBase(Units::SPEED, opt->showWindSpeedchoice,
+                            m_NMEA0183.Vwt.WindSpeedKnots);
 
         sWindSpeedA = wxString::Format("%3.1f %s", twindspeed,
                                        opt->showWindSpeed.c_str());
         dtWindA = wxDateTime::Now();
         bWindA = true;
-        if (minwindA > twindspeed) minwindA = twindspeed;
-        if (maxwindA < twindspeed) maxwindA = twindspeed;
-        avgwindA = (avgwindA + twindspeed) / 2;
-        swindspeedsA = wxString::Format("%03.1f|%03.1f|%03.1f", minwindA,
-                                        avgwindA, maxwindA);
+        stWindSpeedA.add(twindspeed);
+        if (recorder) {
+          recorder->record(InstrumentRecorder::WINDANGLEAPP, dWind);
+          recorder->record(InstrumentRecorder::WINDSPEEDAPP,
+                           m_NMEA0183.Vwr.WindSpeedKnots);
+        }
       }
     } else if (m_NMEA0183.LastSentenceIDReceived == "MTW") {
       if (m_NMEA0183.Parse()) {
-        double t;
-        if (opt->temperature == "F")
-          t = ((m_NMEA0183.Mtw.Temperature * 9) / 5) + 32;
-        else
-          t = m_NMEA0183.Mtw.Temperature;
+        double t = Units::fromBase(Units::TEMPERATURE,
+                                   Units::temperature(opt->temperature),
+                                   m_NMEA0183.Mtw.Temperature);
         sTemperatureWater = wxString::Format("%4.1f %s %s", t, opt->Deg.c_str(),
                                              opt->temperature.c_str());
         dtTemperatureWater = wxDateTime::Now();
         bTemperatureWater = true;
+        if (recorder)
+          recorder->record(InstrumentRecorder::WATERTEMP,
+                           m_NMEA0183.Mtw.Temperature);
       }
     } else if (m_NMEA0183.LastSentenceIDReceived == "DBT") {
       m_NMEA0183.Parse();
@@ -574,18 +567,24 @@ void Logbook::SetSentence(wxString& sentence) {
           (m_NMEA0183.Dbt.DepthMeters == m_NMEA0183.Dbt.DepthFathoms)) {
         sDepth = "-----";
       } else {
+        if (recorder)
+          recorder->record(InstrumentRecorder::DEPTH,
+                           m_NMEA0183.Dbt.DepthMeters);
         switch (opt->showDepth) {
           case 0:
             sDepth = wxString::Format("%5.1f %s", m_NMEA0183.Dbt.DepthMeters,
                                       opt->meter.c_str());
+            stDepth.add(m_NMEA0183.Dbt.DepthMeters);
             break;
           case 1:
             sDepth = wxString::Format("%5.1f %s", m_NMEA0183.Dbt.DepthFeet,
                                       opt->feet.c_str());
+            stDepth.add(m_NMEA0183.Dbt.DepthFeet);
             break;
           case 2:
             sDepth = wxString::Format("%5.1f %s", m_NMEA0183.Dbt.DepthFathoms,
                                       opt->fathom.c_str());
+            stDepth.add(m_NMEA0183.Dbt.DepthFathoms);
             break;
         }
       }
@@ -596,21 +595,24 @@ void Logbook::SetSentence(wxString& sentence) {
       if (m_NMEA0183.Dpt.ErrorMessage.Contains("Invalid")) {
         sDepth = "-----";
       } else {
+        if (recorder)
+          recorder->record(InstrumentRecorder::DEPTH,
+                           m_NMEA0183.Dpt.DepthMeters);
         switch (opt->showDepth) {
           case 0:
             sDepth = wxString::Format("%5.1f %s", m_NMEA0183.Dpt.DepthMeters,
                                       opt->meter.c_str());
+            stDepth.add(m_NMEA0183.Dpt.DepthMeters);
             break;
           case 1:
-            sDepth = wxString::Format("%5.1f %s",
-                                      m_NMEA0183.Dpt.DepthMeters / 0.3048,
-                                      opt->feet.c_str());
-            break;
-          case 2:
-            sDepth = wxString::Format("%5.1f %s",
-                                      m_NMEA0183.Dpt.DepthMeters / 1.8288,
-                                      opt->fathom.c_str());
-            break;
+          case 2: {
+            double depth = Units::fromBase(Units::DEPTH, opt->showDepth,
+                                           m_NMEA0183.Dpt.DepthMeters);
+            sDepth = wxString::Format(
+                "%5.1f %s", depth,
+                (opt->showDepth == 1 ? opt->feet : opt->fathom).c_str());
+            stDepth.add(depth);
+          } break;
         }
       }
     } else if (m_NMEA0183.LastSentenceIDReceived ==
@@ -630,47 +632,48 @@ void Logbook::SetSentence(wxString& sentence) {
 
       if (m_NMEA0183.Parse()) {
         double xdrdata;
-        wxString tempopt;
+        int volume = Units::volume(opt->vol);
 
         for (int i = 0; i < m_NMEA0183.Xdr.TransducerCnt; i++) {
+          const TRANSDUCER_INFO& x = m_NMEA0183.Xdr.TransducerInfo[i];
           wimdaSentence = true;
           dtWimda = wxDateTime::Now();
 
-          xdrdata = m_NMEA0183.Xdr.TransducerInfo[i].MeasurementData;
-          // XDR Airtemp
-          if (m_NMEA0183.Xdr.TransducerInfo[i].TransducerType == "C") {
-            if (opt->temperature == "F") xdrdata = ((xdrdata * 9) / 5) + 32;
-            sTemperatureAir =
-                wxString::Format("%2.2f%s %s", xdrdata, opt->Deg.c_str(),
-                                 opt->temperature.c_str());
-          }
-          // XDR Pressure
-          if (m_NMEA0183.Xdr.TransducerInfo[i].TransducerType == "P") {
-            if (m_NMEA0183.Xdr.TransducerInfo[i].UnitOfMeasurement == "B") {
-              xdrdata *= 1000;
-            }
-            sPressure =
-                wxString::Format("%4.1f %s", xdrdata, opt->baro.c_str());
-          }
-          // XDR Humidity
-          if (m_NMEA0183.Xdr.TransducerInfo[i].TransducerType == "H") {
-            sHumidity = wxString::Format("%3.1f ", xdrdata);
-          }
-          // XDR Volume
-          if (m_NMEA0183.Xdr.TransducerInfo[i].TransducerType == "V") {
-            tempopt = opt->vol.SubString(0, 0).Upper();
-            if (m_NMEA0183.Xdr.TransducerInfo[i].UnitOfMeasurement == "M") {
-              xdrdata *= 1000;
-              if (tempopt == "G") xdrdata = xdrdata * 0.264172;
-            }
-            if (m_NMEA0183.Xdr.TransducerInfo[i].UnitOfMeasurement == "L") {
-              if (tempopt == "G") xdrdata = xdrdata * 0.264172;
-            }
-            if (m_NMEA0183.Xdr.TransducerInfo[i].UnitOfMeasurement == "G") {
-              if (tempopt == "L") xdrdata = xdrdata * 3.7854;
-            }
-            dVolume += xdrdata;
-            sVolume = wxString::Format("%4.2f ", dVolume);
+          xdrdata = x.MeasurementData;
+          const XDRChannels::target& t = xdrChannels.resolve(
+              x.TransducerType, x.TransducerName, x.UnitOfMeasurement);
+          if (recorder && t.recorded >= 0)
+            recorder->record(t.recorded, xdrdata);
+          if (t.slot == XDRChannels::NONE) continue;
+
+          xdrdata *= t.scale;
+          switch (t.slot) {
+            case XDRChannels::AIRTEMP:
+              xdrdata = Units::fromBase(Units::TEMPERATURE,
+                                        Units::temperature(opt->temperature),
+                                        xdrdata);
+              sTemperatureAir =
+                  wxString::Format("%2.2f%s %s", xdrdata, opt->Deg.c_str(),
+                                   opt->temperature.c_str());
+              break;
+            case XDRChannels::PRESSURE:
+              sPressure =
+                  wxString::Format("%4.1f %s", xdrdata, opt->baro.c_str());
+              stPressure.add(xdrdata);
+              break;
+            case XDRChannels::HUMIDITY:
+              sHumidity = wxString::Format("%3.1f ", xdrdata);
+              break;
+            case XDRChannels::VOLUME:
+              // litres, summed over all tanks; other units are not touched
+              if (t.convert)
+                xdrdata = Units::fromBase(Units::VOLUME, volume, xdrdata);
+              dVolume += xdrdata;
+              sVolume = wxString::Format("%4.2f ", dVolume);
+              break;
+            default:
+              xdrChannels.add(t.slot, xdrdata);
+              break;
           }
         }
       }
@@ -707,19 +710,26 @@ void Logbook::SetSentence(wxString& sentence) {
     tkz.GetNextToken().ToDouble(&p);
     p = p * 1000;
     sPressure = wxString::Format("%4.1f %s", p, opt->baro.c_str());
+    stPressure.add(p);
     tkz.GetNextToken();
 
     tkz.GetNextToken().ToDouble(&t);
-    if (opt->temperature == "F") t = ((t * 9) / 5) + 32;
+    if (recorder) {
+      recorder->record(InstrumentRecorder::PRESSURE, p);
+      recorder->record(InstrumentRecorder::AIRTEMP, t);
+    }
+    t = Units::fromBase(Units::TEMPERATURE,
+                        Units::temperature(opt->temperature), t);
     sTemperatureAir = wxString::Format("%2.2f%s %s", t, opt->Deg.c_str(),
                                        opt->temperature.c_str());
 
     tkz.GetNextToken();
     tkz.GetNextToken();
     tkz.GetNextToken();
-    if (tkz.GetNextToken().ToDouble(&h))
+    if (tkz.GetNextToken().ToDouble(&h)) {
       sHumidity = wxString::Format("%3.1f ", h);
-    else
+      if (recorder) recorder->record(InstrumentRecorder::HUMIDITY, h);
+    } else
       sHumidity = wxEmptyString;
   } else if (opt->bRPMIsChecked && sentenceInd.Right(3) == "RPM") {
     rpmSentence = true;
@@ -736,7 +746,11 @@ void Logbook::SetSentence(wxString& sentence) {
 
     if (engineNr == opt->engine1Id && opt->bEng1RPMIsChecked) {
       speed.ToLong(&Umin1);
-      if (source == "E") sRPM1 = speed;
+      if (source == "E") {
+        sRPM1 = speed;
+        stRPM1.add(Umin1);
+        if (recorder) recorder->record(InstrumentRecorder::RPM1, Umin1);
+      }
       sRPM1Source = source;
 
       if (Umin1 != 0L) {
@@ -767,7 +781,11 @@ void Logbook::SetSentence(wxString& sentence) {
 
     if (engineNr == opt->engine2Id && opt->bEng2RPMIsChecked) {
       speed.ToLong(&Umin2);
-      if (source == "E") sRPM2 = speed;
+      if (source == "E") {
+        sRPM2 = speed;
+        stRPM2.add(Umin2);
+        if (recorder) recorder->record(InstrumentRecorder::RPM2, Umin2);
+      }
 
       if (Umin2 != 0L) {
         if (source == "E") {
@@ -877,7 +895,8 @@ void Logbook::setPositionString(double dLat, int iNorth, double dLon,
 void Logbook::newLogbook() {
   bool zero = false;
 
-  if (data_locn != this->logbookData_actual) this->switchToActualLogbook();
+  if (data_locn != this->logbookData_actual || !voyage.IsEmpty())
+    this->switchToActualLogbook();
 
   int i = wxMessageBox(_("Are you sure ?"), _("New Logbook"), wxYES_NO);
   if (i == wxNO) {
@@ -893,6 +912,14 @@ void Logbook::newLogbook() {
     return;
   }
 
+  rollover(zero);
+  dialog->logGrids[dialog->m_logbook->GetSelection()]->SetFocus();
+}
+
+// Archives the actual logbook as until_<date>_<time>_logbook.txt and starts
+// a new one with the last line carried forward (totals kept, distance 0),
+// or with a fresh line when zero. Returns the archive name.
+wxString Logbook::rollover(bool zero) {
   update();
 
   wxFileName fn = data_locn;
@@ -945,11 +972,42 @@ void Logbook::newLogbook() {
     dialog->logGrids[0]->SetCellValue(0, 13, _("Last Logbook is\n") + ss);
   }
 
+  modified = true;
   update();
+  voyageEnded = false;
 
   dialog->setEqualRowHeight(0);
   setCellAlign(0);
-  dialog->logGrids[dialog->m_logbook->GetSelection()]->SetFocus();
+
+  LogbookArchive::summarize(temp, opt->sealArchives);
+  return ss;
+}
+
+bool Logbook::rolloverDue() {
+  int rows = window.held() + dialog->logGrids[0]->GetNumberRows();
+  // the carried line alone is never archived again
+  if (data_locn != logbookData_actual || !voyage.IsEmpty() || rows < 2)
+    return false;
+
+  switch (opt->rollover) {
+    case ROLLOVER_ROWS:
+      return opt->rolloverRows > 0 && rows >= opt->rolloverRows;
+    case ROLLOVER_SIZE:  // as last saved
+      return opt->rolloverSize > 0 &&
+             wxFileName::GetSize(data_locn).ToDouble() >=
+                 opt->rolloverSize * 1024.0;
+    case ROLLOVER_SEASON: {
+      wxDateTime last, now = (sDate != wxEmptyString) ? mCorrectedDateTime
+                                                       : wxDateTime::Now();
+      wxString s = dialog->logGrids[0]->GetCellValue(
+          dialog->logGrids[0]->GetNumberRows() - 1, RDATE);
+      return LogbookDialog::myParseDate(s, last) &&
+             last.GetYear() != now.GetYear();
+    }
+    case ROLLOVER_VOYAGE:
+      return voyageEnded;
+  }
+  return false;
 }
 
 void Logbook::selectLogbook() {
@@ -968,18 +1026,89 @@ void Logbook::selectLogbook() {
     return;
   }
 
-  wxString s = selLogbook.files[selLogbook.selRow];
+  wxString s = selLogbook.file(selLogbook.selRow);
+  wxArrayString selected = selLogbook.selectedFiles();
 
   for (int i = 0; i < LOGGRIDS; i++)
     if (dialog->logGrids[i]->GetNumberRows() != 0)
       dialog->logGrids[i]->DeleteRows(0, dialog->logGrids[i]->GetNumberRows());
 
-  loadSelectedData(s);
+  if (selected.Count() > 1)
+    loadVoyage(selected);
+  else
+    loadSelectedData(s);
+}
+
+// several logbooks, e.g. a passage over a rollover, shown as one voyage,
+// or a single sealed archive; it can be viewed and exported, the files are
+// never written. The view
+// stays open and the grids get the newest rows the memory budget allows,
+// the older ones are paged in from it like the held rows of a logbook.
+void Logbook::loadVoyage(const wxArrayString& paths) {
+  VoyageView* view = new VoyageView;
+  wxArrayString files;
+  for (unsigned int i = 0; i < paths.Count(); i++)
+    if (view->add(paths[i])) files.Add(paths[i]);
+  if (files.IsEmpty()) {
+    delete view;
+    return;
+  }
+
+  update();
+  clearAllGrids();
+  voyageView = view;
+  dialog->selGridCol = dialog->selGridRow = 0;
+  voyage = wxJoin(files, ';', '\0');
+  oldLogbook = true;
+  data_locn = files.Last();
+  setLogbookFile(data_locn);
+  if (files.Count() == 1) {
+    wxString name = wxFileName(data_locn).GetName();
+    setFileName(SealedLogbook::textPath(data_locn), layout_locn);
+    dialog->backupFile = name;
+    title = wxString::Format(_("Old Logbook until %s"),
+                             dialog->getDateTo(name).FormatDate().c_str());
+  } else {
+    // a viewed HTML or ODT goes next to the logbooks as voyage.*
+    setFileName(dialog->data + "voyage.txt", layout_locn);
+    title =
+        wxString::Format(_("Voyage over %i logbooks"), (int)files.Count());
+  }
+  dialog->SetTitle(title);
+
+  // the size of a row is taken from the newest lines
+  int rows = (int)view->rows();
+  int sample = wxMin(rows, (int)RowWindow::MINROWS);
+  wxFileOffset bytes = 0;
+  for (int row = rows - sample; row < rows; row++)
+    bytes += view->line(row).Length() + 1;
+  int shown = sample ? wxMin(rows, RowWindow::fit(opt->memoryBudget,
+                                                  bytes / sample))
+                     : 0;
+  window.hold(rows - shown);
+
+  for (int i = 0; i < LOGGRIDS; i++) {
+    dialog->logGrids[i]->BeginBatch();
+    dialog->logGrids[i]->AppendRows(shown);
+  }
+  for (int row = 0; row < shown; row++)
+    loadRow(row, view->line(window.held() + row));
+  dialog->setEqualRowHeights();
+  for (int i = 0; i < LOGGRIDS; i++) {
+    dialog->logGrids[i]->EnableEditing(false);
+    dialog->logGrids[i]->EndBatch();
+    dialog->logGrids[i]->MakeCellVisible(shown - 1, 0);
+  }
 }
 
 void Logbook::loadSelectedData(wxString path) {
+  // a sealed archive is read block by block, it stays sealed
+  if (SealedLogbook::isSealed(path)) {
+    loadVoyage(wxArrayString(1, &path));
+    return;
+  }
   data_locn = path;
-  logbookFile = new wxTextFile(path);
+  setLogbookFile(path);
   setFileName(path, layout_locn);
   wxFileName fn(path);
   path = fn.GetName();
@@ -1006,18 +1135,23 @@ void Logbook::clearAllGrids() {
     dialog->m_gridMotorSails->DeleteRows(
         0, dialog->m_gridMotorSails->GetNumberRows(), false);
   }
+  window.clear();
+  delete voyageView;
+  voyageView = NULL;
 }
 
 void Logbook::loadData() {
-  wxString s = "", t;
-  wxString nullhstr = "00:00";
-  double nullval = 0.0;
+  wxString t;
   wxString dateFormat;
 
   dialog->selGridCol = dialog->selGridRow = 0;
   if (title.IsEmpty()) title = _("Active Logbook");
 
   clearAllGrids();
+  if (!voyage.IsEmpty()) {
+    voyage = wxEmptyString;
+    for (int i = 0; i < LOGGRIDS; i++) dialog->logGrids[i]->EnableEditing(true);
+  }
 
   int row = 0;
 
@@ -1082,8 +1216,17 @@ void Logbook::loadData() {
   first.GetNextToken();
   logbookDescription = first.GetNextToken();
 
-  wxDateTime dt;
-  int month = 0, day = 0, year = 0, hour = 0, min = 0, sec = 0;
+  // the low memory mode leaves the older rows on disk
+  if (opt->lowMemory) {
+    int rows = window.scan(data_locn);
+    window.hold(wxMax(0, rows - window.fit(opt->memoryBudget)));
+    if (window.held()) {
+      delete stream;
+      input.SeekI(window.offset(window.held()));
+      stream = new wxTextInputStream(input, "\n", wxConvUTF8);
+    }
+  }
+
   dialog->m_gridGlobal->BeginBatch();
   dialog->m_gridWeather->BeginBatch();
   dialog->m_gridMotorSails->BeginBatch();
@@ -1095,258 +1238,10 @@ void Logbook::loadData() {
     dialog->m_gridWeather->AppendRows();
     dialog->m_gridMotorSails->AppendRows();
 
-    setCellAlign(row);
-
-    wxStringTokenizer tkz(t, "\t", wxTOKEN_RET_EMPTY);
-    int c = 0;
-    int fields = tkz.CountTokens();
-
-    while (tkz.HasMoreTokens()) {
-      s = dialog->restoreDangerChar(tkz.GetNextToken());
-      s.RemoveLast();
-
-      switch (c) {
-        case 0:
-          dialog->m_gridGlobal->SetCellValue(row, ROUTE, s);
-          break;
-        case 1:
-          month = wxAtoi(s);
-          break;
-        case 2:
-          day = wxAtoi(s);
-          break;
-        case 3:
-          year = wxAtoi(s);
-          if (month >= 0 && day != 0 && year != 0) {
-            dt.Set(day, (wxDateTime::Month)month, year);
-            dialog->m_gridGlobal->SetCellValue(row, RDATE,
-                                               dt.Format(opt->sdateformat));
-          }
-          break;
-        case 4:
-          if (s.IsEmpty())
-            hour = -1;
-          else
-            hour = wxAtoi(s);
-          break;
-        case 5:
-          if (s.IsEmpty())
-            min = -1;
-          else
-            min = wxAtoi(s);
-          break;
-        case 6:
-          if (hour == -1 || min == -1) continue;
-          sec = wxAtoi(s);
-          dt.Set(hour, min, sec);
-          dialog->m_gridGlobal->SetCellValue(row, RTIME,
-                                             dt.Format(opt->stimeformat));
-          break;
-        case 7:
-          dialog->m_gridGlobal->SetCellValue(row, STATUS, s);
-          break;
-        case 8:
-          dialog->m_gridGlobal->SetCellValue(row, WAKE, s);
-          break;
-        case 9:
-          dialog->m_gridGlobal->SetCellValue(row, DISTANCE, s);
-          break;
-        case 10:
-          dialog->m_gridGlobal->SetCellValue(row, DTOTAL, s);
-          dialog->m_gridGlobal->SetReadOnly(row, DTOTAL);
-          break;
-        case 11:
-          dialog->m_gridGlobal->SetCellValue(row, POSITION, s);
-          break;
-        case 12:
-          dialog->m_gridGlobal->SetCellValue(row, COG, s);
-          break;
-        case 13:
-          dialog->m_gridGlobal->SetCellValue(row, COW, s);
-          break;
-        case 14:
-          dialog->m_gridGlobal->SetCellValue(row, SOG, s);
-          break;
-        case 15:
-          dialog->m_gridGlobal->SetCellValue(row, SOW, s);
-          break;
-        case 16:
-          dialog->m_gridGlobal->SetCellValue(row, DEPTH, s);
-          break;
-        case 17:
-          dialog->m_gridGlobal->SetCellValue(row, REMARKS, s);
-          break;
-        case 18:
-          dialog->m_gridWeather->SetCellValue(row, LogbookHTML::BARO, s);
-          break;
-        case 19:
-          dialog->m_gridWeather->SetCellValue(row, LogbookHTML::WIND, s);
-          break;
-        case 20:
-          dialog->m_gridWeather->SetCellValue(row, LogbookHTML::WSPD, s);
-          break;
-        case 21:
-          dialog->m_gridWeather->SetCellValue(row, LogbookHTML::CURRENT, s);
-          break;
-        case 22:
-          dialog->m_gridWeather->SetCellValue(row, LogbookHTML::CSPD, s);
-          break;
-        case 23:
-          dialog->m_gridWeather->SetCellValue(row, LogbookHTML::WAVE, s);
-          break;
-        case 24:
-          dialog->m_gridWeather->SetCellValue(row, LogbookHTML::SWELL, s);
-          break;
-        case 25:
-          dialog->m_gridWeather->SetCellValue(row, LogbookHTML::WEATHER, s);
-          break;
-        case 26:
-          dialog->m_gridWeather->SetCellValue(row, LogbookHTML::CLOUDS, s);
-          break;
-        case 27:
-          dialog->m_gridWeather->SetCellValue(row, LogbookHTML::VISIBILITY, s);
-          break;
-        case 28:
-          dialog->m_gridMotorSails->SetCellValue(row, LogbookHTML::MOTOR, s);
-          break;
-        case 29:
-          dialog->m_gridMotorSails->SetCellValue(row, LogbookHTML::MOTORT, s);
-          break;
-        case 30:
-          dialog->m_gridMotorSails->SetCellValue(row, LogbookHTML::FUEL, s);
-          break;
-        case 31:
-          dialog->m_gridMotorSails->SetCellValue(row, LogbookHTML::FUELT, s);
-          break;
-        case 32:
-          dialog->m_gridMotorSails->SetCellValue(row, LogbookHTML::SAILS, s);
-          break;
-        case 33:
-          dialog->m_gridMotorSails->SetCellValue(row, LogbookHTML::REEF, s);
-          break;
-        case 34:
-          dialog->m_gridMotorSails->SetCellValue(row, LogbookHTML::WATER, s);
-          break;
-        case 35:
-          dialog->m_gridMotorSails->SetCellValue(row, LogbookHTML::WATERT, s);
-          break;
-
-        case 36:
-          dialog->m_gridMotorSails->SetCellValue(row, LogbookHTML::MREMARKS, s);
-          break;
-        case 37:
-          dialog->m_gridWeather->SetCellValue(row, LogbookHTML::HYDRO, s);
-          break;
-        case 38:
-          dialog->m_gridWeather->SetCellValue(row, LogbookHTML::AIRTE, s);
-          break;
-        case 39:
-          dialog->m_gridWeather->SetCellValue(row, LogbookHTML::WATERTE, s);
-          break;
-        case 40:
-          dialog->m_gridMotorSails->SetCellValue(row, LogbookHTML::MOTOR1, s);
-          break;
-        case 41:
-          dialog->m_gridMotorSails->SetCellValue(row, LogbookHTML::MOTOR1T, s);
-          break;
-        case 42:
-          dialog->m_gridMotorSails->SetCellValue(row, LogbookHTML::GENE, s);
-          break;
-        case 43:
-          dialog->m_gridMotorSails->SetCellValue(row, LogbookHTML::GENET, s);
-          break;
-        case 44:
-          dialog->m_gridMotorSails->SetCellValue(row, LogbookHTML::BANK1, s);
-          break;
-        case 45:
-          dialog->m_gridMotorSails->SetCellValue(row, LogbookHTML::BANK1T, s);
-          break;
-        case 46:
-          dialog->m_gridMotorSails->SetCellValue(row, LogbookHTML::BANK2, s);
-          break;
-        case 47:
-          dialog->m_gridMotorSails->SetCellValue(row, LogbookHTML::BANK2T, s);
-          break;
-        case 48:
-          dialog->m_gridMotorSails->SetCellValue(row, LogbookHTML::WATERM, s);
-          break;
-        case 49:
-          dialog->m_gridMotorSails->SetCellValue(row, LogbookHTML::WATERMT, s);
-          break;
-        case 50:
-          dialog->m_gridMotorSails->SetCellValue(row, LogbookHTML::WATERMO, s);
-          break;
-        case 51:
-          dialog->m_gridMotorSails->SetCellValue(row, LogbookHTML::ROUTEID, s);
-          break;
-        case 52:
-          dialog->m_gridMotorSails->SetCellValue(row, LogbookHTML::TRACKID, s);
-          break;
-        case 53:
-          dialog->m_gridMotorSails->SetCellValue(row, LogbookHTML::RPM1, s);
-          break;
-        case 54:
-          dialog->m_gridMotorSails->SetCellValue(row, LogbookHTML::RPM2, s);
-          break;
-        case 55:
-          dialog->m_gridWeather->SetCellValue(row, LogbookHTML::WINDR, s);
-          break;
-        case 56:
-          dialog->m_gridWeather->SetCellValue(row, LogbookHTML::WSPDR, s);
-          //    int in =  0;
-          break;
-      }
-      c++;
-    }
-    wxString temp = dialog->m_gridGlobal->GetCellValue(row, DISTANCE);
-    temp.Replace(",", ".");
-    double dist = wxAtof(temp);
-    if ((dialog->m_gridGlobal->GetCellValue(row, STATUS) == wxEmptyString ||
-         dialog->m_gridGlobal->GetCellValue(row, STATUS).GetChar(0) == ' ') &&
-        dist > 0)
-      dialog->m_gridGlobal->SetCellValue(row, STATUS, "S");
-
-    if (fields <
-        50)  // data from 0.910 ? need zero-values to calculate the columns
-    {
-      dialog->m_gridMotorSails->SetCellValue(
-          row, LogbookHTML::MOTOR1,
-          wxString::Format("%s %s", nullhstr.c_str(), opt->motorh.c_str()));
-      dialog->m_gridMotorSails->SetCellValue(
-          row, LogbookHTML::MOTOR1T,
-          wxString::Format("%s %s", nullhstr.c_str(), opt->motorh.c_str()));
-      dialog->m_gridMotorSails->SetCellValue(
-          row, LogbookHTML::GENE,
-          wxString::Format("%s %s", nullhstr.c_str(), opt->motorh.c_str()));
-      dialog->m_gridMotorSails->SetCellValue(
-          row, LogbookHTML::GENET,
-          wxString::Format("%s %s", nullhstr.c_str(), opt->motorh.c_str()));
-      dialog->m_gridMotorSails->SetCellValue(
-          row, LogbookHTML::BANK1,
-          wxString::Format("%2.2f %s", nullval, opt->ampereh.c_str()));
-      dialog->m_gridMotorSails->SetCellValue(
-          row, LogbookHTML::BANK1T,
-          wxString::Format("%2.2f %s", nullval, opt->ampereh.c_str()));
-      dialog->m_gridMotorSails->SetCellValue(
-          row, LogbookHTML::BANK2,
-          wxString::Format("%2.2f %s", nullval, opt->ampereh.c_str()));
-      dialog->m_gridMotorSails->SetCellValue(
-          row, LogbookHTML::BANK2T,
-          wxString::Format("%2.2f %s", nullval, opt->ampereh.c_str()));
-      dialog->m_gridMotorSails->SetCellValue(
-          row, LogbookHTML::WATERM,
-          wxString::Format("%s %s", nullhstr.c_str(), opt->motorh.c_str()));
-      dialog->m_gridMotorSails->SetCellValue(
-          row, LogbookHTML::WATERMT,
-          wxString::Format("%s %s", nullhstr.c_str(), opt->motorh.c_str()));
-      dialog->m_gridMotorSails->SetCellValue(
-          row, LogbookHTML::WATERMO,
-          wxString::Format("%2.2f %s", nullval, opt->vol.c_str()));
-    }
-
-    dialog->setEqualRowHeight(row);
+    loadRow(row, t);
     row++;
   }
+  dialog->setEqualRowHeights();
 
   dialog->selGridRow = 0;
   dialog->selGridCol = 0;
@@ -1362,13 +1257,321 @@ void Logbook::loadData() {
   dialog->m_gridWeather->EndBatch();
   dialog->m_gridMotorSails->EndBatch();
 
-  if (!oldLogbook && lines >= 500) {
+  lines += window.held();
+  if (!oldLogbook && lines >= 500 && opt->rollover == ROLLOVER_OFF) {
     wxString str = wxString::Format(sLinesReminder, lines);
     LinesReminderDlg* dlg = new LinesReminderDlg(str, dialog);
     dlg->Show();
   }
 }
 
+// one line of the logbook file into the row of the grids
+void Logbook::loadRow(int row, const wxString& t) {
+  wxString s;
+  wxString nullhstr = "00:00";
+  double nullval = 0.0;
+  wxDateTime dt;
+  int month = 0, day = 0, year = 0, hour = 0, min = 0, sec = 0;
+
+  setCellAlign(row);
+
+  wxStringTokenizer tkz(t, "\t", wxTOKEN_RET_EMPTY);
+  int c = 0;
+  int fields = tkz.CountTokens();
+
+  while (tkz.HasMoreTokens()) {
+    s = dialog->restoreDangerChar(tkz.GetNextToken());
+    s.RemoveLast();
+
+    switch (c) {
+      case 0:
+        dialog->m_gridGlobal->SetCellValue(row, ROUTE, s);
+        break;
+      case 1:
+        month = wxAtoi(s);
+        break;
+      case 2:
+        day = wxAtoi(s);
+        break;
+      case 3:
+        year = wxAtoi(s);
+        if (month >= 0 && day != 0 && year != 0) {
+          dt.Set(day, (wxDateTime::Month)month, year);
+          dialog->m_gridGlobal->SetCellValue(row, RDATE,
+                                             dt.Format(opt->sdateformat));
+        }
+        break;
+      case 4:
+        if (s.IsEmpty())
+          hour = -1;
+        else
+          hour = wxAtoi(s);
+        break;
+      case 5:
+        if (s.IsEmpty())
+          min = -1;
+        else
+          min = wxAtoi(s);
+        break;
+      case 6:
+        if (hour == -1 || min == -1) continue;
+        sec = wxAtoi(s);
+        dt.Set(hour, min, sec);
+        dialog->m_gridGlobal->SetCellValue(row, RTIME,
+                                           dt.Format(opt->stimeformat));
+        break;
+      case 7:
+        dialog->m_gridGlobal->SetCellValue(row, STATUS, s);
+        break;
+      case 8:
+        dialog->m_gridGlobal->SetCellValue(row, WAKE, s);
+        break;
+      case 9:
+        dialog->m_gridGlobal->SetCellValue(row, DISTANCE, s);
+        break;
+      case 10:
+        dialog->m_gridGlobal->SetCellValue(row, DTOTAL, s);
+        dialog->m_gridGlobal->SetReadOnly(row, DTOTAL);
+        break;
+      case 11:
+        dialog->m_gridGlobal->SetCellValue(row, POSITION, s);
+        break;
+      case 12:
+        dialog->m_gridGlobal->SetCellValue(row, COG, s);
+        break;
+      case 13:
+        dialog->m_gridGlobal->SetCellValue(row, COW, s);
+        break;
+      case 14:
+        dialog->m_gridGlobal->SetCellValue(row, SOG, s);
+        break;
+      case 15:
+        dialog->m_gridGlobal->SetCellValue(row, SOW, s);
+        break;
+      case 16:
+        dialog->m_gridGlobal->SetCellValue(row, DEPTH, s);
+        break;
+      case 17:
+        dialog->m_gridGlobal->SetCellValue(row, REMARKS, s);
+        break;
+      case 18:
+        dialog->m_gridWeather->SetCellValue(row, LogbookHTML::BARO, s);
+        break;
+      case 19:
+        dialog->m_gridWeather->SetCellValue(row, LogbookHTML::WIND, s);
+        break;
+      case 20:
+        dialog->m_gridWeather->SetCellValue(row, LogbookHTML::WSPD, s);
+        break;
+      case 21:
+        dialog->m_gridWeather->SetCellValue(row, LogbookHTML::CURRENT, s);
+        break;
+      case 22:
+        dialog->m_gridWeather->SetCellValue(row, LogbookHTML::CSPD, s);
+        break;
+      case 23:
+        dialog->m_gridWeather->SetCellValue(row, LogbookHTML::WAVE, s);
+        break;
+      case 24:
+        dialog->m_gridWeather->SetCellValue(row, LogbookHTML::SWELL, s);
+        break;
+      case 25:
+        dialog->m_gridWeather->SetCellValue(row, LogbookHTML::WEATHER, s);
+        break;
+      case 26:
+        dialog->m_gridWeather->SetCellValue(row, LogbookHTML::CLOUDS, s);
+        break;
+      case 27:
+        dialog->m_gridWeather->SetCellValue(row, LogbookHTML::VISIBILITY, s);
+        break;
+      case 28:
+        dialog->m_gridMotorSails->SetCellValue(row, LogbookHTML::MOTOR, s);
+        break;
+      case 29:
+        dialog->m_gridMotorSails->SetCellValue(row, LogbookHTML::MOTORT, s);
+        break;
+      case 30:
+        dialog->m_gridMotorSails->SetCellValue(row, LogbookHTML::FUEL, s);
+        break;
+      case 31:
+        dialog->m_gridMotorSails->SetCellValue(row, LogbookHTML::FUELT, s);
+        break;
+      case 32:
+        dialog->m_gridMotorSails->SetCellValue(row, LogbookHTML::SAILS, s);
+        break;
+      case 33:
+        dialog->m_gridMotorSails->SetCellValue(row, LogbookHTML::REEF, s);
+        break;
+      case 34:
+        dialog->m_gridMotorSails->SetCellValue(row, LogbookHTML::WATER, s);
+        break;
+      case 35:
+        dialog->m_gridMotorSails->SetCellValue(row, LogbookHTML::WATERT, s);
+        break;
+
+      case 36:
+        dialog->m_gridMotorSails->SetCellValue(row, LogbookHTML::MREMARKS, s);
+        break;
+      case 37:
+        dialog->m_gridWeather->SetCellValue(row, LogbookHTML::HYDRO, s);
+        break;
+      case 38:
+        dialog->m_gridWeather->SetCellValue(row, LogbookHTML::AIRTE, s);
+        break;
+      case 39:
+        dialog->m_gridWeather->SetCellValue(row, LogbookHTML::WATERTE, s);
+        break;
+      case 40:
+        dialog->m_gridMotorSails->SetCellValue(row, LogbookHTML::MOTOR1, s);
+        break;
+      case 41:
+        dialog->m_gridMotorSails->SetCellValue(row, LogbookHTML::MOTOR1T, s);
+        break;
+      case 42:
+        dialog->m_gridMotorSails->SetCellValue(row, LogbookHTML::GENE, s);
+        break;
+      case 43:
+        dialog->m_gridMotorSails->SetCellValue(row, LogbookHTML::GENET, s);
+        break;
+      case 44:
+        dialog->m_gridMotorSails->SetCellValue(row, LogbookHTML::BANK1, s);
+        break;
+      case 45:
+        dialog->m_gridMotorSails->SetCellValue(row, LogbookHTML::BANK1T, s);
+        break;
+      case 46:
+        dialog->m_gridMotorSails->SetCellValue(row, LogbookHTML::BANK2, s);
+        break;
+      case 47:
+        dialog->m_gridMotorSails->SetCellValue(row, LogbookHTML::BANK2T, s);
+        break;
+      case 48:
+        dialog->m_gridMotorSails->SetCellValue(row, LogbookHTML::WATERM, s);
+        break;
+      case 49:
+        dialog->m_gridMotorSails->SetCellValue(row, LogbookHTML::WATERMT, s);
+        break;
+      case 50:
+        dialog->m_gridMotorSails->SetCellValue(row, LogbookHTML::WATERMO, s);
+        break;
+      case 51:
+        dialog->m_gridMotorSails->SetCellValue(row, LogbookHTML::ROUTEID, s);
+        break;
+      case 52:
+        dialog->m_gridMotorSails->SetCellValue(row, LogbookHTML::TRACKID, s);
+        break;
+      case 53:
+        dialog->m_gridMotorSails->SetCellValue(row, LogbookHTML::RPM1, s);
+        break;
+      case 54:
+        dialog->m_gridMotorSails->SetCellValue(row, LogbookHTML::RPM2, s);
+        break;
+      case 55:
+        dialog->m_gridWeather->SetCellValue(row, LogbookHTML::WINDR, s);
+        break;
+      case 56:
+        dialog->m_gridWeather->SetCellValue(row, LogbookHTML::WSPDR, s);
+        //    int in =  0;
+        break;
+    }
+    c++;
+  }
+  wxString temp = dialog->m_gridGlobal->GetCellValue(row, DISTANCE);
+  temp.Replace(",", ".");
+  double dist = wxAtof(temp);
+  if ((dialog->m_gridGlobal->GetCellValue(row, STATUS) == wxEmptyString ||
+       dialog->m_gridGlobal->GetCellValue(row, STATUS).GetChar(0) == ' ') &&
+      dist > 0)
+    dialog->m_gridGlobal->SetCellValue(row, STATUS, "S");
+
+  if (fields <
+      50)  // data from 0.910 ? need zero-values to calculate the columns
+  {
+    dialog->m_gridMotorSails->SetCellValue(
+        row, LogbookHTML::MOTOR1,
+        wxString::Format("%s %s", nullhstr.c_str(), opt->motorh.c_str()));
+    dialog->m_gridMotorSails->SetCellValue(
+        row, LogbookHTML::MOTOR1T,
+        wxString::Format("%s %s", nullhstr.c_str(), opt->motorh.c_str()));
+    dialog->m_gridMotorSails->SetCellValue(
+        row, LogbookHTML::GENE,
+        wxString::Format("%s %s", nullhstr.c_str(), opt->motorh.c_str()));
+    dialog->m_gridMotorSails->SetCellValue(
+        row, LogbookHTML::GENET,
+        wxString::Format("%s %s", nullhstr.c_str(), opt->motorh.c_str()));
+    dialog->m_gridMotorSails->SetCellValue(
+        row, LogbookHTML::BANK1,
+        wxString::Format("%2.2f %s", nullval, opt->ampereh.c_str()));
+    dialog->m_gridMotorSails->SetCellValue(
+        row, LogbookHTML::BANK1T,
+        wxString::Format("%2.2f %s", nullval, opt->ampereh.c_str()));
+    dialog->m_gridMotorSails->SetCellValue(
+        row, LogbookHTML::BANK2,
+        wxString::Format("%2.2f %s", nullval, opt->ampereh.c_str()));
+    dialog->m_gridMotorSails->SetCellValue(
+        row, LogbookHTML::BANK2T,
+        wxString::Format("%2.2f %s", nullval, opt->ampereh.c_str()));
+    dialog->m_gridMotorSails->SetCellValue(
+        row, LogbookHTML::WATERM,
+        wxString::Format("%s %s", nullhstr.c_str(), opt->motorh.c_str()));
+    dialog->m_gridMotorSails->SetCellValue(
+        row, LogbookHTML::WATERMT,
+        wxString::Format("%s %s", nullhstr.c_str(), opt->motorh.c_str()));
+    dialog->m_gridMotorSails->SetCellValue(
+        row, LogbookHTML::WATERMO,
+        wxString::Format("%2.2f %s", nullval, opt->vol.c_str()));
+  }
+}
+
+// puts the newest count of the held rows back above the rows in the
+// grids, as when scrolled to the top; returns the rows added at row 0.
+// With unsaved edits nothing is paged in, unless save writes them first.
+int Logbook::pageIn(int count, bool save) {
+  if (count > window.held()) count = window.held();
+  if (count <= 0) return 0;
+  if (modified && save) update();
+  if (modified) return 0;
+
+  wxArrayString lines;
+  int from = window.held() - count;
+  if (voyageView) {
+    for (int row = from; row < window.held(); row++)
+      lines.Add(voyageView->line(row));
+  } else if (!window.read(data_locn, from, window.held(), lines))
+    return 0;
+
+  for (int i = 0; i < LOGGRIDS; i++) {
+    dialog->logGrids[i]->BeginBatch();
+    dialog->logGrids[i]->InsertRows(0, count);
+  }
+  for (int row = 0; row < count; row++) {
+    loadRow(row, lines[row]);
+    dialog->setEqualRowHeight(row);
+  }
+  for (int i = 0; i < LOGGRIDS; i++) dialog->logGrids[i]->EndBatch();
+
+  window.hold(from);
+  dialog->selGridRow += count;
+  return count;
+}
+
+// gives the oldest rows beyond the memory budget back to the file
+bool Logbook::trimWindow() {
+  if (!opt->lowMemory) return false;
+  if (modified) update();
+
+  int rows = dialog->m_gridGlobal->GetNumberRows();
+  int drop = rows - window.fit(opt->memoryBudget);
+  // only while the offsets still describe the file
+  if (drop <= 0 || modified || window.rows() != window.held() + rows)
+    return false;
+
+  for (int i = 0; i < LOGGRIDS; i++) dialog->logGrids[i]->DeleteRows(0, drop);
+  window.hold(window.held() + drop);
+  dialog->selGridRow = wxMax(0, dialog->selGridRow - drop);
+  return true;
+}
+
 wxString Logbook::makeDateFromFile(wxString date, wxString dateformat) {
   wxStringTokenizer tkzd(date, "/");
   wxDateTime dt;
@@ -1626,7 +1829,7 @@ void Logbook::setCellAlign(int i) {
 void Logbook::switchToActualLogbook() {
   dialog->selGridRow = 0;
   dialog->selGridCol = 0;
-  logbookFile = new wxTextFile(logbookData_actual);
+  setLogbookFile(logbookData_actual);
   data_locn = logbookData_actual;
   setFileName(logbookData_actual, layout_locn);
   dialog->SetTitle(_("Active Logbook"));
@@ -1644,7 +1847,7 @@ void Logbook::appendRow(bool showlastline, bool autoline) {
   modified = true;
 
   wxFileName fn(logbookFile->GetName());
-  if (fn.GetName() != ("logbook")) {
+  if (fn.GetName() != ("logbook") || !voyage.IsEmpty()) {
     switchToActualLogbook();
     noAppend = true;
     NoAppendDialog* x = new NoAppendDialog(dialog);
@@ -1654,8 +1857,10 @@ void Logbook::appendRow(bool showlastline, bool autoline) {
     oldLogbook = false;
   }
 
+  if (rolloverDue()) rollover(false);
+
   int lastRow = dialog->logGrids[0]->GetNumberRows();
-  if (lastRow >= 499) {
+  if (lastRow >= 499 && opt->rollover == ROLLOVER_OFF) {
     static int repeat = lastRow;
     // dialog->timer->Stop();
     if (lastRow == repeat) {
@@ -1788,12 +1993,13 @@ void Logbook::appendRow(bool showlastline, bool autoline) {
                                     sTemperatureWater);
   dialog->logGrids[1]->SetCellValue(lastRow, LogbookHTML::WIND, sWindT);
   if (opt->windspeeds) {
-    dialog->logGrids[1]->SetCellValue(lastRow, LogbookHTML::WSPD, swindspeedsT);
+    dialog->logGrids[1]->SetCellValue(
+        lastRow, LogbookHTML::WSPD,
+        stWindSpeed.valid() ? stWindSpeed.format() : wxString());
     dialog->logGrids[1]->SetCellValue(lastRow, LogbookHTML::WINDR, sWindA);
-    dialog->logGrids[1]->SetCellValue(lastRow, LogbookHTML::WSPDR,
-                                      swindspeedsA);
-    minwindA = minwindT = 99;
-    maxwindA = maxwindT = 0;
+    dialog->logGrids[1]->SetCellValue(
+        lastRow, LogbookHTML::WSPDR,
+        stWindSpeedA.valid() ? stWindSpeedA.format() : wxString());
   } else {
     dialog->logGrids[1]->SetCellValue(lastRow, LogbookHTML::WSPD, sWindSpeedT);
     dialog->logGrids[1]->SetCellValue(lastRow, LogbookHTML::WINDR, sWindA);
@@ -1813,6 +2019,8 @@ void Logbook::appendRow(bool showlastline, bool autoline) {
     dialog->logGrids[1]->SetCellValue(lastRow, LogbookHTML::HYDRO, sHumidity);
   }
 
+  sendInstrumentStats(lastRow);
+
   dialog->logGrids[2]->SetCellValue(lastRow, LogbookHTML::FUEL, sVolume);
   sVolume = wxEmptyString;
   dVolume = 0;
@@ -2016,6 +2224,10 @@ void Logbook::appendRow(bool showlastline, bool autoline) {
 
   update(); /* Save to file with every newline */
 
+  // logging on with the dialog closed, keep the grids within the budget
+  if (!dialog->IsShown() && trimWindow())
+    lastRow = dialog->logGrids[0]->GetNumberRows() - 1;
+
   if (showlastline) {
     dialog->m_gridGlobal->MakeCellVisible(lastRow, 0);
     dialog->m_gridWeather->MakeCellVisible(lastRow, 0);
@@ -2089,18 +2301,20 @@ void Logbook::checkNMEADeviceIsOn() {
   {
     sDepth = wxEmptyString;
     bDepth = false;
+    stDepth.reset();
   }
   if (bSOW && dtn.Subtract(dtSOW).GetSeconds() > DEVICE_TIMEOUT)  // Speedo
   {
     sSOW = wxEmptyString;
     bSOW = false;
+    stSTW.reset();
   }
   if (bWindA &&
       dtn.Subtract(dtWindA).GetSeconds() > DEVICE_TIMEOUT)  // Wind Rel
   {
     sWindA = wxEmptyString;
     sWindSpeedA = wxEmptyString;
-    swindspeedsA = wxEmptyString;
+    stWindSpeedA.reset();
     bWindA = false;
   }
   if (bWindT &&
@@ -2108,13 +2322,15 @@ void Logbook::checkNMEADeviceIsOn() {
   {
     sWindT = wxEmptyString;
     sWindSpeedT = wxEmptyString;
-    swindspeedsT = wxEmptyString;
+    stWindSpeed.reset();
+    stWindDir.reset();
     bWindT = false;
   }
   if (bCOW && dtn.Subtract(dtCOW).GetSeconds() > DEVICE_TIMEOUT)  // Heading
   {
     sCOW = wxEmptyString;
     bCOW = false;
+    stHeading.reset();
   }
   if (bTemperatureWater && dtn.Subtract(dtTemperatureWater).GetSeconds() >
                                DEVICE_TIMEOUT)  // Watertemperature
@@ -2130,6 +2346,7 @@ void Logbook::checkNMEADeviceIsOn() {
     sTemperatureAir = wxEmptyString;
     sHumidity = wxEmptyString;
     wimdaSentence = false;
+    stPressure.reset();
   }
   if (rpmSentence && dtn.Subtract(dtRPM).GetSeconds() >
                          DEVICE_TIMEOUT)  // Engine RPM and Engine elapsed time
@@ -2204,10 +2421,7 @@ void Logbook::recalculateLogbook(int row) {
   }
 }
 
-void Logbook::checkCourseChanged() {
-  static wxDateTime dt;
-  static bool timer = true;
-
+bool Logbook::courseChanged() {
   wxDouble cog;
   wxGrid* grid = dialog->m_gridGlobal;
 
@@ -2215,7 +2429,7 @@ void Logbook::checkCourseChanged() {
   temp.Replace(",", ".");
   temp.ToDouble(&cog);
 
-  if ((cog == dCOG) || (oldLogbook || temp.IsEmpty())) return;
+  if ((cog == dCOG) || (oldLogbook || temp.IsEmpty())) return false;
 
 #ifdef __WXOSX__
   wxDouble result = labs(cog - dCOG);
@@ -2225,30 +2439,71 @@ void Logbook::checkCourseChanged() {
   if (result > 180) result -= 360;
 
 #ifdef __WXOSX__
-  if (labs(result) >= opt->dCourseChangeDegrees &&
-      !dialog->logbookPlugIn->eventsEnabled)
+  return labs(result) >= opt->dCourseChangeDegrees &&
+         !dialog->logbookPlugIn->eventsEnabled;
 #else
-  if (abs(result) >= opt->dCourseChangeDegrees &&
-      !dialog->logbookPlugIn->eventsEnabled)
+  return abs(result) >= opt->dCourseChangeDegrees &&
+         !dialog->logbookPlugIn->eventsEnabled;
 #endif
-  {
-    if (timer) {
-      timer = false;
-      dt = mCorrectedDateTime;
-      long min;
-      opt->courseTextAfterMinutes.ToLong(&min);
-      wxTimeSpan t(0, (int)min);
-      dt.Add(t);
-    }
+}
 
-    if (mCorrectedDateTime >= dt) {
-      dialog->logbookTimerWindow->popUp();
-      timer = true;
-      courseChange = true;
-      appendRow(true, true);
-      courseChange = false;
-    }
+void Logbook::checkCourseChanged() {
+  if (!courseChanged()) return;
+
+  if (!courseDue.IsValid()) {
+    courseDue = mCorrectedDateTime;
+    long min;
+    opt->courseTextAfterMinutes.ToLong(&min);
+    wxTimeSpan t(0, (int)min);
+    courseDue.Add(t);
+    dialog->scheduler->at(LogbookScheduler::COURSE, courseDue);
+  }
+
+  if (mCorrectedDateTime >= courseDue) appendCourseChange();
+}
+
+// the scheduler reached the deadline between two RMC sentences
+void Logbook::courseChangeDue() {
+  if (courseDue.IsValid() && opt->courseChange && courseChanged())
+    appendCourseChange();
+}
+
+void Logbook::appendCourseChange() {
+  dialog->scheduler->cancel(LogbookScheduler::COURSE);
+  courseDue = wxInvalidDateTime;
+  dialog->logbookTimerWindow->popUp();
+  courseChange = true;
+  appendRow(true, true);
+  courseChange = false;
+}
+
+// Statistics of the interval since the last entry, sent with every entry
+// so other plugins can show them; the interval starts again here.
+void Logbook::sendInstrumentStats(int row) {
+  InstrumentStats* stats[] = {&stSOG,       &stSTW,        &stDepth,
+                              &stHeading,   &stWindDir,    &stWindSpeed,
+                              &stWindSpeedA, &stPressure,   &stRPM1,
+                              &stRPM2};
+  const char* names[] = {"SOG",       "STW",           "Depth",
+                         "Heading",   "WindDirection", "WindSpeed",
+                         "WindSpeedApparent", "Pressure", "RPM1",
+                         "RPM2"};
+
+  wxJSONValue v;
+  v["Row"] = row;
+  for (unsigned int i = 0; i < WXSIZEOF(stats); i++) {
+    if (stats[i]->valid()) v[names[i]] = stats[i]->toJSON();
+    stats[i]->reset();
   }
+  wxJSONValue channels;
+  xdrChannels.toJSON(channels);
+  if (channels.Size()) v["Channels"] = channels;
+  xdrChannels.reset();
+
+  wxJSONWriter w(wxJSONWRITER_NONE);
+  wxString out;
+  w.Write(v, out);
+  SendPluginMessage("LOGBOOK_INSTRUMENT_STATS", out);
 }
 
 void Logbook::checkWayPoint(RMB rmb) {
@@ -2262,39 +2517,6 @@ void Logbook::checkWayPoint(RMB rmb) {
   lastWayPoint = rmb.From;
 }
 
-void Logbook::checkGuardChanged() {
-  if (dLastMinute == -1) {
-    dLastMinute = (long)mCorrectedDateTime.GetMinute() + 1;
-    return;
-  }
-
-  long hour, minute;
-  long m_minute = (long)mCorrectedDateTime.GetMinute();
-  long m_hour = (long)mCorrectedDateTime.GetHour();
-  bool append = false;
-
-  if (m_minute >= dLastMinute) {
-    for (int row = 0; row < dialog->m_gridCrewWake->GetNumberRows(); row++) {
-      for (int col = 2; col < dialog->m_gridCrewWake->GetNumberCols();
-           col += 2) {
-        wxString s = dialog->m_gridCrewWake->GetCellValue(row, col);
-        if (s.IsEmpty()) continue;
-        wxStringTokenizer tkz(s, ":");
-        tkz.GetNextToken().ToLong(&hour);
-        tkz.GetNextToken().ToLong(&minute);
-        if (hour != m_hour) continue;
-        if (minute == m_minute) append = true;
-      }
-    }
-    if (append) {
-      guardChange = true;
-      appendRow(true, true);
-      guardChange = false;
-    }
-    dLastMinute = m_minute + 1;
-  }
-}
-
 void Logbook::checkDistance() {
   if (oldPosition.latitude == 500) oldPosition = newPosition;
 
@@ -2312,22 +2534,8 @@ void Logbook::checkDistance() {
                    sin(fromlat) * sin(tolat)) *
               3443.9;
 
-  double factor = 1;
-  double tdistance = 1;
-
-  switch (opt->showDistanceChoice) {
-    case 0:
-      factor = 1;
-      break;
-    case 1:
-      factor = 1852;
-      break;
-    case 2:
-      factor = 1.852;
-      break;
-  }
-
-  tdistance = sm * factor;
+  double tdistance =
+      Units::fromBase(Units::DISTANCE, opt->showDistanceChoice, sm);
 
   if (tdistance >= opt->dEverySM && !dialog->logbookPlugIn->eventsEnabled) {
     dialog->logbookTimerWindow->popUp();
@@ -2375,22 +2583,8 @@ wxString Logbook::calculateDistance(wxString fromstr, wxString tostr) {
        3443.9;
   ////// code snippet from http://www2.nau.edu/~cvm/latlongdist.html#formats
 
-  double factor = 1;
-  double tdistance = 1;
-
-  switch (opt->showDistanceChoice) {
-    case 0:
-      factor = 1;
-      break;
-    case 1:
-      factor = 1852;
-      break;
-    case 2:
-      factor = 1.852;
-      break;
-  }
-
-  tdistance = sm * factor;
+  double tdistance =
+      Units::fromBase(Units::DISTANCE, opt->showDistanceChoice, sm);
 
   wxString ret =
       wxString::Format("%.2f %s", tdistance, opt->showDistance.c_str());
@@ -2443,9 +2637,11 @@ wxDouble Logbook::positionStringToDezimalModern(wxString pos) {
 }
 
 void Logbook::deleteRow(int row) {
+  if (!voyage.IsEmpty()) return;
   dialog->logGrids[dialog->m_notebook8->GetSelection()]->SelectRow(row, true);
-  int answer = wxMessageBox(wxString::Format(_("Delete Row Nr. %i ?"), row + 1),
-                            _("Confirm"), wxYES_NO | wxCANCEL, dialog);
+  int answer = wxMessageBox(
+      wxString::Format(_("Delete Row Nr. %i ?"), window.held() + row + 1),
+      _("Confirm"), wxYES_NO | wxCANCEL, dialog);
   if (answer == wxYES) {
     deleteRows();
     modified = true;
@@ -2464,15 +2660,18 @@ void Logbook::changeCellValue(int row, int col, int mode) {
 void Logbook::update() {
   if (!modified) return;
   modified = false;
+  // a voyage view is read only
+  if (!voyage.IsEmpty()) return;
 
   dialog->logGrids[0]->Refresh();
   dialog->logGrids[1]->Refresh();
   dialog->logGrids[2]->Refresh();
 
   int count;
-  if ((count = dialog->logGrids[0]->GetNumberRows()) == 0) {
+  if ((count = dialog->logGrids[0]->GetNumberRows()) == 0 && !window.held()) {
     wxFile f;
     f.Create(data_locn, true);
+    window.clear();
     return;
   }
 
@@ -2487,7 +2686,17 @@ void Logbook::update() {
       new wxTextOutputStream(output, wxEOL_NATIVE, wxConvUTF8);
 
   stream->WriteString("#1.2#\t" + logbookDescription + "\n");
+  if (!window.copy(newLocn, output)) {
+    output.Close();
+    wxRemoveFile(data_locn);
+    wxRename(newLocn, data_locn);
+    modified = true;
+    wxLogError("Logbook: rows kept on disk not copied, %s not saved",
+               data_locn.c_str());
+    return;
+  }
   for (int r = 0; r < count; r++) {
+    window.add(output.TellO());
     for (int g = 0; g < LOGGRIDS; g++) {
       for (int c = 0; c < dialog->logGrids[g]->GetNumberCols(); c++) {
         if (g == 1 && (c == LogbookHTML::HYDRO || c == LogbookHTML::WATERTE ||
@@ -2599,6 +2808,7 @@ void Logbook::update() {
     stream->WriteString(s);
     s = "";
   }
+  window.finish(output.TellO());
   output.Close();
 }
 
@@ -3102,10 +3312,18 @@ void Logbook::getModifiedCellValue(int grid, int row, int selCol, int col) {
 }
 
 void Logbook::deleteRows() {
+  if (!voyage.IsEmpty()) return;
   wxArrayInt rows;
   unsigned int rowsCount;
   int tab = dialog->m_notebook8->GetSelection();
 
+  // the totals are recalculated from the row before the first deleted
+  wxGridCellCoordsArray top = dialog->logGrids[tab]->GetSelectionBlockTopLeft();
+  if (window.held() &&
+      (dialog->logGrids[tab]->GetSelectedRows().Index(0) != wxNOT_FOUND ||
+       (top.GetCount() && top[0].GetRow() == 0)))
+    pageIn(1, true);
+
   rows = dialog->logGrids[tab]->GetSelectedRows();
   rowsCount = rows.GetCount();
 
@@ -3496,7 +3714,8 @@ bool Logbook::checkGPS(bool autoLine) {
 
     } else if (everySM && autoLine)
       sLogText += opt->everySMText + opt->everySMAmount + opt->showDistance;
-    else if ((dialog->timer->IsRunning() || opt->timerType != 0) && autoLine)
+    else if ((dialog->scheduler->intervalRunning() || opt->timerType != 0) &&
+             autoLine)
       sLogText += opt->ttext;
 
     return true;
@@ -3550,7 +3769,7 @@ class ActualWatch;
 void Logbook::SetGPSStatus(bool status) {
   if (!status) sDate = "";
 
-  if (status != gpsStatus) dialog->crewList->dayNow(false);
+  if (status != gpsStatus) dialog->crewList->dayNow();
 
   gpsStatus = status;
 }
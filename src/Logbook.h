@@ -38,6 +38,11 @@
 #include <wx/string.h>
 #include <wx/textfile.h>
 #include "ocpn_plugin.h"
+#include "InstrumentRecorder.h"
+#include "InstrumentStats.h"
+#include "NMEAArbiter.h"
+#include "RowWindow.h"
+#include "XDRChannels.h"
 #include "LogbookHTML.h"
 #include "nmea0183/nmea0183.h"
 
@@ -48,6 +53,7 @@ class Options;
 class LogbookDialog;
 class PBVEDialog;
 class ActualWatch;
+class VoyageView;
 
 class Logbook : public LogbookHTML
 {
@@ -112,21 +118,27 @@ private:
     bool		bCOW;
     double		dCOW;
     double		dCOG;
+    wxDateTime	courseDue;
     bool		mode;
     bool		courseChange;
     bool		everySM;
     bool		waypointArrived;
     bool		oldLogbook;
     bool		wimdaSentence;
-    double		minwindA;
-    double		avgwindA;
-    double		maxwindA;
-    double		minwindT;
-    double		avgwindT;
-    double		maxwindT;
     double      dVolume;
-    wxString	swindspeedsA;
-    wxString	swindspeedsT;
+    InstrumentStats	stSOG;
+    InstrumentStats	stSTW;
+    InstrumentStats	stDepth;
+    InstrumentStats	stHeading;
+    InstrumentStats	stWindDir;
+    InstrumentStats	stWindSpeed;
+    InstrumentStats	stWindSpeedA;
+    InstrumentStats	stPressure;
+    InstrumentStats	stRPM1;
+    InstrumentStats	stRPM2;
+    InstrumentRecorder* recorder;
+    NMEAArbiter arbiter;
+    XDRChannels xdrChannels;
 
     wxString	toSDMM ( int NEflag, double a, bool mode );
     wxString	toSDMMOpenCPN ( int NEflag, double a, bool hi_precision );
@@ -137,7 +149,9 @@ private:
     wxDouble	positionStringToDezimal( wxString pos );
     wxDouble	positionStringToDezimalModern( wxString pos );
     void		checkCourseChanged();
-    void		checkGuardChanged();
+    bool		courseChanged();
+    void		appendCourseChange();
+    void		sendInstrumentStats( int row );
     void		checkDistance();
     wxString	positionTraditional( int NEflag, double a, bool mode );
     wxString	positionGPSLike( int NEflag, double a, bool mode );
@@ -153,6 +167,7 @@ public:
                   BARO,HYDRO,TEMPAIR,TEMPWATER,WIND,WSPD,WINDR,WSPDR,CURRENT,CSPD,WAVE,SWELL,WEATHER,CLOUDS,VISIBILITY,
                   MOTOR,MOTORT,RPM1,MOTOR1,MOTOR1T,RPM2,FUEL,FUELT,SAILS,REEF,GENE,GENET,BANK1,BANK1T,BANK2,BANK2T,WATERM,WATERMT,WATERMO,WATER,WATERT,MREMARKS,ROUTEID,TRACKID
                 };
+    enum rollover { ROLLOVER_OFF,ROLLOVER_ROWS,ROLLOVER_SIZE,ROLLOVER_SEASON,ROLLOVER_VOYAGE };
 
     Options		*opt;
     wxArrayString	mergeList;
@@ -161,9 +176,9 @@ public:
     wxString	layout_locn;
     wxString	layoutODT;
     wxString	data_locn;
+    wxString	voyage;		// the files of a read only view, ';' separated
     bool		modified;
     wxDateTime	mCorrectedDateTime;
-    long		dLastMinute;
     PBVEDialog*	pvbe;
     bool		WP_skipped;
     wxString	lastWayPoint;
@@ -182,6 +197,7 @@ public:
     wxString	sDate;
     wxString	sTime;
     bool		guardChange;
+    bool		voyageEnded;
     bool		rpmSentence;
     wxDateTime	dtRPM;
     bool		engine1Manual;
@@ -205,12 +221,15 @@ public:
     void SetPosition( PlugIn_Position_Fix &pfix );
     void loadData();
     void loadSelectedData( wxString path );
+    void loadVoyage( const wxArrayString& paths );
     void loadDatanew();
     void deleteRow( int row );
     void appendRow( bool showlastline, bool autoline );
     void update();
     void clearNMEAData();
     void newLogbook();
+    wxString rollover( bool zero );
+    bool rolloverDue();
     void switchToActualLogbook();
     void selectLogbook();
     void changeCellValue( int row, int col, int offset );
@@ -225,7 +244,12 @@ public:
     void deleteRows();
     void setTrackToNewID( wxString target );
     void checkNMEADeviceIsOn();
+    void courseChangeDue();
     void resetEngineManualMode( int enginenumber );
+    int  pageIn( int rows, bool save = false );
+    bool trimWindow();
+    int  heldRows() const { return window.held(); }
+    InstrumentRecorder* instrumentRecorder() const { return recorder; }
 
     static wxString makeDateFromFile( wxString date, wxString dateformat );
     static wxString makeWatchtimeFromFile( wxString time, wxString timeformat );
@@ -238,10 +262,14 @@ private:
     void     setCellAlign( int i );
     wxString decimalToHours( double res, bool b );
     void     convertTo_1_2();
+    void     loadRow( int row, const wxString& line );
+    void     setLogbookFile( const wxString& path );
 
     wxString	logbookData_actual;
     bool		noAppend; // Old Logbook; append Rows not allowed
     wxString	logbookDescription;
+    RowWindow	window;
+    VoyageView*	voyageView;	// the open voyage the held rows come from
 };
 
 //////////////////////////////////////////////////////////////////////////////
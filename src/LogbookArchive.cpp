@@ -0,0 +1,349 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef WX_PRECOMP
+#include <wx/wx.h>
+#endif
+
+#include <wx/file.h>
+#include <wx/filename.h>
+#include <wx/jsonreader.h>
+#include <wx/jsonwriter.h>
+#include <wx/tokenzr.h>
+
+#include "LogbookArchive.h"
+#include "LogbookFile.h"
+#include "SealedLogbook.h"
+#include "VoyageView.h"
+
+#include <set>
+
+using namespace std;
+
+wxMutex LogbookArchive::building;
+wxCondition LogbookArchive::built(LogbookArchive::building);
+wxArrayString LogbookArchive::buildDirs;
+LogbookArchive::Worker* LogbookArchive::worker = NULL;
+wxMutex LogbookArchive::packing;
+wxArrayString LogbookArchive::packed;
+vector<LogbookArchive::Stamp> LogbookArchive::stamps;
+wxEvtHandler* LogbookArchive::handler = NULL;
+int LogbookArchive::readers = 0;
+
+// running totals carried from one line to the next
+static const char* totals[] = {
+    "DistanceTotal", "MotorTotal",     "Motor1Total",
+    "FuelTotal",     "GeneratorTotal", "Bank1Total",
+    "Bank2Total",    "WatermakerTotal", "WaterTotal"};
+
+// bumped whenever build() writes more, older summaries are built again
+static const int VERSION = 2;
+
+// the free text columns "Words" indexes for Contains
+static const char* indexed[] = {"Remarks", "Weather", "Sails",
+                                "MotorRemarks"};
+static const int INDEXED = sizeof(indexed) / sizeof(indexed[0]);
+
+// "h:mm" as written by the motor, generator and watermaker columns
+static long minutes(const wxString& s) {
+  if (s.IsEmpty()) return 0;
+  wxStringTokenizer tkz(s, ":", wxTOKEN_RET_EMPTY);
+  long h = 0, m = 0;
+  tkz.GetNextToken().ToLong(&h);
+  tkz.GetNextToken().Trim().ToLong(&m);
+  return h * 60 + m;
+}
+
+static double number(const wxString& s) {
+  wxString n = s.BeforeFirst(' ');
+  n.Replace(",", ".");
+  double x;
+  return n.ToCDouble(&x) ? x : 0;
+}
+
+wxString LogbookArchive::summaryPath(const wxString& archive,
+                                     const wxString& dir) {
+  wxFileName fn(archive);
+  fn.SetExt("json");
+  if (!dir.IsEmpty()) fn.SetPath(dir);
+  return fn.GetFullPath();
+}
+
+bool LogbookArchive::read(const wxString& archive, wxJSONValue& summary,
+                          const wxString& dir) {
+  wxString path = summaryPath(archive, dir);
+  if (!wxFileExists(path)) return false;
+  if (!dir.IsEmpty() && wxFileName(archive).GetModificationTime() >
+                            wxFileName(path).GetModificationTime())
+    return false;
+
+  wxFile f(path);
+  wxString text;
+  if (!f.IsOpened() || !f.ReadAll(&text, wxConvUTF8)) return false;
+
+  wxJSONReader reader;
+  return reader.Parse(text, &summary) == 0 && summary.HasMember("Rows") &&
+         summary["Version"].AsInt() >= VERSION;
+}
+
+bool LogbookArchive::compute(const wxString& path, wxJSONValue& summary) {
+  VoyageView view;
+  if (!view.add(path)) return false;
+
+  // the columns OverView sums, with its rules
+  int status = LogbookFile::column("Status");
+  int distance = LogbookFile::column("Distance");
+  int fuel = LogbookFile::column("Fuel");
+  int output = LogbookFile::column("WatermakerOutput");
+  static const char* hours[] = {"Motor", "Motor1", "Generator", "Watermaker"};
+
+  summary = wxJSONValue();
+  summary["Version"] = VERSION;
+  wxJSONValue& days = summary["Days"];
+  wxString start, end, day, seaDay;
+  double miles = 0, used = 0, made = 0;
+  long mins[4] = {0, 0, 0, 0};
+  int daysAtSea = 0, hourCol[4];
+  for (int i = 0; i < 4; i++) hourCol[i] = LogbookFile::column(hours[i]);
+  wxJSONValue& routes = summary["Routes"];
+  set<wxString> words[INDEXED];
+  int wordCol[INDEXED];
+  for (int i = 0; i < INDEXED; i++)
+    wordCol[i] = LogbookFile::column(indexed[i]);
+  wxArrayString record;
+  for (long row = 0; row < view.rows(); row++) {
+    if (!view.record(row, record)) continue;
+
+    // indexed before the timestamp check, a query looks at every row
+    wxString route = record[LogbookFile::ROUTE];
+    if (!routes.HasMember(route)) routes[route][0] = (int)row;
+    routes[route][1] = (int)row;
+    for (int i = 0; i < INDEXED; i++) {
+      wxStringTokenizer tkz(record[wordCol[i]].Lower(), " \t\r\n");
+      while (tkz.HasMoreTokens()) words[i].insert(tkz.GetNextToken());
+    }
+
+    wxString ts = LogbookFile::timestamp(record);
+    if (ts.IsEmpty()) continue;
+
+    if (start.IsEmpty() || ts < start) start = ts;
+    if (end.IsEmpty() || ts > end) end = ts;
+    if (record[LogbookFile::RDATE] != day) {
+      day = record[LogbookFile::RDATE];
+      if (!days.HasMember(day)) days[day] = (int)row;
+    }
+
+    double d = number(record[distance]);
+    if (record[status] == "S" && d > 0) {
+      miles += d;
+      if (seaDay != day) daysAtSea++;
+      seaDay = day;
+    }
+    for (int i = 0; i < 4; i++) mins[i] += minutes(record[hourCol[i]]);
+    if (!record[fuel].StartsWith("+")) used += number(record[fuel]);
+    made += number(record[output]);
+  }
+  summary["Rows"] = (int)view.rows();
+  summary["Start"] = start;
+  summary["End"] = end;
+
+  wxJSONValue& w = summary["Words"];
+  for (int i = 0; i < INDEXED; i++) {
+    w[indexed[i]] = wxJSONValue(wxJSONTYPE_ARRAY);
+    for (set<wxString>::iterator it = words[i].begin(); it != words[i].end();
+         ++it)
+      w[indexed[i]].Append(*it);
+  }
+
+  wxJSONValue& sums = summary["Sums"];
+  sums["Distance"] = miles;
+  for (int i = 0; i < 4; i++) sums[hours[i]] = (int)mins[i];
+  sums["Fuel"] = used;
+  sums["WatermakerOutput"] = made;
+  sums["DaysAtSea"] = daysAtSea;
+
+  wxJSONValue& t = summary["Totals"];
+  if (view.rows() > 0 && view.record(view.rows() - 1, record))
+    for (unsigned int i = 0; i < sizeof(totals) / sizeof(totals[0]); i++)
+      t[totals[i]] = record[LogbookFile::column(totals[i])];
+  return true;
+}
+
+bool LogbookArchive::build(const wxString& archive, const wxString& dir) {
+  wxString path = summaryPath(archive, dir);
+  wxString into = wxFileName(path).GetPath();
+  {
+    wxMutexLocker lock(building);
+    while (buildDirs.Index(into) != wxNOT_FOUND) built.Wait();
+    buildDirs.Add(into);
+  }
+
+  wxJSONValue summary;
+  bool ok = compute(archive, summary) &&
+            wxFileName::Mkdir(into, wxS_DIR_DEFAULT, wxPATH_MKDIR_FULL);
+  if (ok) {
+    wxString text;
+    wxJSONWriter w;
+    w.Write(summary, text);
+
+    // write aside and rename, a reader never sees half a summary
+    wxFile f;
+    ok = f.Create(path + ".tmp", true) && f.Write(text, wxConvUTF8);
+    f.Close();
+    ok = ok && wxRenameFile(path + ".tmp", path, true);
+  }
+
+  wxMutexLocker lock(building);
+  buildDirs.Remove(into);
+  built.Broadcast();
+  return ok;
+}
+
+void LogbookArchive::summarize(const wxString& dataDir, bool seal) {
+  wxArrayString files, all = LogbookFile::archives(dataDir);
+  wxJSONValue summary;
+  for (unsigned int i = 0; i < all.Count(); i++)
+    if (!read(all[i], summary) ||
+        (seal && !SealedLogbook::isSealed(all[i])))
+      files.Add(all[i]);
+  // a pass still running is ended, this one takes over its files
+  stop();
+  if (files.IsEmpty()) return;
+
+  handler = new wxEvtHandler;
+  worker = new Worker(files, seal);
+  if (worker->Run() != wxTHREAD_NO_ERROR) {
+    delete worker;
+    worker = NULL;
+    delete handler;
+    handler = NULL;
+  }
+}
+
+void LogbookArchive::stop() {
+  if (!worker) return;
+  worker->Delete();  // waits for the archive being worked on
+  delete worker;
+  worker = NULL;
+
+  // what is packed already goes in now, the queued swap goes with handler
+  swap();
+  wxMutexLocker lock(packing);
+  delete handler;
+  handler = NULL;
+}
+
+void LogbookArchive::beginRead() {
+  wxMutexLocker lock(packing);
+  readers++;
+}
+
+// the last reader lets a waiting swap go ahead
+void LogbookArchive::endRead() {
+  wxMutexLocker lock(packing);
+  if (--readers == 0 && !packed.IsEmpty() && handler)
+    handler->CallAfter([]() { swap(); });
+}
+
+LogbookArchive::Stamp LogbookArchive::stamp(const wxString& path) {
+  wxFileName fn(path);
+  Stamp s;
+  s.size = fn.GetSize();
+  s.time = fn.GetModificationTime();
+  return s;
+}
+
+// UI thread only, waits for the readers to close their archives
+void LogbookArchive::swap() {
+  wxArrayString files;
+  vector<Stamp> when;
+  {
+    wxMutexLocker lock(packing);
+    if (readers > 0) return;
+    files = packed;
+    packed.Clear();
+    when.swap(stamps);
+  }
+  for (unsigned int i = 0; i < files.Count(); i++) {
+    // changed since it was packed, e.g. by the unit converter
+    Stamp now = stamp(files[i]);
+    if (!wxFileExists(files[i]) || now.size != when[i].size ||
+        now.time != when[i].time)
+      wxRemoveFile(SealedLogbook::sealedPath(files[i]) + ".tmp");
+    else
+      SealedLogbook::commit(files[i]);
+  }
+}
+
+wxThread::ExitCode LogbookArchive::Worker::Entry() {
+  for (unsigned int i = 0; i < files.Count() && !TestDestroy(); i++) {
+    wxJSONValue summary;
+    if (!read(files[i], summary)) build(files[i]);
+    if (seal && !SealedLogbook::isSealed(files[i])) {
+      Stamp before = stamp(files[i]);
+      if (!SealedLogbook::pack(files[i])) continue;
+      wxMutexLocker lock(packing);
+      packed.Add(files[i]);
+      stamps.push_back(before);
+      if (packed.Count() == 1 && readers == 0)
+        handler->CallAfter([]() { swap(); });
+    }
+  }
+  return (ExitCode)0;
+}
+
+bool LogbookArchive::mayContain(const wxString& archive, const wxString& start,
+                                const wxString& end) {
+  if (start.IsEmpty() && end.IsEmpty()) return true;
+
+  wxJSONValue summary;
+  if (!read(archive, summary)) return true;  // not built yet, look inside
+  if (summary["Rows"].AsInt() == 0) return false;
+  if (!end.IsEmpty() && summary["Start"].AsString() > end) return false;
+  if (!start.IsEmpty() && summary["End"].AsString() < start) return false;
+  return true;
+}
+
+bool LogbookArchive::mayMatch(const wxString& archive,
+                              const vector<pair<int, wxString> >& where,
+                              const vector<pair<int, wxString> >& contains) {
+  if (where.empty() && contains.empty()) return true;
+
+  wxJSONValue summary;
+  if (!read(archive, summary)) return true;
+  for (unsigned int i = 0; i < where.size(); i++)
+    if (where[i].first == LogbookFile::ROUTE &&
+        !summary["Routes"].HasMember(where[i].second))
+      return false;
+
+  // text without blanks can only be found inside a single word
+  for (unsigned int i = 0; i < contains.size(); i++) {
+    wxString name = LogbookFile::columnName(contains[i].first);
+    const wxString& text = contains[i].second;
+    if (text.IsEmpty() || !summary["Words"].HasMember(name) ||
+        text.find_first_of(" \t\r\n") != wxString::npos)
+      continue;
+    wxJSONValue& words = summary["Words"][name];
+    bool found = false;
+    for (int j = 0; j < words.Size() && !found; j++)
+      found = words[j].AsString().Find(text) != wxNOT_FOUND;
+    if (!found) return false;
+  }
+  return true;
+}
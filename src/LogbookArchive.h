@@ -0,0 +1,117 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#ifndef _LOGBOOKARCHIVE_H_
+#define _LOGBOOKARCHIVE_H_
+
+#ifndef  WX_PRECOMP
+#include "wx/wx.h"
+#endif //precompiled headers
+
+#include <wx/arrstr.h>
+#include <wx/jsonval.h>
+#include <wx/thread.h>
+
+#include <utility>
+#include <vector>
+
+/**
+ * Summary of an archived logbook (until_*_logbook.txt), kept beside it as
+ * until_*_logbook.json:
+ *
+ *   "Rows"            number of logbook lines
+ *   "Start","End"     first and last ISO timestamp
+ *   "Days"            { "2021-06-30" : first row of that day, ... }
+ *   "Routes"          { route : [ first row, last row ], ... }
+ *   "Words"           { column : [ word, ... ] }, the distinct lower case
+ *                     words of the free text columns
+ *   "Totals"          the running totals of the last line
+ *   "Sums"            what OverView adds up: "Distance" (sailed, nm),
+ *                     "Motor", "Motor1", "Generator", "Watermaker"
+ *                     (minutes), "Fuel", "WatermakerOutput", "DaysAtSea"
+ *   "Version"         summaries of an older version are built again
+ *
+ * Archives never change, so the summary is built once, in the background
+ * after a rollover. Queries use it to pass over archives outside their
+ * time range, or without the route or words asked for, without opening
+ * them. Data directories of other plugins are not written to: their
+ * summaries go into a cache directory given as dir, where a summary older
+ * than its archive counts as missing. build() runs for one directory of
+ * summaries at a time, different directories are built in parallel.
+ * With seal set the same pass turns the archives into SealedLogbook
+ * files: they are packed on the worker and swapped in on the UI thread
+ * once no VoyageView (OverView, the voyage in the grids, queries) has an
+ * archive open; every view counts itself as a reader. stop() ends the
+ * pass, the plugin calls it before it unloads.
+ */
+class LogbookArchive
+{
+public:
+    static wxString summaryPath( const wxString& archive,
+                                 const wxString& dir = wxEmptyString );
+    static bool     read( const wxString& archive, wxJSONValue& summary,
+                          const wxString& dir = wxEmptyString );
+    static bool     compute( const wxString& path, wxJSONValue& summary );
+    static bool     build( const wxString& archive,
+                           const wxString& dir = wxEmptyString );
+    static void     summarize( const wxString& dataDir, bool seal );
+    static void     stop();
+    static void     beginRead();
+    static void     endRead();
+    static bool     mayContain( const wxString& archive, const wxString& start,
+                                const wxString& end );
+    static bool     mayMatch( const wxString& archive,
+                              const std::vector<std::pair<int, wxString> >& where,
+                              const std::vector<std::pair<int, wxString> >& contains );
+
+private:
+    class Worker : public wxThread
+    {
+    public:
+        Worker( const wxArrayString& a, bool s ) : wxThread( wxTHREAD_JOINABLE ), files( a ), seal( s ) {}
+        virtual ExitCode Entry();
+        wxArrayString files;
+        bool          seal;
+    };
+
+    // size and time, a rewrite within the same second still shows
+    struct Stamp
+    {
+        wxULongLong   size;
+        wxDateTime    time;
+    };
+
+    static Stamp    stamp( const wxString& path );
+    static void     swap();
+
+    // the directories summaries are being written to
+    static wxMutex  building;
+    static wxCondition built;
+    static wxArrayString buildDirs;
+    static Worker*  worker;
+
+    // packed by the worker, waiting for swap()
+    static wxMutex  packing;
+    static wxArrayString packed;
+    static std::vector<Stamp> stamps;
+    static wxEvtHandler* handler;
+    static int      readers;
+};
+#endif
@@ -0,0 +1,419 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef WX_PRECOMP
+#include <wx/wx.h>
+#endif
+
+#include <wx/cmdline.h>
+#include <wx/filename.h>
+#include <wx/jsonwriter.h>
+#include <wx/textfile.h>
+#include <wx/tokenzr.h>
+#include <wx/txtstrm.h>
+#include <wx/wfstream.h>
+
+#include "ExportSink.h"
+#include "FleetOverview.h"
+#include "LogbookArchive.h"
+#include "LogbookCli.h"
+#include "LogbookFile.h"
+#include "SealedLogbook.h"
+#include "VoyageView.h"
+
+using namespace std;
+
+wxIMPLEMENT_APP_CONSOLE(LogbookCli);
+
+// side files of a data directory, written as <name>.csv
+static const char* tables[] = {"crewlist",  "watchlist", "boat",   "equipment",
+                               "service",   "buyparts",  "repairs"};
+
+// running totals of the last line, as in LogbookArchive
+static const char* totals[] = {
+    "DistanceTotal", "MotorTotal",     "Motor1Total",
+    "FuelTotal",     "GeneratorTotal", "Bank1Total",
+    "Bank2Total",    "WatermakerTotal", "WaterTotal"};
+
+static const wxCmdLineEntryDesc cmdLine[] = {
+    {wxCMD_LINE_SWITCH, "h", "help", "show this help", wxCMD_LINE_VAL_NONE,
+     wxCMD_LINE_OPTION_HELP},
+    {wxCMD_LINE_OPTION, "j", "jobs", "directories worked on at once",
+     wxCMD_LINE_VAL_NUMBER},
+    {wxCMD_LINE_OPTION, "o", "out", "output directory (default .)"},
+    {wxCMD_LINE_OPTION, NULL, "from", "first ISO timestamp exported"},
+    {wxCMD_LINE_OPTION, NULL, "to", "last ISO timestamp exported"},
+    {wxCMD_LINE_OPTION, NULL, "format", "tables written, csv,xml,ods (csv)"},
+    {wxCMD_LINE_SWITCH, NULL, "in-place",
+     "let --seal, --unseal and --units rewrite the data directories"},
+    {wxCMD_LINE_SWITCH, NULL, "seal", "seal the archives first"},
+    {wxCMD_LINE_SWITCH, NULL, "unseal", "unseal the archives first"},
+    {wxCMD_LINE_OPTION, NULL, "units",
+     "convert the logbooks first, e.g. distance=km,windspeed=m/s"},
+    {wxCMD_LINE_PARAM, NULL, NULL, "datadir", wxCMD_LINE_VAL_STRING,
+     wxCMD_LINE_PARAM_MULTIPLE},
+    {wxCMD_LINE_NONE}};
+
+static wxString csvField(const wxString& s) {
+  if (s.find_first_of(",\"\r\n") == wxString::npos) return s;
+  wxString q = s;
+  q.Replace("\"", "\"\"");
+  return "\"" + q + "\"";
+}
+
+static wxString csvLine(const wxArrayString& fields) {
+  wxString l;
+  for (unsigned int i = 0; i < fields.Count(); i++)
+    l += (i ? "," : "") + csvField(fields[i]);
+  return l + "\n";
+}
+
+// the leading number of a cell, values may carry a unit ("12.4 kts")
+static double number(const wxString& s) {
+  wxString n = s.BeforeFirst(' ');
+  n.Replace(",", ".");
+  double x;
+  return n.ToCDouble(&x) ? x : 0;
+}
+
+bool LogbookCli::OnInit() {
+  wxCmdLineParser parser(cmdLine, argc, argv);
+  if (parser.Parse() != 0) return false;
+
+  jobs = wxThread::GetCPUCount();
+  parser.Found("jobs", &jobs);
+  if (jobs < 1) jobs = 1;
+  if (!parser.Found("out", &outDir)) outDir = ".";
+  wxString s;
+  if (parser.Found("from", &s)) from = LogbookFile::isoTimestamp(s);
+  if (parser.Found("to", &s)) to = LogbookFile::isoTimestamp(s);
+  mode = parser.Found("seal") ? SEAL : parser.Found("unseal") ? UNSEAL : KEEP;
+  if (parser.Found("units", &s) && !units.parseTarget(s)) {
+    wxFprintf(stderr, "logbook-cli: --units %s not understood\n", s);
+    return false;
+  }
+  if ((mode != KEEP || units.hasTarget()) && !parser.Found("in-place")) {
+    wxFprintf(stderr,
+              "logbook-cli: --seal, --unseal and --units rewrite the data "
+              "directories, add --in-place\n");
+    return false;
+  }
+  formats = wxSplit(parser.Found("format", &s) ? s : wxString("csv"), ',');
+  for (unsigned int i = 0; i < formats.Count(); i++)
+    if (formats[i] != "csv" && formats[i] != "xml" && formats[i] != "ods") {
+      wxFprintf(stderr, "logbook-cli: --format %s not understood\n",
+                formats[i]);
+      return false;
+    }
+
+  wxArrayString names;
+  for (size_t i = 0; i < parser.GetParamCount(); i++) {
+    Job job;
+    job.dataDir = parser.GetParam(i);
+    job.ok = false;
+
+    // one output directory per data directory, named after it
+    wxFileName dn = wxFileName::DirName(job.dataDir);
+    wxString name = dn.GetDirCount() ? dn.GetDirs().Last() : "data";
+    for (int n = 2; names.Index(name) != wxNOT_FOUND; n++)
+      name = wxString::Format("%s-%i", dn.GetDirs().Last(), n);
+    names.Add(name);
+    job.outDir = outDir + wxFileName::GetPathSeparator() + name;
+    work.push_back(job);
+  }
+  next = 0;
+  return true;
+}
+
+int LogbookCli::OnRun() {
+  vector<Worker*> workers;
+  for (long i = 0; i < jobs && i < (long)work.size(); i++) {
+    Worker* w = new Worker(this);
+    if (w->Run() != wxTHREAD_NO_ERROR)
+      delete w;
+    else
+      workers.push_back(w);
+  }
+  // no thread came up, do it on this one
+  if (workers.empty())
+    for (Job* job; (job = nextJob()) != NULL;) job->ok = process(*job);
+  for (size_t i = 0; i < workers.size(); i++) {
+    workers[i]->Wait();
+    delete workers[i];
+  }
+
+  int failed = 0;
+  for (size_t i = 0; i < work.size(); i++)
+    if (!work[i].ok) {
+      wxFprintf(stderr, "logbook-cli: %s failed\n", work[i].dataDir);
+      failed++;
+    }
+  if (!writeFleet()) failed++;
+  return failed ? 1 : 0;
+}
+
+wxThread::ExitCode LogbookCli::Worker::Entry() {
+  for (Job* job; (job = cli->nextJob()) != NULL;) job->ok = cli->process(*job);
+  return (ExitCode)0;
+}
+
+LogbookCli::Job* LogbookCli::nextJob() {
+  wxCriticalSectionLocker locker(lock);
+  return next < work.size() ? &work[next++] : NULL;
+}
+
+bool LogbookCli::process(Job& job) {
+  if (!wxDirExists(job.dataDir) ||
+      !wxFileName::Mkdir(job.outDir, wxS_DIR_DEFAULT, wxPATH_MKDIR_FULL))
+    return false;
+
+  bool ok = true;
+  wxArrayString archives = LogbookFile::archives(job.dataDir);
+  for (unsigned int i = 0; i < archives.Count(); i++) {
+    bool done = true;
+    if (mode == SEAL && !SealedLogbook::isSealed(archives[i]))
+      done = SealedLogbook::seal(archives[i]);
+    else if (mode == UNSEAL && SealedLogbook::isSealed(archives[i]))
+      done = SealedLogbook::unseal(archives[i]);
+    if (!done)
+      wxFprintf(stderr, "logbook-cli: %s not %s\n", archives[i],
+                mode == SEAL ? "sealed" : "unsealed");
+    ok = done && ok;
+  }
+
+  if (units.hasTarget()) ok = units.convertDir(job.dataDir) && ok;
+  ok = exportLogbook(job) && ok;
+  wxString sep = wxFileName::GetPathSeparator();
+  for (unsigned int i = 0; i < sizeof(tables) / sizeof(tables[0]); i++) {
+    wxString in = job.dataDir + sep + tables[i] + ".txt";
+    if (wxFileExists(in))
+      ok = exportTable(in, job.outDir + sep + tables[i]) && ok;
+  }
+  return ok;
+}
+
+// a sink per --format for base.<format>
+void LogbookCli::openSinks(const wxString& base, const wxString& table,
+                           const vector<int>& types,
+                           vector<ExportSink*>& sinks) {
+  for (unsigned int i = 0; i < formats.Count(); i++)
+    if (formats[i] == "csv")
+      sinks.push_back(new CSVSink(base + ".csv", false));
+    else if (formats[i] == "xml")
+      sinks.push_back(new XMLSink(base + ".xml"));
+    else
+      sinks.push_back(new ODSSink(base + ".ods", "yyyymmdd", table, types));
+}
+
+bool LogbookCli::exportLogbook(Job& job) {
+  wxString sep = wxFileName::GetPathSeparator();
+  wxArrayString files = LogbookFile::archives(job.dataDir);
+  files.Add(job.dataDir + sep + "logbook.txt");
+
+  VoyageView view;
+  for (unsigned int i = 0; i < files.Count(); i++)
+    if (wxFileExists(files[i]) &&
+        LogbookArchive::mayContain(files[i], from, to))
+      view.add(files[i]);
+
+  // the file name goes in front, date and time are typed for ODS
+  vector<int> types(LogbookFile::RTIME + 2, ODSWriter::AUTO);
+  types[LogbookFile::RDATE + 1] = ODSWriter::DATE;
+  types[LogbookFile::RTIME + 1] = ODSWriter::TIME;
+  vector<ExportSink*> sinks;
+  openSinks(job.outDir + sep + "logbook", "Logbook", types, sinks);
+
+  ExportRecord out;
+  out.row = 0;
+  out.height = 0;
+  out.cells.Add("Logbook");
+  for (int c = 0; c < LogbookFile::COLUMNS; c++)
+    out.cells.Add(LogbookFile::columnName(c));
+  bool ok = true;
+  for (size_t i = 0; i < sinks.size(); i++)
+    ok = sinks[i]->begin(out.cells) && ok;
+
+  // the same sums OverView shows per logbook
+  int statusCol = LogbookFile::column("Status");
+  int distanceCol = LogbookFile::column("Distance");
+  int sogCol = LogbookFile::column("SOG");
+
+  wxJSONValue& logbooks = job.overview["Logbooks"];
+  double fleetDistance = 0, fleetSog = 0;
+  long fleetRows = 0;
+  wxString fleetStart, fleetEnd;
+  wxArrayString record, last;
+  for (int seg = 0; seg < view.segments(); seg++) {
+    long first = view.segmentFirstRow(seg);
+    long end = (seg + 1 < view.segments()) ? view.segmentFirstRow(seg + 1)
+                                           : view.rows();
+    wxString name = view.segmentName(seg);
+    wxString start, stop;
+    wxArrayString routes;
+    double distance = 0, sog = 0;
+    long rows = 0;
+    for (long row = first; row < end; row++) {
+      if (!view.record(row, record)) continue;
+      wxString ts = LogbookFile::timestamp(record);
+      if ((!from.IsEmpty() && ts < from) || (!to.IsEmpty() && ts > to))
+        continue;
+
+      out.cells = record;
+      out.cells.Insert(name, 0);
+      for (size_t i = 0; i < sinks.size(); i++) sinks[i]->write(out);
+      out.row++;
+
+      rows++;
+      if (start.IsEmpty() || ts < start) start = ts;
+      if (stop.IsEmpty() || ts > stop) stop = ts;
+      if (routes.Index(record[LogbookFile::ROUTE]) == wxNOT_FOUND)
+        routes.Add(record[LogbookFile::ROUTE]);
+      if (record[statusCol] == "S") distance += number(record[distanceCol]);
+      sog = wxMax(sog, number(record[sogCol]));
+      last = record;
+    }
+    if (rows == 0) continue;
+
+    wxJSONValue l;
+    l["File"] = name;
+    l["Rows"] = (int)rows;
+    l["Start"] = start;
+    l["End"] = stop;
+    l["Routes"] = (int)routes.Count();
+    l["Distance"] = distance;
+    l["SOGPeak"] = sog;
+    for (unsigned int i = 0; i < sizeof(totals) / sizeof(totals[0]); i++)
+      l["Totals"][totals[i]] = last[LogbookFile::column(totals[i])];
+    logbooks.Append(l);
+
+    fleetRows += rows;
+    fleetDistance += distance;
+    fleetSog = wxMax(fleetSog, sog);
+    if (fleetStart.IsEmpty() || start < fleetStart) fleetStart = start;
+    if (fleetEnd.IsEmpty() || stop > fleetEnd) fleetEnd = stop;
+  }
+  for (size_t i = 0; i < sinks.size(); i++) {
+    ok = sinks[i]->end() && ok;
+    delete sinks[i];
+  }
+
+  job.overview["DataDir"] = job.dataDir;
+  job.overview["Rows"] = (int)fleetRows;
+  job.overview["Start"] = fleetStart;
+  job.overview["End"] = fleetEnd;
+  job.overview["Distance"] = fleetDistance;
+  job.overview["SOGPeak"] = fleetSog;
+
+  wxArrayString fleet;
+  fleet.Add(wxFileName(job.outDir).GetFullName());
+  fleet.Add(wxString::Format("%i", logbooks.Size()));
+  fleet.Add(wxString::Format("%ld", fleetRows));
+  fleet.Add(fleetStart);
+  fleet.Add(fleetEnd);
+  fleet.Add(wxString::FromCDouble(fleetDistance, 1));
+  fleet.Add(wxString::FromCDouble(fleetSog, 1));
+  for (unsigned int i = 0; i < sizeof(totals) / sizeof(totals[0]); i++)
+    fleet.Add(last.IsEmpty() ? wxString()
+                             : last[LogbookFile::column(totals[i])]);
+  job.fleetLine = csvLine(fleet);
+
+  wxString text;
+  wxJSONWriter w;
+  w.Write(job.overview, text);
+  wxFile f;
+  return f.Create(job.outDir + sep + "overview.json", true) &&
+         f.Write(text, wxConvUTF8) && ok;
+}
+
+// the side files have no header, their columns are labelled by number
+bool LogbookCli::exportTable(const wxString& in, const wxString& base) {
+  wxTextFile txt;
+  if (!txt.Open(in)) return false;
+
+  // tab separated, every field written with a trailing blank
+  vector<ExportRecord> rows;
+  size_t columns = 0;
+  for (size_t i = 0; i < txt.GetLineCount(); i++) {
+    const wxString& line = txt[i];
+    if (line.IsEmpty() || line.StartsWith("#1.2#")) continue;
+    ExportRecord r;
+    r.row = (int)rows.size();
+    r.height = 0;
+    wxStringTokenizer tkz(line, "\t", wxTOKEN_RET_EMPTY);
+    while (tkz.HasMoreTokens())
+      r.cells.Add(LogbookFile::restore(tkz.GetNextToken()));
+    columns = wxMax(columns, r.cells.Count());
+    rows.push_back(r);
+  }
+  wxArrayString labels;
+  for (size_t c = 1; c <= columns; c++)
+    labels.Add(wxString::Format("%i", (int)c));
+
+  vector<ExportSink*> sinks;
+  openSinks(base, wxFileName(base).GetName(), vector<int>(), sinks);
+  bool ok = true;
+  for (size_t s = 0; s < sinks.size(); s++) {
+    ok = sinks[s]->begin(labels) && ok;
+    for (size_t i = 0; i < rows.size(); i++) sinks[s]->write(rows[i]);
+    ok = sinks[s]->end() && ok;
+    delete sinks[s];
+  }
+  return ok;
+}
+
+bool LogbookCli::writeFleet() {
+  if (!wxFileName::Mkdir(outDir, wxS_DIR_DEFAULT, wxPATH_MKDIR_FULL))
+    return false;
+  wxFileOutputStream output(outDir + wxFileName::GetPathSeparator() +
+                            "fleet.csv");
+  if (!output.IsOk()) return false;
+  wxTextOutputStream stream(output, wxEOL_UNIX, wxConvUTF8);
+
+  wxArrayString head;
+  head.Add("Boat");
+  head.Add("Logbooks");
+  head.Add("Rows");
+  head.Add("Start");
+  head.Add("End");
+  head.Add("Distance");
+  head.Add("SOGPeak");
+  for (unsigned int i = 0; i < sizeof(totals) / sizeof(totals[0]); i++)
+    head.Add(totals[i]);
+  stream.WriteString(csvLine(head));
+
+  // in the order given, whichever thread finished first
+  wxArrayString done;
+  for (size_t i = 0; i < work.size(); i++)
+    if (work[i].ok) {
+      stream.WriteString(work[i].fleetLine);
+      done.Add(work[i].dataDir);
+    }
+
+  // the whole of every logbook, independent of --from/--to
+  wxString text;
+  wxJSONWriter w;
+  w.Write(FleetOverview::fleet(done, FleetOverview::ALL, jobs,
+                               outDir + wxFileName::GetPathSeparator() +
+                                   "summaries"),
+          text);
+  wxFile f;
+  return f.Create(outDir + wxFileName::GetPathSeparator() + "fleet.json",
+                  true) &&
+         f.Write(text, wxConvUTF8);
+}
@@ -0,0 +1,118 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#ifndef _LOGBOOKCLI_H_
+#define _LOGBOOKCLI_H_
+
+#ifndef  WX_PRECOMP
+#include "wx/wx.h"
+#endif //precompiled headers
+
+#include <wx/arrstr.h>
+#include <wx/jsonval.h>
+#include <wx/thread.h>
+
+#include <vector>
+
+#include "UnitConverter.h"
+
+class ExportSink;
+
+/**
+ * logbook-cli, the plugin's data files without OpenCPN and without a
+ * display:
+ *
+ *   logbook-cli [--jobs n] [--out dir] [--from iso] [--to iso]
+ *               [--format csv,xml,ods] [--in-place [--seal | --unseal]
+ *               [--units spec]] datadir...
+ *
+ * For every data directory it writes into <out>/<name of the directory>/
+ *
+ *   logbook.csv       archives and active logbook as one table, named
+ *                     columns as in LogbookFile
+ *   crewlist.csv, watchlist.csv, boat.csv, equipment.csv, service.csv,
+ *   buyparts.csv, repairs.csv
+ *   overview.json     per logbook file: rows, first/last timestamp,
+ *                     distance, top SOG and the running totals
+ *
+ * and one line per directory into <out>/fleet.csv, with the
+ * FleetOverview of all of them in <out>/fleet.json; archive summaries
+ * missing in a data directory are built into <out>/summaries. The tables
+ * are written by the plugin's own export sinks, --format picks them
+ * (.csv, .xml, .ods). Directories are worked off by --jobs threads, by
+ * default one per core.
+ *
+ * --seal/--unseal convert the archives before reading them, --units
+ * converts the logbooks to other units (see UnitConverter), e.g.
+ * "distance=km,boatspeed=kmh,windspeed=m/s,depth=m,temperature=C". Both
+ * rewrite the data directories themselves and are only taken together
+ * with --in-place; a failed conversion fails the directory.
+ *
+ * Only the grid free sources are built in. The HTML/ODT/KML exports and
+ * OverView render from the dialog grids and stay in the plugin.
+ */
+class LogbookCli : public wxAppConsole
+{
+public:
+    virtual bool OnInit();
+    virtual int  OnRun();
+
+    enum convert { KEEP, SEAL, UNSEAL };
+
+    struct Job
+    {
+        wxString      dataDir;
+        wxString      outDir;
+        wxJSONValue   overview;
+        wxString      fleetLine;
+        bool          ok;
+    };
+
+private:
+    class Worker : public wxThread
+    {
+    public:
+        Worker( LogbookCli* c ) : wxThread( wxTHREAD_JOINABLE ), cli( c ) {}
+        virtual ExitCode Entry();
+        LogbookCli*   cli;
+    };
+
+    Job*      nextJob();
+    bool      process( Job& job );
+    bool      exportLogbook( Job& job );
+    bool      exportTable( const wxString& in, const wxString& out );
+    void      openSinks( const wxString& base, const wxString& table,
+                         const std::vector<int>& types,
+                         std::vector<ExportSink*>& sinks );
+    bool      writeFleet();
+
+    wxArrayString   dirs;
+    wxString        outDir;
+    wxString        from, to;
+    convert         mode;
+    wxArrayString   formats;
+    UnitConverter   units;
+    long            jobs;
+
+    std::vector<Job> work;
+    size_t          next;
+    wxCriticalSection lock;
+};
+#endif
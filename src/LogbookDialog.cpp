@@ -61,6 +61,9 @@
 #include <wx/tokenzr.h>
 #include <wx/treectrl.h>
 
+#include <algorithm>
+
+#include "ExportTemplates.h"
 #include "Options.h"
 #include "icons.h"
 #include "logbook_pi.h"
@@ -74,9 +77,14 @@
 #include "down.xpm"
 #include "forward.xpm"
 #include "LogbookDialog.h"
+#include "ExportJob.h"
 #include "Logbook.h"
+#include "LogbookScheduler.h"
+#include "SealedLogbook.h"
 #include "up.xpm"
 
+using namespace std;
+
 //#define PBVE_DEBUG 1
 //////////////////////////////////////////////////////////////////////////
 
@@ -89,16 +97,19 @@ ArrayTimerIndividualH TimerIndividualH;
 ArrayTimerIndividualM TimerIndividualM;
 wxArrayString TimerIndidividualAMPM;
 
-LogbookDialog::LogbookDialog(logbookkonni_pi* d, wxTimer* t, LogbookTimer* lt,
+LogbookDialog::LogbookDialog(logbookkonni_pi* d, LogbookTimer* lt,
                              wxWindow* parent, wxWindowID id,
                              const wxString& title, const wxPoint& pos,
                              const wxSize& size, long style)
     : wxDialog(parent, id, title, pos, size, style) {
   logbook = NULL;
   logbookPlugIn = d;
-  timer = t;
+  scheduler = NULL;
+  exportJob = NULL;
+  pagePending = false;
+  completeLength = 0;
+  completing = false;
   logbookTimerWindow = lt;
-  GPSTimer = NULL;
   //	wxInitAllImageHandlers();
 
   this->SetSizeHints(wxSize(-1, -1), wxDefaultSize);
@@ -479,7 +490,7 @@ LogbookDialog::LogbookDialog(logbookkonni_pi* d, wxTimer* t, LogbookTimer* lt,
                             wxDefaultSize, wxALWAYS_SHOW_SB);
 
   // Grid
-  m_gridGlobal->CreateGrid(0, 14);
+  m_gridGlobal->SetTable(new myGridStringTable(0, 14), true);
   m_gridGlobal->EnableEditing(true);
   m_gridGlobal->EnableGridLines(true);
   m_gridGlobal->EnableDragGridSize(false);
@@ -595,7 +606,7 @@ LogbookDialog::LogbookDialog(logbookkonni_pi* d, wxTimer* t, LogbookTimer* lt,
                              wxDefaultSize, wxALWAYS_SHOW_SB);
 
   // Grid
-  m_gridWeather->CreateGrid(0, 15);
+  m_gridWeather->SetTable(new myGridStringTable(0, 15), true);
   m_gridWeather->EnableEditing(true);
   m_gridWeather->EnableGridLines(true);
   m_gridWeather->EnableDragGridSize(false);
@@ -668,7 +679,7 @@ LogbookDialog::LogbookDialog(logbookkonni_pi* d, wxTimer* t, LogbookTimer* lt,
                                 wxDefaultSize, wxALWAYS_SHOW_SB);
 
   // Grid
-  m_gridMotorSails->CreateGrid(0, 24);
+  m_gridMotorSails->SetTable(new myGridStringTable(0, 24), true);
   m_gridMotorSails->EnableEditing(true);
   m_gridMotorSails->EnableGridLines(true);
   m_gridMotorSails->EnableDragGridSize(false);
@@ -1100,7 +1111,7 @@ LogbookDialog::LogbookDialog(logbookkonni_pi* d, wxTimer* t, LogbookTimer* lt,
                           wxDefaultSize, wxALWAYS_SHOW_SB);
 
   // Grid
-  m_gridCrew->CreateGrid(0, 15);
+  m_gridCrew->SetTable(new myGridStringTable(0, 15), true);
   m_gridCrew->EnableEditing(true);
   m_gridCrew->EnableGridLines(true);
   m_gridCrew->EnableDragGridSize(false);
@@ -2055,7 +2066,7 @@ LogbookDialog::LogbookDialog(logbookkonni_pi* d, wxTimer* t, LogbookTimer* lt,
       new wxGrid(m_panel14, wxID_ANY, wxDefaultPosition, wxSize(1000, 400), 0);
 
   // Grid
-  m_gridMaintanence->CreateGrid(0, 7);
+  m_gridMaintanence->SetTable(new myGridStringTable(0, 7), true);
   m_gridMaintanence->EnableEditing(true);
   m_gridMaintanence->EnableGridLines(true);
   m_gridMaintanence->EnableDragGridSize(false);
@@ -2207,7 +2218,7 @@ LogbookDialog::LogbookDialog(logbookkonni_pi* d, wxTimer* t, LogbookTimer* lt,
       new wxGrid(m_panel141, wxID_ANY, wxDefaultPosition, wxSize(1000, 400), 0);
 
   // Grid
-  m_gridMaintanenceRepairs->CreateGrid(0, 2);
+  m_gridMaintanenceRepairs->SetTable(new myGridStringTable(0, 2), true);
   m_gridMaintanenceRepairs->EnableEditing(true);
   m_gridMaintanenceRepairs->EnableGridLines(true);
   m_gridMaintanenceRepairs->EnableDragGridSize(false);
@@ -2355,7 +2366,7 @@ LogbookDialog::LogbookDialog(logbookkonni_pi* d, wxTimer* t, LogbookTimer* lt,
       new wxGrid(m_panel16, wxID_ANY, wxDefaultPosition, wxSize(1000, 400), 0);
 
   // Grid
-  m_gridMaintenanceBuyParts->CreateGrid(0, 6);
+  m_gridMaintenanceBuyParts->SetTable(new myGridStringTable(0, 6), true);
   m_gridMaintenanceBuyParts->EnableEditing(true);
   m_gridMaintenanceBuyParts->EnableGridLines(true);
   m_gridMaintenanceBuyParts->EnableDragGridSize(false);
@@ -2419,6 +2430,23 @@ LogbookDialog::LogbookDialog(logbookkonni_pi* d, wxTimer* t, LogbookTimer* lt,
 
   bSizer2->Add(m_logbook, 1, wxEXPAND | wxALL, 2);
 
+  // shown while an export runs, the dialog stays usable
+  exportBar = new wxPanel(this, wxID_ANY);
+  wxBoxSizer* exportSizer = new wxBoxSizer(wxHORIZONTAL);
+  exportText = new wxStaticText(exportBar, wxID_ANY, wxEmptyString);
+  exportSizer->Add(exportText, 1, wxALIGN_CENTER_VERTICAL | wxLEFT, 5);
+  exportGauge = new wxGauge(exportBar, wxID_ANY, 100, wxDefaultPosition,
+                            wxSize(150, -1));
+  exportSizer->Add(exportGauge, 0, wxALIGN_CENTER_VERTICAL | wxALL, 5);
+  exportCancel = new wxButton(exportBar, wxID_ANY, _("Cancel"));
+  exportSizer->Add(exportCancel, 0, wxALIGN_CENTER_VERTICAL | wxRIGHT, 5);
+  exportBar->SetSizer(exportSizer);
+  exportBar->Hide();
+  bSizer2->Add(exportBar, 0, wxEXPAND, 0);
+  exportCancel->Bind(wxEVT_BUTTON, [this](wxCommandEvent&) {
+    if (exportJob) exportJob->cancel();
+  });
+
   this->SetSizer(bSizer2);
   this->Layout();
 
@@ -3175,29 +3203,19 @@ LogbookDialog::LogbookDialog(logbookkonni_pi* d, wxTimer* t, LogbookTimer* lt,
       wxEVT_COMMAND_TEXT_ENTER,
       wxCommandEventHandler(LogbookDialog::OnTextEnterStatusMinutes), NULL,
       this);
-
-  this->Connect(wxEVT_IDLE,
-                wxIdleEventHandler(LogbookDialog::OnIdleMainDialog));
 }
 
 LogbookDialog::~LogbookDialog() {
   setIniValues();
 
-  if (GPSTimer->IsRunning()) GPSTimer->Stop();
-
-  this->Disconnect(wxEVT_TIMER, wxTimerEventHandler(LogbookDialog::OnTimerGPS));
-  delete GPSTimer;
-  GPSTimer = NULL;
-
-  if (logbookTimer->IsRunning()) logbookTimer->Stop();
-
-  this->Disconnect(wxEVT_TIMER, wxTimerEventHandler(LogbookDialog::OnLogTimer));
-  delete logbookTimer;
-  logbookTimer = NULL;
+  scheduler->Stop();
+  delete scheduler;
+  scheduler = NULL;
+  delete exportJob;
+  exportJob = NULL;
+  rebuildTextBlocks();  // frees the cached menu items
 
   // Disconnect Events
-  this->Disconnect(wxEVT_IDLE,
-                   wxIdleEventHandler(LogbookDialog::OnIdleMainDialog));
   this->Disconnect(wxEVT_CLOSE_WINDOW,
                    wxCloseEventHandler(LogbookDialog::LogbookDialogOnClose));
   this->Disconnect(
@@ -3936,71 +3954,6 @@ LogbookDialog::~LogbookDialog() {
   clearDataDir();
 }
 
-void LogbookDialog::OnIdleMainDialog(wxIdleEvent& event) {
-  static wxDateTime dt;
-  static unsigned int hour, min = 61;
-
-  if (logbook->sDate != wxEmptyString)
-    dt = logbook->mCorrectedDateTime;
-  else
-    dt = wxDateTime::Now();
-
-  if (min != dt.GetMinute()) {
-    min = dt.GetMinute();
-    hour = dt.GetHour();
-
-    if (statusGPS != logbook->gpsStatus) {
-      statusGPS = logbook->gpsStatus;
-      crewList->dayNow(false);
-    }
-    if (logbookPlugIn->opt->timer && !logbookPlugIn->eventsEnabled) {
-      if (logbookPlugIn->opt->timerType == 1) {
-        static unsigned int h = hour;
-        if (fullHourModified) {
-          h = hour;
-          fullHourModified = false;
-        }
-
-        for (unsigned int i = 0; i < TimerFull.Count(); i++)
-          if (min == TimerFull[i] && h == hour) {
-            logbookTimerWindow->timerEvent();
-            if (i == TimerFull.Count() - 1) {
-              h += fullHourPlus;
-
-              if (h >= 24) h -= 24;
-            }
-            break;
-          }
-      } else if (logbookPlugIn->opt->timerType == 2 &&
-                 !logbookPlugIn->eventsEnabled) {
-        for (unsigned int i = 0; i < TimerIndividualH.Count(); i++) {
-          if (logbookPlugIn->opt->timeformat == 1 && hour > 12) hour -= 12;
-          if (hour == TimerIndividualH[i] && min == TimerIndividualM[i]) {
-            logbookTimerWindow->timerEvent();
-            break;
-          }
-        }
-      }
-    }
-
-    if (ActualWatch::active && dt >= ActualWatch::end) {
-      static unsigned int wmin = 61;
-
-      if (wmin != min) {
-        wmin = min;
-        crewList->dayNow(false);
-        if (logbookPlugIn->opt->guardChange && !logbookPlugIn->eventsEnabled) {
-          logbookTimerWindow->popUp();
-          logbook->guardChange = true;
-          logbook->appendRow(true, true);
-          logbook->guardChange = false;
-        }
-      }
-    } else if (dt >= ActualWatch::end)
-      crewList->dayNow(false);
-  }
-}
-
 void LogbookDialog::OnToggleButtonEngine1(wxCommandEvent& event) {
   if (event.IsChecked()) {
     SendPluginMessage("LOGBOOK_ENGINEBUTTON1", "ON");
@@ -4483,6 +4436,7 @@ void LogbookDialog::m_menu1Highlighted(wxMenuEvent& ev) {
 }
 
 void LogbookDialog::OnMenuSelectionSearch(wxCommandEvent& event) {
+  logbook->pageIn(logbook->heldRows(), true);
   logbook->showSearchDlg(selGridRow, selGridCol);
 }
 
@@ -4633,18 +4587,49 @@ void LogbookDialog::gridGlobalScrolled(wxScrollWinEvent& ev) {
   ev.Skip();
   m_gridWeather->HandleOnScroll(ev);
   m_gridMotorSails->HandleOnScroll(ev);
+  queuePageOlderRows();
 }
 
 void LogbookDialog::gridWeatherScrolled(wxScrollWinEvent& ev) {
   ev.Skip();
   m_gridGlobal->HandleOnScroll(ev);
   m_gridMotorSails->HandleOnScroll(ev);
+  queuePageOlderRows();
 }
 
 void LogbookDialog::gridMotorSailsScrolled(wxScrollWinEvent& ev) {
   ev.Skip();
   m_gridWeather->HandleOnScroll(ev);
   m_gridGlobal->HandleOnScroll(ev);
+  queuePageOlderRows();
+}
+
+// a scroll burst asks for one page, not one per event
+void LogbookDialog::queuePageOlderRows() {
+  if (pagePending || !logbook->heldRows()) return;
+  pagePending = true;
+  CallAfter([this]() {
+    pagePending = false;
+    pageOlderRows();
+  });
+}
+
+// scrolled to the top with rows left on disk, the next page goes above
+// and the rows that were on top stay where they were on screen
+void LogbookDialog::pageOlderRows() {
+  int x, y;
+  m_gridGlobal->GetViewStart(&x, &y);
+  if (y > 0) return;
+
+  // the row offsets only hold for the saved file, edits are saved first
+  int rows = logbook->pageIn(RowWindow::PAGEROWS, true);
+  if (rows == 0) return;
+  for (int i = 0; i < LOGGRIDS; i++) {
+    int ux, uy;
+    logGrids[i]->GetScrollPixelsPerUnit(&ux, &uy);
+    if (uy > 0)
+      logGrids[i]->Scroll(-1, logGrids[i]->CellToRect(rows, 0).GetTop() / uy);
+  }
 }
 
 void LogbookDialog::m_gridMotorSailsOnKeyDown(wxKeyEvent& ev) {
@@ -4929,7 +4914,6 @@ void LogbookDialog::setTitleExt() {
 }
 
 void LogbookDialog::init() {
-  fullHourModified = false;
   statusGPS = false;
   sashPos = -1;
   noOpenPositionDlg = false;
@@ -4999,6 +4983,10 @@ Backup Logbook(*.txt)|*.txt");
 
   for (int i = 0; i < LOGGRIDS; i++) {
     logGrids[i]->SetDefaultEditor(new wxGridCellAutoWrapStringEditor);
+    logGrids[i]->Connect(wxEVT_GRID_EDITOR_CREATED,
+                         wxGridEditorCreatedEventHandler(
+                             LogbookDialog::OnGridEditorCreatedTextBlocks),
+                         NULL, this);
     totalColumns += logGrids[i]->GetNumberCols();
   }
 
@@ -5065,6 +5053,7 @@ Backup Logbook(*.txt)|*.txt");
     m_gridMotorSails->SetGridCursor(0, 0);
   }
 
+  scheduler = new LogbookScheduler(this);
   loadTimerEx();
 
   if (logbookPlugIn->opt->checkStateOfEvents())
@@ -5080,15 +5069,7 @@ Backup Logbook(*.txt)|*.txt");
   refreshBullets();  // Statusbar
   checkBitmaps();
 
-  GPSTimer = new wxTimer(this, ID_GPSTIMER);
-  this->Connect(ID_GPSTIMER, wxEVT_TIMER,
-                wxTimerEventHandler(LogbookDialog::OnTimerGPS), NULL, this);
-  GPSTimer->Start(GPSTIMEOUT);
-
-  logbookTimer = new wxTimer(this, ID_LOGTIMER);
-  this->Connect(ID_LOGTIMER, wxEVT_TIMER,
-                wxTimerEventHandler(LogbookDialog::OnLogTimer), NULL, this);
-  logbookTimer->Start(LOGSAVETIME);
+  scheduler->start();
 
   SailsTimer = new wxTimer(this, ID_SAILSTIMER);
   this->Connect(ID_SAILSTIMER, wxEVT_TIMER,
@@ -5098,6 +5079,7 @@ Backup Logbook(*.txt)|*.txt");
 
   coldfinger = new ColdFinger(this);
   coldfinger->Show(false);
+  rebuildTextBlocks();
 
   crewList->filterCrewMembers();
 
@@ -5475,6 +5457,8 @@ void LogbookDialog::loadTimerEx() {
   wxTextFile txt(data + wxFileName::GetPathSeparator() + "Timer.txt");
   if (!txt.Exists()) return;
 
+  std::vector<int> fullMinutes, individual;
+
   TimerFull.clear();
   TimerIndividualH.clear();
   TimerIndividualM.clear();
@@ -5484,7 +5468,10 @@ void LogbookDialog::loadTimerEx() {
   wxStringTokenizer tkzf(full, ",");
   fullHourPlus = wxAtoi(tkzf.GetNextToken());
 
-  while (tkzf.HasMoreTokens()) TimerFull.Add(wxAtoi(tkzf.GetNextToken()));
+  while (tkzf.HasMoreTokens()) {
+    TimerFull.Add(wxAtoi(tkzf.GetNextToken()));
+    fullMinutes.push_back(TimerFull.Last());
+  }
 
   wxString ind = txt.GetNextLine();
   wxDateTime dt = wxDateTime::Now();
@@ -5496,6 +5483,7 @@ void LogbookDialog::loadTimerEx() {
 
     dt.SetHour(wxAtoi(f.GetNextToken()));
     dt.SetMinute(wxAtoi(f.GetNextToken()));
+    individual.push_back(dt.GetHour() * 60 + dt.GetMinute());
 
     wxString ss = dt.Format(logbookPlugIn->opt->stimeformat);
     wxStringTokenizer tkz(ss, ":");
@@ -5511,22 +5499,10 @@ void LogbookDialog::loadTimerEx() {
   }
 
   txt.Close();
-}
 
-void LogbookDialog::OnLogTimer(wxTimerEvent& ev) {
-  static int maintenance_timer = 0;
-
-  int id = ev.GetId();
-  if (id == ID_GPSTIMER)
-    OnTimerGPS(ev);
-  else {
-    maintenance_timer++;
-    logbook->update();           // save Data every 10 Minutes, if modified
-    if (maintenance_timer == 6)  // = once per hour
-    {
-      maintenance->checkService(m_gridGlobal->GetNumberRows() - 1);
-      maintenance_timer = 0;
-    }
+  if (scheduler) {
+    scheduler->setFullHour(fullHourPlus, fullMinutes);
+    scheduler->setIndividual(individual);
   }
 }
 
@@ -5541,6 +5517,9 @@ void LogbookDialog::m_menuItem1OnMenuSelection(wxCommandEvent& ev) {
     //		logbook->recalculateLogbook(selGridRow);
   } else if (ev.GetId() == COLDFINGER) {
     coldfinger->ShowModal();
+    // the popup still holds the cached items, they are freed once it is
+    // closed and its items are removed from m_menu1
+    CallAfter([this]() { rebuildTextBlocks(); });
     if (!coldfinger->IsModal() && coldfinger->retItem != NULL) {
       myTreeItem* item = coldfinger->retItem;
       m_notebook8->SetSelection(item->grid);
@@ -5577,6 +5556,20 @@ void LogbookDialog::m_menuItem1OnMenuSelection(wxCommandEvent& ev) {
       search = "<rte>";
       itemCol.SetText(_("Track"));
     }
+  } else if (ev.GetId() >= TEXTBLOCKS &&
+             ev.GetId() < TEXTBLOCKS + MAXTEXTBLOCKS) {
+    int grid = m_notebook8->GetSelection();
+    const vector<TextBlocks::block>& blocks =
+        textBlocks.blocks(grid, selGridCol);
+    if ((size_t)(ev.GetId() - TEXTBLOCKS) >= blocks.size()) return;
+
+    wxString s = logGrids[grid]->GetCellValue(selGridRow, selGridCol);
+    if (s.Length() == 1 && s.GetChar(0) == ' ') s = wxEmptyString;
+    logGrids[grid]->SetCellValue(
+        selGridRow, selGridCol,
+        s + ((s.Length() == 0) ? "" : "\n") +
+            blocks[ev.GetId() - TEXTBLOCKS].text);
+    logGrids[grid]->SetGridCursor(selGridRow, selGridCol);
   } else if (selGridCol == LogbookHTML::WAKE &&
              this->m_notebook8->GetSelection() == 0) {
     wxString s = logGrids[m_notebook8->GetSelection()]->GetCellValue(
@@ -5587,30 +5580,6 @@ void LogbookDialog::m_menuItem1OnMenuSelection(wxCommandEvent& ev) {
                       : s + "\n" + m_menu1->GetLabelText(ev.GetId()));
     setEqualRowHeight(selGridRow);
     logGrids[m_notebook8->GetSelection()]->Refresh();
-  } else if ((selGridCol == LogbookHTML::REMARKS &&
-              m_notebook8->GetSelection() == 0) ||
-             (selGridCol == LogbookHTML::WEATHER &&
-              m_notebook8->GetSelection() == 1) ||
-             (selGridCol == LogbookHTML::VISIBILITY &&
-              m_notebook8->GetSelection() == 1) ||
-             (selGridCol == LogbookHTML::SAILS &&
-              m_notebook8->GetSelection() == 2) ||
-             (selGridCol == LogbookHTML::REEF &&
-              m_notebook8->GetSelection() == 2) ||
-             (selGridCol == LogbookHTML::MREMARKS &&
-              m_notebook8->GetSelection() == 2)) {
-    wxString s = logGrids[m_notebook8->GetSelection()]->GetCellValue(
-        selGridRow, selGridCol);
-    if (s.Length() == 1 && s.GetChar(0) == ' ') s = wxEmptyString;
-    wxTreeItemId id = FindMenuItem(m_notebook8->GetSelection(), selGridCol,
-                                   m_menu1->GetLabelText(ev.GetId()));
-    wxString text =
-        ((myTreeItem*)coldfinger->m_treeCtrl3->GetItemData(id))->text;
-    int grid = ((myTreeItem*)coldfinger->m_treeCtrl3->GetItemData(id))->grid;
-
-    logGrids[grid]->SetCellValue(selGridRow, selGridCol,
-                                 s + ((s.Length() == 0) ? "" : "\n") + text);
-    logGrids[grid]->SetGridCursor(selGridRow, selGridCol);
   } else if (selGridCol == LogbookHTML::CLOUDS &&
              m_notebook8->GetSelection() == 1) {
     logGrids[1]->SetCellValue(selGridRow, LogbookHTML::CLOUDS,
@@ -5730,7 +5699,11 @@ void LogbookDialog::OnNoteBookPageChangedLogbook(wxNotebookEvent& ev) {
     logbook->modified = true;
     logbook->update();
     overview->refresh();
-  }
+  } else if (ev.GetEventObject() == this->m_logbook &&
+             logbookPlugIn->opt->lowMemory &&
+             m_gridOverview->GetNumberRows() > 0)
+    // built again by refresh() when the page is shown
+    m_gridOverview->DeleteRows(0, m_gridOverview->GetNumberRows());
 
   if (ev.GetSelection() == 3) {
     if (sashPos == -1) {
@@ -5856,60 +5829,67 @@ void LogbookDialog::addColdFingerDialog(wxMenu* m_menu) {
 }
 
 void LogbookDialog::addColdFingerTextBlocks(wxMenu* menu) {
-  FindMenuItem(-1, 0, wxEmptyString);
-  FindMenuItem(m_notebook8->GetSelection(), selGridCol, wxEmptyString);
+  int grid = m_notebook8->GetSelection();
+  vector<wxMenuItem*>& items = textBlockMenus[make_pair(grid, selGridCol)];
+  const vector<TextBlocks::block>& blocks = textBlocks.blocks(grid, selGridCol);
+
+  // the items are made once, the popup only removes them from the menu
+  if (items.empty())
+    for (size_t i = 0; i < blocks.size() && i < MAXTEXTBLOCKS; i++)
+      items.push_back(new wxMenuItem(m_menu1, TEXTBLOCKS + i, blocks[i].name,
+                                     wxEmptyString, wxITEM_NORMAL));
+
+  for (size_t i = 0; i < items.size(); i++) {
+    m_menu1->Prepend(items[i]);
+    this->Connect(
+        items[i]->GetId(), wxEVT_COMMAND_MENU_SELECTED,
+        wxCommandEventHandler(LogbookDialog::m_menuItem1OnMenuSelection));
+  }
 }
 
-#include <stack>
-using namespace std;
-wxTreeItemId LogbookDialog::FindMenuItem(int grid, int col, wxString name) {
-  wxTreeCtrl* tree = coldfinger->m_treeCtrl3;
-  std::stack<wxTreeItemId> items;
-  if (tree->GetRootItem().IsOk()) items.push(tree->GetRootItem());
-
-  while (!items.empty()) {
-    wxTreeItemId next = items.top();
-    items.pop();
-
-    if (grid == -1) {
-      if (next != tree->GetRootItem() &&
-          ((myTreeItem*)tree->GetItemData(next))->grid == -1)
-        return next;
-    } else if (name == wxEmptyString) {
-      if (((next != tree->GetRootItem() &&
-            ((myTreeItem*)tree->GetItemData(next))->grid == grid)) &&
-          ((myTreeItem*)tree->GetItemData(next))->gridcol == col &&
-          ((myTreeItem*)tree->GetItemData(next))->menu == true) {
-        wxTreeItemIdValue cookie;
-        next = tree->GetFirstChild(next, cookie);
-
-        while (next.IsOk()) {
-          wxMenuItem* item =
-              new wxMenuItem(m_menu1, wxID_ANY, tree->GetItemText(next),
-                             wxEmptyString, wxITEM_NORMAL);
-          m_menu1->Prepend(item);
-          this->Connect(
-              item->GetId(), wxEVT_COMMAND_MENU_SELECTED,
-              wxCommandEventHandler(LogbookDialog::m_menuItem1OnMenuSelection));
-          next = tree->GetNextSibling(next);
-        }
+void LogbookDialog::rebuildTextBlocks() {
+  map<pair<int, int>, vector<wxMenuItem*> >::iterator it;
+  for (it = textBlockMenus.begin(); it != textBlockMenus.end(); it++)
+    for (size_t i = 0; i < it->second.size(); i++) delete it->second[i];
+  textBlockMenus.clear();
 
-        return wxTreeItemId();
-      }
-    } else {
-      if (next != tree->GetRootItem() && tree->GetItemText(next) == name)
-        return next;
-    }
+  if (coldfinger) textBlocks.rebuild(coldfinger->m_treeCtrl3);
+}
 
-    wxTreeItemIdValue cookie;
-    wxTreeItemId nextChild = tree->GetFirstChild(next, cookie);
-    while (nextChild.IsOk()) {
-      items.push(nextChild);
-      nextChild = tree->GetNextSibling(nextChild);
-    }
-  }
+void LogbookDialog::OnGridEditorCreatedTextBlocks(
+    wxGridEditorCreatedEvent& ev) {
+  ev.Skip();
+  ev.GetControl()->Connect(
+      wxEVT_COMMAND_TEXT_UPDATED,
+      wxCommandEventHandler(LogbookDialog::OnTextCompleteTextBlocks), NULL,
+      this);
+}
 
-  return wxTreeItemId();
+// completes the line being typed with the first text block it starts,
+// the completion is selected so typing on replaces it
+void LogbookDialog::OnTextCompleteTextBlocks(wxCommandEvent& ev) {
+  ev.Skip();
+  wxTextCtrl* ctrl = wxDynamicCast(ev.GetEventObject(), wxTextCtrl);
+  if (completing || !ctrl) return;
+
+  wxString value = ctrl->GetValue();
+  bool grown = value.Length() > completeLength;
+  completeLength = value.Length();
+  if (!grown || ctrl->GetInsertionPoint() != ctrl->GetLastPosition()) return;
+
+  int grid = m_notebook8->GetSelection();
+  wxString line = value.AfterLast('\n');
+  if (line.Length() < 2) return;
+  const TextBlocks::block* b =
+      textBlocks.complete(grid, logGrids[grid]->GetGridCursorCol(), line);
+  if (!b || b->text.Length() <= line.Length()) return;
+
+  long from = ctrl->GetLastPosition();
+  completing = true;
+  ctrl->AppendText(b->text.Mid(line.Length()));
+  ctrl->SetSelection(from, ctrl->GetLastPosition());
+  completing = false;
+  completeLength = ctrl->GetValue().Length();
 }
 
 void LogbookDialog::m_gridWeatherOnGridCellRightClick(wxGridEvent& ev) {
@@ -5959,6 +5939,9 @@ void LogbookDialog::logSaveOnButtonClick(wxCommandEvent& ev) {
   if (logbook->opt->filterLayout[LogbookDialog::LOGBOOK])
     layout.Prepend(prefix);
 
+  // an export covers the rows left on disk as well
+  logbook->pageIn(logbook->heldRows(), true);
+
   switch (sel) {
     case 0:
       if (m_radioBtnHTML->GetValue())
@@ -5970,13 +5953,13 @@ void LogbookDialog::logSaveOnButtonClick(wxCommandEvent& ev) {
       logbook->toKML(path);
       break;
     case 2:
-      logbook->toODS(path);
+      exportInBackground(new ODSSink(path, datePattern), path);
       break;
     case 3:
-      logbook->toXML(path);
+      exportInBackground(new XMLSink(path), path);
       break;
     case 4:
-      logbook->toCSV(path);
+      exportInBackground(new CSVSink(path), path);
       break;
     case 5:
       logbook->backup(path);
@@ -6019,7 +6002,7 @@ void LogbookDialog::startNormalTimer() {
 
   if (logbookPlugIn->opt->timer && sec > 0) {
     if (logbookPlugIn->opt->timerType == 0 && !logbookPlugIn->eventsEnabled)
-      timer->Start(sec);
+      scheduler->startInterval(sec);
     logbookPlugIn->opt->timer = true;
     logbookPlugIn->state = logbookPlugIn->ONWITHEVENTS;
     setTitleExt();
@@ -6027,18 +6010,14 @@ void LogbookDialog::startNormalTimer() {
   } else {
     if (logbookPlugIn->opt->timerType == 0 &&
         (m_bpButtonTimer->state == 0 || m_bpButtonTimer->state == 1))
-      timer->Stop();
+      scheduler->stopInterval();
     logbookPlugIn->opt->timer = false;
     SetTitle(logbook->title);
     if (logbookPlugIn->opt->checkStateOfEvents())
       logbookPlugIn->state = logbookPlugIn->ONNOEVENTS;
   }
-}
-
-void LogbookDialog::OnTimerGPS(wxTimerEvent& ev) {
-  logbook->checkNMEADeviceIsOn();
-  //	logbook->SetGPSStatus(false);
-  logbook->checkGPS(true);
+  // full hour and individual deadlines follow opt->timer
+  scheduler->reschedule();
 }
 
 void LogbookDialog::onRadioButtonHTML(wxCommandEvent& ev) {
@@ -6055,6 +6034,7 @@ void LogbookDialog::onRadioButtonODT(wxCommandEvent& ev) {
 
 void LogbookDialog::LogbookDialogOnClose(wxCloseEvent& ev) {
   logbookPlugIn->dlgShow = !logbookPlugIn->dlgShow;
+  logbook->trimWindow();
   this->Hide();
 }
 
@@ -6087,23 +6067,11 @@ void LogbookDialog::loadLayoutChoice(int grid, wxString path, wxChoice* choice,
 }
 
 void LogbookDialog::setEqualRowHeight(int row) {
-  if (row < 0) return;
-
-  int max = 0, height;
-
-  for (int i = 0; i < LOGGRIDS; i++) {
-    int count = logGrids[i]->GetNumberRows();
-    if (count <= 0) return;
-
-    logGrids[i]->AutoSizeRow(row, false);
-    height = logGrids[i]->GetRowHeight(row);
-
-    if (height > max) max = height;
-  }
+  rowLayout.apply(logGrids, LOGGRIDS, row);
+}
 
-  for (int i = 0; i < LOGGRIDS; i++) {
-    logGrids[i]->SetRowSize(row, max);
-  }
+void LogbookDialog::setEqualRowHeights() {
+  rowLayout.applyAll(logGrids, LOGGRIDS);
 }
 
 void LogbookDialog::appendOSDirSlash(wxString* pString) {
@@ -6147,6 +6115,8 @@ void LogbookDialog::startApplication(wxString filename, wxString ext) {
     command = "/bin/bash -c \"open " + filename + "\"";
 #endif
     wxExecute(command);
+  } else if (ext == ".ods" || ext == ".xml" || ext == ".csv") {
+    wxLaunchDefaultApplication(filename);
   } else {
     if (!logbookPlugIn->opt->htmlEditor.IsEmpty())
       wxExecute(wxString::Format("%s \"%s\" ",
@@ -6159,6 +6129,38 @@ void LogbookDialog::startApplication(wxString filename, wxString ext) {
   }
 }
 
+void LogbookDialog::exportInBackground(ExportSink* sink, wxString path) {
+  // snapshot on the main thread, the grids are not touched after this
+  wxArrayString labels;
+  ExportPipeline::labels(this, labels);
+  vector<ExportRecord> rows(m_gridGlobal->GetNumberRows());
+  for (size_t row = 0; row < rows.size(); row++)
+    ExportPipeline::read(this, row, rows[row]);
+
+  exportInBackground(sink, path, _("Export Logbook"), labels, rows);
+}
+
+void LogbookDialog::exportInBackground(ExportSink* sink, wxString path,
+                                       wxString title,
+                                       const wxArrayString& labels,
+                                       vector<ExportRecord>& rows) {
+  if (exportJob && exportJob->running()) {
+    wxMessageBox(_("An export is still running"), _("Information"));
+    delete sink;
+    return;
+  }
+
+  delete exportJob;
+  exportJob = new ExportJob(this, sink, path, [this, path](bool ok) {
+    if (ok)
+      startApplication(path, "." + wxFileName(path).GetExt().Lower());
+    else
+      wxMessageBox(_("Not exported:\n") + path, _("Error"));
+  });
+  if (!exportJob->start(title, labels, rows))
+    wxMessageBox(_("Can't write ") + path, _("Error"));
+}
+
 void LogbookDialog::setIniValues() {
   Options* opt = logbookPlugIn->opt;
 
@@ -6329,42 +6331,11 @@ void LogbookDialog::getIniValues() {
 }
 
 void LogbookDialog::sortGrid(wxGrid* grid, int col, bool ascending) {
-  bool sort = false;
   crewList->showAllCrewMembers();
 
   myGridStringTable* data = (myGridStringTable*)grid->GetTable();
-
-  wxGridStringArray arr = data->m_data;
-  if (arr.Count() < 2) return;
-
-  wxGridStringArray temp;
-
-  temp.Add(arr[0]);
-  int i;
-  do {
-    sort = false;
-    i = 0;
-    do {
-      if (ascending) {
-        if ((arr[i][col] > arr[i + 1][col])) {
-          temp[0] = arr[i];
-          arr[i] = arr[i + 1];
-          arr[i + 1] = temp[0];
-          sort = true;
-        }
-      } else {
-        if ((arr[i + 1][col] > arr[i][col])) {
-          temp[0] = arr[i];
-          arr[i] = arr[i + 1];
-          arr[i + 1] = temp[0];
-          sort = true;
-        }
-      }
-      i++;
-    } while (i < grid->GetNumberRows() - 1);
-  } while (sort);
-
-  data->m_data = arr;
+  if (data->GetNumberRows() < 2) return;
+  data->SortRows(col, ascending);
 
   if (m_menu2->IsChecked(MENUCREWONBOARD))
     crewList->filterCrewMembers();
@@ -6535,6 +6506,8 @@ void LogbookDialog::crewSaveOnButtonClick(wxCommandEvent& ev) {
   if (logbook->opt->filterLayout[LogbookDialog::CREW])
     layout.Prepend(logbook->opt->layoutPrefix[LogbookDialog::CREW]);
 
+  wxArrayString labels;
+  vector<ExportRecord> rows;
   switch (sel) {
     case 0:
       if (m_radioBtnHTMLCrew->GetValue())
@@ -6543,13 +6516,19 @@ void LogbookDialog::crewSaveOnButtonClick(wxCommandEvent& ev) {
         crewList->saveODT(path, layout, true);
       break;
     case 1:
-      crewList->saveODS(path);
+      crewList->snapshot(labels, rows);
+      exportInBackground(crewList->odsSink(path), path, _("Export CrewList"),
+                         labels, rows);
       break;
     case 2:
-      crewList->saveXML(path);
+      crewList->snapshot(labels, rows);
+      exportInBackground(new XMLSink(path), path, _("Export CrewList"),
+                         labels, rows);
       break;
     case 3:
-      crewList->saveCSV(path);
+      crewList->snapshot(labels, rows);
+      exportInBackground(new CSVSink(path, false), path, _("Export CrewList"),
+                         labels, rows);
       break;
     case 4:
       crewList->backup(path);
@@ -6708,7 +6687,7 @@ void LogbookDialog::OnButtonClickDayPlus(wxCommandEvent& event) {
 }
 
 void LogbookDialog::OnButtonClickNow(wxCommandEvent& event) {
-  crewList->dayNow(false);
+  crewList->dayNow();
 }
 
 void LogbookDialog::OnLeftDownWatchStartDate(wxMouseEvent& event) {
@@ -6867,6 +6846,13 @@ void LogbookDialog::boatSaveOnButtonClick(wxCommandEvent& ev) {
   if (logbook->opt->filterLayout[LogbookDialog::BOAT])
     layout.Prepend(logbook->opt->layoutPrefix[LogbookDialog::BOAT]);
 
+  // the boat sheet is one row, the equipment table goes to a file of its own
+  wxString equipment = boat->equipmentPath(path);
+  wxArrayString labels;
+  vector<ExportRecord> rows;
+  if (sel >= 1 && sel <= 3)
+    ExportPipeline::table(m_gridEquipment, labels, rows);
+
   switch (sel) {
     case 0:
       if (m_radioBtnHTMLBoat->GetValue())
@@ -6876,12 +6862,19 @@ void LogbookDialog::boatSaveOnButtonClick(wxCommandEvent& ev) {
       break;
     case 1:
       boat->toODS(path);
+      exportInBackground(
+          new ODSSink(equipment, datePattern, "Equipment", vector<int>()),
+          equipment, _("Export Equipment"), labels, rows);
       break;
     case 2:
       boat->toXML(path);
+      exportInBackground(new XMLSink(equipment), equipment,
+                         _("Export Equipment"), labels, rows);
       break;
     case 3:
       boat->toCSV(path);
+      exportInBackground(new CSVSink(equipment, false), equipment,
+                         _("Export Equipment"), labels, rows);
       break;
     case 4:
       boat->backup(path);
@@ -8026,235 +8019,9 @@ void LogbookDialog::setDatePattern() {
 //   Headers for Export
 ///////////////////////////////////////////////////////////
 void LogbookDialog::declareExportHeader() {
-  content =
-      _T("<?xml version=\"1.0\" encoding=\"UTF-8\" ?>\
-<office:document-content xmlns:office=\"urn:oasis:names:tc:opendocument:xmlns:office:1.0\" xmlns:style=\"urn:oasis:names:tc:opendocument:xmlns:style:1.0\" xmlns:text=\"urn:oasis:names:tc:opendocument:xmlns:text:1.0\" xmlns:table=\"urn:oasis:names:tc:opendocument:xmlns:table:1.0\" xmlns:draw=\"urn:oasis:names:tc:opendocument:xmlns:drawing:1.0\" xmlns:fo=\"urn:oasis:names:tc:opendocument:xmlns:xsl-fo-compatible:1.0\" xmlns:xlink=\"http://www.w3.org/1999/xlink\" xmlns:dc=\"http://purl.org/dc/elements/1.1/\" xmlns:meta=\"urn:oasis:names:tc:opendocument:xmlns:meta:1.0\" xmlns:number=\"urn:oasis:names:tc:opendocument:xmlns:datastyle:1.0\" xmlns:presentation=\"urn:oasis:names:tc:opendocument:xmlns:presentation:1.0\" xmlns:svg=\"urn:oasis:names:tc:opendocument:xmlns:svg-compatible:1.0\" xmlns:chart=\"urn:oasis:names:tc:opendocument:xmlns:chart:1.0\" xmlns:dr3d=\"urn:oasis:names:tc:opendocument:xmlns:dr3d:1.0\" xmlns:math=\"http://www.w3.org/1998/Math/MathML\" xmlns:form=\"urn:oasis:names:tc:opendocument:xmlns:form:1.0\" xmlns:script=\"urn:oasis:names:tc:opendocument:xmlns:script:1.0\" xmlns:ooo=\"http://openoffice.org/2004/office\" xmlns:ooow=\"http://openoffice.org/2004/writer\" xmlns:oooc=\"http://openoffice.org/2004/calc\" xmlns:dom=\"http://www.w3.org/2001/xml-events\" xmlns:xforms=\"http://www.w3.org/2002/xforms\" xmlns:xsd=\"http://www.w3.org/2001/XMLSchema\" xmlns:xsi=\"http://www.w3.org/2001/XMLSchema-instance\" xmlns:rpt=\"http://openoffice.org/2005/report\" xmlns:of=\"urn:oasis:names:tc:opendocument:xmlns:of:1.2\" xmlns:xhtml=\"http://www.w3.org/1999/xhtml\" xmlns:grddl=\"http://www.w3.org/2003/g/data-view#\" xmlns:field=\"urn:openoffice:names:experimental:ooo-ms-interop:xmlns:field:1.0\" office:version=\"1.2\" grddl:transformation=\"http://docs.oasis-open.org/office/1.2/xslt/odf2rdf.xsl\">\
-<office:scripts />\
-<office:font-face-decls>\
-<style:font-face style:name=\"Arial\" svg:font-family=\"Arial\" style:font-family-generic=\"swiss\" style:font-pitch=\"variable\" />\
-<style:font-face style:name=\"Arial Unicode MS\" svg:font-family=\"'Arial Unicode MS'\" style:font-family-generic=\"system\" style:font-pitch=\"variable\" />\
-<style:font-face style:name=\"Mangal\" svg:font-family=\"Mangal\" style:font-family-generic=\"system\" style:font-pitch=\"variable\" />\
-<style:font-face style:name=\"Tahoma\" svg:font-family=\"Tahoma\" style:font-family-generic=\"system\" style:font-pitch=\"variable\" />\
-</office:font-face-decls>\
-<office:automatic-styles>\
-<style:style style:name=\"co1\" style:family=\"table-column\">\
-<style:table-column-properties fo:break-before=\"auto\" style:column-width=\"2.267cm\" />\
-</style:style>\
-<style:style style:name=\"ro2\" style:family=\"table-row\">\
-<style:table-row-properties style:row-height=\"0.453cm\" fo:break-before=\"auto\" style:use-optimal-row-height=\"true\" />\
-</style:style>\
-<style:style style:name=\"ro3\" style:family=\"table-row\">\
-<style:table-row-properties style:row-height=\"0.894cm\" fo:break-before=\"auto\" style:use-optimal-row-height=\"true\" />\
-</style:style>\
-<style:style style:name=\"ta1\" style:family=\"table\" style:master-page-name=\"Default\">\
-<style:table-properties table:display=\"true\" style:writing-mode=\"lr-tb\" />\
-</style:style>\
-<style:style style:name=\"ta_extref\" style:family=\"table\">\
-<style:table-properties table:display=\"false\" />\
-</style:style>\
-</office:automatic-styles>\
-<office:body>\
-<office:spreadsheet>\
-<table:table table:name=\"Logbook\" table:style-name=\"ta1\" table:print=\"false\">\
-<table:table-column table:style-name=\"co1\" table:number-columns-repeated=\"33\" table:default-cell-style-name=\"Default\" />\
-");
-  contentEnd = _T(
-      "</table:table></office:spreadsheet></office:body></office:document-content>\
- ");
-
-  manifest =
-      _T("<?xml version=\"1.0\" encoding=\"UTF-8\" ?>\
-<manifest:manifest xmlns:manifest=\"urn:oasis:names:tc:opendocument:xmlns:manifest:1.0\">\
-<manifest:file-entry manifest:media-type=\"application/vnd.oasis.opendocument.spreadsheet\" manifest:version=\"1.2\" manifest:full-path=\"/\" />\
-<manifest:file-entry manifest:media-type=\"\" manifest:full-path=\"Configurations2/statusbar/\" />\
-<manifest:file-entry manifest:media-type=\"\" manifest:full-path=\"Configurations2/accelerator/current.xml\" />\
-<manifest:file-entry manifest:media-type=\"\" manifest:full-path=\"Configurations2/accelerator/\" />\
-<manifest:file-entry manifest:media-type=\"\" manifest:full-path=\"Configurations2/floater/\" />\
-<manifest:file-entry manifest:media-type=\"\" manifest:full-path=\"Configurations2/popupmenu/\" />\
-<manifest:file-entry manifest:media-type=\"\" manifest:full-path=\"Configurations2/progressbar/\" />\
-<manifest:file-entry manifest:media-type=\"\" manifest:full-path=\"Configurations2/menubar/\" />\
-<manifest:file-entry manifest:media-type=\"\" manifest:full-path=\"Configurations2/toolbar/\" />\
-<manifest:file-entry manifest:media-type=\"\" manifest:full-path=\"Configurations2/images/Bitmaps/\" />\
-<manifest:file-entry manifest:media-type=\"\" manifest:full-path=\"Configurations2/images/\" />\
-<manifest:file-entry manifest:media-type=\"application/vnd.sun.xml.ui.configuration\" manifest:full-path=\"Configurations2/\" />\
-<manifest:file-entry manifest:media-type=\"text/xml\" manifest:full-path=\"content.xml\" />\
-<manifest:file-entry manifest:media-type=\"text/xml\" manifest:full-path=\"styles.xml\" />\
-<manifest:file-entry manifest:media-type=\"text/xml\" manifest:full-path=\"meta.xml\" />\
-<manifest:file-entry manifest:media-type=\"\" manifest:full-path=\"Thumbnails/thumbnail.png\" />\
-<manifest:file-entry manifest:media-type=\"\" manifest:full-path=\"Thumbnails/\" />\
-<manifest:file-entry manifest:media-type=\"text/xml\" manifest:full-path=\"settings.xml\" />\
-</manifest:manifest>");
-
-  styles =
-      _T("<?xml version=\"1.0\" encoding=\"UTF-8\" ?>\
-<office:document-styles xmlns:office=\"urn:oasis:names:tc:opendocument:xmlns:office:1.0\" xmlns:style=\"urn:oasis:names:tc:opendocument:xmlns:style:1.0\" xmlns:text=\"urn:oasis:names:tc:opendocument:xmlns:text:1.0\" xmlns:table=\"urn:oasis:names:tc:opendocument:xmlns:table:1.0\" xmlns:draw=\"urn:oasis:names:tc:opendocument:xmlns:drawing:1.0\" xmlns:fo=\"urn:oasis:names:tc:opendocument:xmlns:xsl-fo-compatible:1.0\" xmlns:xlink=\"http://www.w3.org/1999/xlink\" xmlns:dc=\"http://purl.org/dc/elements/1.1/\" xmlns:meta=\"urn:oasis:names:tc:opendocument:xmlns:meta:1.0\" xmlns:number=\"urn:oasis:names:tc:opendocument:xmlns:datastyle:1.0\" xmlns:presentation=\"urn:oasis:names:tc:opendocument:xmlns:presentation:1.0\" xmlns:svg=\"urn:oasis:names:tc:opendocument:xmlns:svg-compatible:1.0\" xmlns:chart=\"urn:oasis:names:tc:opendocument:xmlns:chart:1.0\" xmlns:dr3d=\"urn:oasis:names:tc:opendocument:xmlns:dr3d:1.0\" xmlns:math=\"http://www.w3.org/1998/Math/MathML\" xmlns:form=\"urn:oasis:names:tc:opendocument:xmlns:form:1.0\" xmlns:script=\"urn:oasis:names:tc:opendocument:xmlns:script:1.0\" xmlns:ooo=\"http://openoffice.org/2004/office\" xmlns:ooow=\"http://openoffice.org/2004/writer\" xmlns:oooc=\"http://openoffice.org/2004/calc\" xmlns:dom=\"http://www.w3.org/2001/xml-events\" xmlns:rpt=\"http://openoffice.org/2005/report\" xmlns:of=\"urn:oasis:names:tc:opendocument:xmlns:of:1.2\" xmlns:xhtml=\"http://www.w3.org/1999/xhtml\" xmlns:grddl=\"http://www.w3.org/2003/g/data-view#\" office:version=\"1.2\" grddl:transformation=\"http://docs.oasis-open.org/office/1.2/xslt/odf2rdf.xsl\">\
-<office:font-face-decls>\
-<style:font-face style:name=\"Arial\" svg:font-family=\"Arial\" style:font-family-generic=\"swiss\" style:font-pitch=\"variable\" />\
-<style:font-face style:name=\"Arial Unicode MS\" svg:font-family=\"'Arial Unicode MS'\" style:font-family-generic=\"system\" style:font-pitch=\"variable\" />\
-<style:font-face style:name=\"Mangal\" svg:font-family=\"Mangal\" style:font-family-generic=\"system\" style:font-pitch=\"variable\" />\
-<style:font-face style:name=\"Tahoma\" svg:font-family=\"Tahoma\" style:font-family-generic=\"system\" style:font-pitch=\"variable\" />\
-</office:font-face-decls>\
-<office:styles>\
-<style:default-style style:family=\"table-cell\">\
-<style:table-cell-properties style:decimal-places=\"2\" />\
-<style:paragraph-properties style:tab-stop-distance=\"1.25cm\" />\
-<style:text-properties style:font-name=\"Arial\" fo:language=\"de\" fo:country=\"DE\" style:font-name-asian=\"Arial Unicode MS\" style:language-asian=\"zh\" style:country-asian=\"CN\" style:font-name-complex=\"Tahoma\" style:language-complex=\"hi\" style:country-complex=\"IN\" />\
-</style:default-style>\
-<number:number-style style:name=\"N0\">\
-<number:number number:min-integer-digits=\"1\" /> \
-</number:number-style>\
-<number:currency-style style:name=\"N106P0\" style:volatile=\"true\">\
-<number:number number:decimal-places=\"2\" number:min-integer-digits=\"1\" number:grouping=\"true\" /> \
-<number:text />\
-<number:currency-symbol number:language=\"de\" number:country=\"DE\">€</number:currency-symbol>\
-</number:currency-style>\
-<number:currency-style style:name=\"N106\">\
-<style:text-properties fo:color=\"#ff0000\" />\
-<number:text>-</number:text>\
-<number:number number:decimal-places=\"2\" number:min-integer-digits=\"1\" number:grouping=\"true\" />\
-<number:text />\
-<number:currency-symbol number:language=\"de\" number:country=\"DE\">€</number:currency-symbol>\
-<style:map style:condition=\"value()>=0\" style:apply-style-name=\"N106P0\" />\
-</number:currency-style>\
-<style:style style:name=\"Default\" style:family=\"table-cell\">\
-<style:text-properties style:font-name-complex=\"Mangal\" />\
-</style:style>\
-<style:style style:name=\"Result\" style:family=\"table-cell\" style:parent-style-name=\"Default\">\
-<style:text-properties fo:font-style=\"italic\" style:text-underline-style=\"solid\" style:text-underline-width=\"auto\" style:text-underline-color=\"font-color\" fo:font-weight=\"bold\" />\
-</style:style>\
-<style:style style:name=\"Result2\" style:family=\"table-cell\" style:parent-style-name=\"Result\" style:data-style-name=\"N106\" />\
-<style:style style:name=\"Heading\" style:family=\"table-cell\" style:parent-style-name=\"Default\">\
-<style:table-cell-properties style:text-align-source=\"fix\" style:repeat-content=\"false\" />\
-<style:paragraph-properties fo:text-align=\"center\" />\
-<style:text-properties fo:font-size=\"16pt\" fo:font-style=\"italic\" fo:font-weight=\"bold\" />\
-</style:style>\
-<style:style style:name=\"Heading1\" style:family=\"table-cell\" style:parent-style-name=\"Heading\">\
-<style:table-cell-properties style:rotation-angle=\"90\" />\
-</style:style>\
-</office:styles>\
-<office:automatic-styles>\
-<style:page-layout style:name=\"Mpm1\">\
-<style:page-layout-properties style:writing-mode=\"lr-tb\" />\
-<style:header-style>\
-<style:header-footer-properties fo:min-height=\"0.751cm\" fo:margin-left=\"0cm\" fo:margin-right=\"0cm\" fo:margin-bottom=\"0.25cm\" />\
-</style:header-style>\
-<style:footer-style>\
-<style:header-footer-properties fo:min-height=\"0.751cm\" fo:margin-left=\"0cm\" fo:margin-right=\"0cm\" fo:margin-top=\"0.25cm\" />\
-</style:footer-style>\
-</style:page-layout>\
-<style:page-layout style:name=\"Mpm2\">\
-<style:page-layout-properties style:writing-mode=\"lr-tb\" />\
-<style:header-style>\
-<style:header-footer-properties fo:min-height=\"0.751cm\" fo:margin-left=\"0cm\" fo:margin-right=\"0cm\" fo:margin-bottom=\"0.25cm\" fo:border=\"0.088cm solid #000000\" fo:padding=\"0.018cm\"  fo:background-color=\"#c0c0c0\">\
-<style:background-image />\
-</style:header-footer-properties>\
-</style:header-style>\
-<style:footer-style>\
-<style:header-footer-properties fo:min-height=\"0.751cm\" fo:margin-left=\"0cm\" fo:margin-right=\"0cm\" fo:margin-top=\"0.25cm\" fo:border=\"0.088cm solid #000000\" fo:padding=\"0.018cm\" fo:background-color=\"#c0c0c0\">\
-<style:background-image />\
-</style:header-footer-properties>\
-</style:footer-style>\
-</style:page-layout>\
-</office:automatic-styles>\
-<office:master-styles>\
-<style:master-page style:name=\"Default\" style:page-layout-name=\"Mpm1\">\
-<style:header>\
-<text:p>\
-<text:sheet-name>p</text:sheet-name>\
-</text:p>\
-</style:header>\
-<style:header-left style:display=\"false\" />\
-<style:footer>\
-<text:p>\
-Seite\
-<text:page-number>1</text:page-number>\
-</text:p>\
-</style:footer>\
-<style:footer-left style:display=\"false\" />\
-</style:master-page>\
-<style:master-page style:name=\"Report\" style:page-layout-name=\"Mpm2\">\
-<style:header>\
-<style:region-left>\
-<text:p>\
-<text:sheet-name>p</text:sheet-name>(<text:title>p</text:title>)\
-</text:p>\
-</style:region-left>\
-<style:region-right>\
-<text:p>\
-<text:date style:data-style-name=\"N2\" text:date-value=\"2010-11-20\">20.11.2010</text:date>,<text:time>12:55:07</text:time>\
-</text:p>\
-</style:region-right>\
-</style:header>\
-<style:header-left style:display=\"false\" />\
-<style:footer>\
-<text:p>Seite <text:page-number>1</text:page-number>/<text:page-count>99</text:page-count>\
-</text:p>\
-</style:footer>\
-<style:footer-left style:display=\"false\" /> \
-</style:master-page>\
-</office:master-styles>\
-</office:document-styles>\
-");
-
-  meta =
-      _T("<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\" ?>\
-<office:document-meta xmlns:office=\"urn:oasis:names:tc:opendocument:xmlns:office:1.0\" xmlns:meta=\"urn:oasis:names:tc:opendocument:xmlns:meta:1.0\" xmlns:dc=\"http://purl.org/dc/elements/1.1/\" xmlns:xlink=\"http://www.w3.org/1999/xlink\" office:version=\"1.1\">\
-<office:meta>\
-<meta:generator>OpenCPN-Logbook</meta:generator>\
-<dc:creator>OpenCPN</dc:creator>\
-<dc:date>2010-11-19T20:43:36Z</dc:date>\
-<meta:editing-duration>PT0S</meta:editing-duration>\
-</office:meta>\
-</office:document-meta>");
-
-  xmlHead =
-      _T("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\
-<?mso-application progid=\"Excel.Sheet\"?>\
-<Workbook xmlns:c=\"urn:schemas-microsoft-com:office:component:spreadsheet\" xmlns:html=\"http://www.w3.org/TR/REC-html40\" xmlns:o=\"urn:schemas-microsoft-com:office:office\" xmlns:xsi=\"http://www.w3.org/2001/XMLSchema-instance\" xmlns=\"urn:schemas-microsoft-com:office:spreadsheet\" xmlns:x2=\"http://schemas.microsoft.com/office/excel/2003/xml\" xmlns:ss=\"urn:schemas-microsoft-com:office:spreadsheet\" xmlns:x=\"urn:schemas-microsoft-com:office:excel\">\
-<OfficeDocumentSettings xmlns=\"urn:schemas-microsoft-com:office:office\">\
-<Colors>\
-<Color>\
-<Index>3</Index>\
-<RGB>#c0c0c0</RGB>\
-</Color>\
-<Color>\
-<Index>4</Index>\
-<RGB>#ff0000</RGB>\
-</Color>\
-</Colors>\
-</OfficeDocumentSettings>\
-<ExcelWorkbook xmlns=\"urn:schemas-microsoft-com:office:excel\">\
-<WindowHeight>9000</WindowHeight>\
-<WindowWidth>13860</WindowWidth>\
-<WindowTopX>240</WindowTopX>\
-<WindowTopY>75</WindowTopY>\
-<ProtectStructure>False</ProtectStructure>\
-<ProtectWindows>False</ProtectWindows>\
-</ExcelWorkbook>\
-<Styles>\
-<Style ss:ID=\"Default\" ss:Name=\"Default\"/>\
-<Style ss:ID=\"Result\" ss:Name=\"Result\">\
-<Font ss:Bold=\"1\" ss:Italic=\"1\" ss:Underline=\"Single\"/>\
-</Style>\
-<Style ss:ID=\"Result2\" ss:Name=\"Result2\">\
-<Font ss:Bold=\"1\" ss:Italic=\"1\" ss:Underline=\"Single\"/>\
-<NumberFormat ss:Format=\"Euro Currency\"/>\
-</Style><Style ss:ID=\"Heading\" ss:Name=\"Heading\">\
-<Font ss:Bold=\"1\" ss:Italic=\"1\" ss:Size=\"16\"/>\
-</Style>\
-<Style ss:ID=\"Heading1\" ss:Name=\"Heading1\">\
-<Font ss:Bold=\"1\" ss:Italic=\"1\" ss:Size=\"16\"/>\
-</Style>\
-<Style ss:ID=\"co1\"/><Style ss:ID=\"ta1\"/><Style ss:ID=\"ta_extref\"/>\
-</Styles>\
-<ss:Worksheet ss:Name=\"Tabelle1\">\
-<Table ss:StyleID=\"ta1\">\
-<Column ss:Span=\"1\" ss:Width=\"64.2614\"/>");
-  xmlEnd =
-      _T("</Table>\
-<x:WorksheetOptions/>\
-</ss:Worksheet>\
-</Workbook>");
+  // XML-String for Export Excel, the boat export writes it itself
+  xmlHead = ExportTemplates::xmlHead;
+  xmlEnd = ExportTemplates::xmlEnd;
 
   kmlHead =
       _T("<?xml version=\"1.0\" encoding=\"utf-8\"?>\n\
@@ -8538,6 +8305,9 @@ SelectLogbook::SelectLogbook(wxWindow* parent, wxString path, wxWindowID id,
 
   // Cell Defaults
   m_grid13->SetDefaultCellAlignment(wxALIGN_LEFT, wxALIGN_TOP);
+  m_grid13->GetGridWindow()->SetToolTip(
+      _("Select several logbooks with Ctrl or Shift to view them as one "
+        "voyage"));
   bSizer23->Add(m_grid13, 1, wxALL | wxEXPAND, 5);
 
   m_sdbSizer4 = new wxStdDialogButtonSizer();
@@ -8578,6 +8348,30 @@ SelectLogbook::~SelectLogbook() {
                        wxKeyEventHandler(SelectLogbook::OnKeyDown), NULL, this);
 }
 
+// an archive may have been sealed while the dialog was open
+wxString SelectLogbook::file(int row) {
+  wxString f = files[row];
+  if (!wxFileExists(f) && wxFileExists(SealedLogbook::sealedPath(f)))
+    f = SealedLogbook::sealedPath(f);
+  return f;
+}
+
+// the logbooks of all selected rows, oldest first and the active one last
+wxArrayString SelectLogbook::selectedFiles() {
+  wxArrayString selected, active;
+  wxArrayInt rows = m_grid13->GetSelectedRows();
+  for (unsigned int i = 0; i < rows.Count(); i++) {
+    if (rows[i] < 0 || rows[i] >= (int)files.Count()) continue;
+    if (wxFileName(files[rows[i]]).GetName() == "logbook")
+      active.Add(file(rows[i]));
+    else
+      selected.Add(file(rows[i]));
+  }
+  selected.Sort();  // the until_ names carry the date
+  WX_APPEND_ARRAY(selected, active);
+  return selected;
+}
+
 void SelectLogbook::OnKeyDown(wxKeyEvent& event) {
   wxTextCtrl* ctrl = (wxTextCtrl*)event.GetEventObject();
   if (event.ShiftDown() && event.GetKeyCode() == WXK_RETURN) {
@@ -8650,6 +8444,7 @@ void SelectLogbook::OnInit(wxInitDialogEvent& ev) {
 
   unsigned int i =
       wxDir::GetAllFiles(path, &files, "*logbook.txt", wxDIR_FILES);
+  wxDir::GetAllFiles(path, &files, "*logbook.lbz", wxDIR_FILES);
 
   for (i = 0; i < files.Count(); i++) {
     wxFileName fn(files[i]);
@@ -8662,16 +8457,36 @@ void SelectLogbook::OnInit(wxInitDialogEvent& ev) {
     else
       back = false;
 
-    wxTextFile text(files[i]);
-    text.Open();
-    if (text.GetLineCount() > 1) {
-      wxString z = text.GetFirstLine();
+    // a sealed archive inflates just its first and last block
+    bool sealed = SealedLogbook::isSealed(files[i]);
+    wxString z, t, last;
+    size_t lines = 0;
+    if (sealed) {
+      SealedLogbook s;
+      if (s.open(files[i]) && s.rows() > 0) {
+        lines = s.rows() + 1;
+        z = s.header();
+        t = s.line(0);
+        last = s.line(s.rows() - 1);
+      }
+    } else {
+      wxTextFile text(files[i]);
+      text.Open();
+      lines = text.GetLineCount();
+      if (lines > 1) {
+        z = text.GetFirstLine();
+        t = text.GetNextLine();
+        last = text.GetLastLine();
+      }
+      text.Close();
+    }
+
+    if (lines > 1) {
       if (!z.IsEmpty()) {
         wxStringTokenizer header(z, "\t");
         header.GetNextToken();
         description = header.GetNextToken();
         description = parent->restoreDangerChar(description);
-        wxString t = text.GetNextLine();
         wxStringTokenizer tk(t, "\t");
         routeFrom = tk.GetNextToken();
         int month = wxAtoi(tk.GetNextToken());
@@ -8680,7 +8495,6 @@ void SelectLogbook::OnInit(wxInitDialogEvent& ev) {
         dtfrom.Set(day, (wxDateTime::Month)month, year);
       }
 
-      wxString last = text.GetLastLine();
       if (!last.IsEmpty()) {
         wxStringTokenizer ll(last, "\t");
         routeTo = ll.GetNextToken();
@@ -8699,10 +8513,11 @@ void SelectLogbook::OnInit(wxInitDialogEvent& ev) {
       description = _("Active Logbook");
       m_grid13->SetReadOnly(i, 2);
     }
+    if (sealed) m_grid13->SetReadOnly(i, 2);  // the header is not editable
     m_grid13->SetReadOnly(i, 0);
     m_grid13->SetReadOnly(i, 1);
     m_grid13->SetReadOnly(i, 3);
-    if (text.GetLineCount() > 1) {
+    if (lines > 1) {
       m_grid13->SetCellValue(i, 0, routeFrom + " -> " + routeTo);
       if (dtfrom.IsValid() && dtto.IsValid())
         m_grid13->SetCellValue(
@@ -8716,92 +8531,57 @@ void SelectLogbook::OnInit(wxInitDialogEvent& ev) {
     m_grid13->SetCellValue(i, 2, description);
     m_grid13->SetCellEditor(i, 2, new wxGridCellAutoWrapStringEditor);
     m_grid13->SetCellValue(i, 3, files[i]);
-
-    text.Close();
   }
 
   m_grid13->AutoSize();
 }
 
 //////////////////////////// myGridStringTable /////////
-#include <wx/arrimpl.cpp> 
-WX_DEFINE_OBJARRAY(myGridStringArray)
-
-myGridStringTable::myGridStringTable() : wxGridTableBase() {}
+myGridStringTable::myGridStringTable() : wxGridTableBase(), m_numCols(0) {}
 
 myGridStringTable::myGridStringTable(int numRows, int numCols)
-    : wxGridTableBase() {
-  m_data.Alloc(numRows);
-
-  wxArrayString sa;
-  sa.Alloc(numCols);
-  sa.Add(wxEmptyString, numCols);
-
-  m_data.Add(sa, numRows);
+    : wxGridTableBase(), m_numCols(numCols) {
+  m_data.assign(numRows, cellRow(numCols));
 }
 
 myGridStringTable::~myGridStringTable() {}
 
-int myGridStringTable::GetNumberRows() { return m_data.GetCount(); }
+int myGridStringTable::GetNumberRows() { return m_data.size(); }
 
-int myGridStringTable::GetNumberCols() {
-  if (m_data.GetCount() > 0)
-    return m_data[0].GetCount();
-  else
-    return 0;
-}
+int myGridStringTable::GetNumberCols() { return m_numCols; }
 
 wxString myGridStringTable::GetValue(int row, int col) {
   wxCHECK_MSG((row < GetNumberRows()) && (col < GetNumberCols()), wxEmptyString,
               "invalid row or column index in myGridStringTable");
 
-  return m_data[row][col];
+  return m_data[row][col].str();
 }
 
 void myGridStringTable::SetValue(int row, int col, const wxString& value) {
   wxCHECK_RET((row < GetNumberRows()) && (col < GetNumberCols()),
               "invalid row or column index in myGridStringTable");
 
-  m_data[row][col] = value;
+  m_data[row][col] = CellPool::Cell(value);
 }
 
 bool myGridStringTable::IsEmptyCell(int row, int col) {
   wxCHECK_MSG((row < GetNumberRows()) && (col < GetNumberCols()), true,
               "invalid row or column index in myGridStringTable");
 
-  return (m_data[row][col] == wxEmptyString);
+  return m_data[row][col].IsEmpty();
 }
 
 void myGridStringTable::Clear() {
-  int row, col;
-  int numRows, numCols;
-
-  numRows = m_data.GetCount();
-  if (numRows > 0) {
-    numCols = m_data[0].GetCount();
-
-    for (row = 0; row < numRows; row++) {
-      for (col = 0; col < numCols; col++) {
-        m_data[row][col] = wxEmptyString;
-      }
-    }
-  }
+  for (size_t row = 0; row < m_data.size(); row++)
+    m_data[row].assign(m_numCols, CellPool::Cell());
 }
 
 bool myGridStringTable::InsertRows(size_t pos, size_t numRows) {
-  size_t curNumRows = m_data.GetCount();
-  size_t curNumCols =
-      (curNumRows > 0 ? m_data[0].GetCount()
-                      : (GetView() ? GetView()->GetNumberCols() : 0));
-
-  if (pos >= curNumRows) {
+  if (pos >= m_data.size()) {
     return AppendRows(numRows);
   }
 
-  wxArrayString sa;
-  sa.Alloc(curNumCols);
-  sa.Add(wxEmptyString, curNumCols);
-  m_data.Insert(sa, pos, numRows);
+  m_data.insert(m_data.begin() + pos, numRows, cellRow(m_numCols));
 
   if (GetView()) {
     wxGridTableMessage msg(this, wxGRIDTABLE_NOTIFY_ROWS_INSERTED, pos,
@@ -8814,18 +8594,7 @@ bool myGridStringTable::InsertRows(size_t pos, size_t numRows) {
 }
 
 bool myGridStringTable::AppendRows(size_t numRows) {
-  size_t curNumRows = m_data.GetCount();
-  size_t curNumCols =
-      (curNumRows > 0 ? m_data[0].GetCount()
-                      : (GetView() ? GetView()->GetNumberCols() : 0));
-
-  wxArrayString sa;
-  if (curNumCols > 0) {
-    sa.Alloc(curNumCols);
-    sa.Add(wxEmptyString, curNumCols);
-  }
-
-  m_data.Add(sa, numRows);
+  m_data.resize(m_data.size() + numRows, cellRow(m_numCols));
 
   if (GetView()) {
     wxGridTableMessage msg(this, wxGRIDTABLE_NOTIFY_ROWS_APPENDED, numRows);
@@ -8837,7 +8606,7 @@ bool myGridStringTable::AppendRows(size_t numRows) {
 }
 
 bool myGridStringTable::DeleteRows(size_t pos, size_t numRows) {
-  size_t curNumRows = m_data.GetCount();
+  size_t curNumRows = m_data.size();
 
   if (pos >= curNumRows) {
     wxFAIL_MSG(wxString::Format(
@@ -8852,11 +8621,7 @@ bool myGridStringTable::DeleteRows(size_t pos, size_t numRows) {
     numRows = curNumRows - pos;
   }
 
-  if (numRows >= curNumRows) {
-    m_data.Clear();
-  } else {
-    m_data.RemoveAt(pos, numRows);
-  }
+  m_data.erase(m_data.begin() + pos, m_data.begin() + pos + numRows);
 
   if (GetView()) {
     wxGridTableMessage msg(this, wxGRIDTABLE_NOTIFY_ROWS_DELETED, pos, numRows);
@@ -8868,14 +8633,7 @@ bool myGridStringTable::DeleteRows(size_t pos, size_t numRows) {
 }
 
 bool myGridStringTable::InsertCols(size_t pos, size_t numCols) {
-  size_t row, col;
-
-  size_t curNumRows = m_data.GetCount();
-  size_t curNumCols =
-      (curNumRows > 0 ? m_data[0].GetCount()
-                      : (GetView() ? GetView()->GetNumberCols() : 0));
-
-  if (pos >= curNumCols) {
+  if (pos >= m_numCols) {
     return AppendCols(numCols);
   }
 
@@ -8887,11 +8645,9 @@ bool myGridStringTable::InsertCols(size_t pos, size_t numCols) {
       m_colLabels[i] = wxGridTableBase::GetColLabelValue(i);
   }
 
-  for (row = 0; row < curNumRows; row++) {
-    for (col = pos; col < pos + numCols; col++) {
-      m_data[row].Insert(wxEmptyString, col);
-    }
-  }
+  for (size_t row = 0; row < m_data.size(); row++)
+    m_data[row].insert(m_data[row].begin() + pos, numCols, CellPool::Cell());
+  m_numCols += numCols;
 
   if (GetView()) {
     wxGridTableMessage msg(this, wxGRIDTABLE_NOTIFY_COLS_INSERTED, pos,
@@ -8904,23 +8660,9 @@ bool myGridStringTable::InsertCols(size_t pos, size_t numCols) {
 }
 
 bool myGridStringTable::AppendCols(size_t numCols) {
-  size_t row;
-
-  size_t curNumRows = m_data.GetCount();
-
-#if 0
-    if ( !curNumRows )
-    {
-        // TODO: something better than this ?
-        //
-        wxFAIL_MSG( "Unable to append cols to a grid table with no rows.\nCall AppendRows() first" );
-        return false;
-    }
-#endif
-
-  for (row = 0; row < curNumRows; row++) {
-    m_data[row].Add(wxEmptyString, numCols);
-  }
+  m_numCols += numCols;
+  for (size_t row = 0; row < m_data.size(); row++)
+    m_data[row].resize(m_numCols);
 
   if (GetView()) {
     wxGridTableMessage msg(this, wxGRIDTABLE_NOTIFY_COLS_APPENDED, numCols);
@@ -8932,12 +8674,7 @@ bool myGridStringTable::AppendCols(size_t numCols) {
 }
 
 bool myGridStringTable::DeleteCols(size_t pos, size_t numCols) {
-  size_t row;
-
-  size_t curNumRows = m_data.GetCount();
-  size_t curNumCols =
-      (curNumRows > 0 ? m_data[0].GetCount()
-                      : (GetView() ? GetView()->GetNumberCols() : 0));
+  size_t curNumCols = m_numCols;
 
   if (pos >= curNumCols) {
     wxFAIL_MSG(wxString::Format(
@@ -8965,13 +8702,10 @@ bool myGridStringTable::DeleteCols(size_t pos, size_t numCols) {
     if (nToRm > 0) m_colLabels.RemoveAt(colID, nToRm);
   }
 
-  for (row = 0; row < curNumRows; row++) {
-    if (numCols >= curNumCols) {
-      m_data[row].Clear();
-    } else {
-      m_data[row].RemoveAt(colID, numCols);
-    }
-  }
+  for (size_t row = 0; row < m_data.size(); row++)
+    m_data[row].erase(m_data[row].begin() + colID,
+                      m_data[row].begin() + colID + numCols);
+  m_numCols -= numCols;
 
   if (GetView()) {
     wxGridTableMessage msg(this, wxGRIDTABLE_NOTIFY_COLS_DELETED, pos, numCols);
@@ -8982,6 +8716,15 @@ bool myGridStringTable::DeleteCols(size_t pos, size_t numCols) {
   return true;
 }
 
+// stable, rows with equal cells keep their order
+void myGridStringTable::SortRows(int col, bool ascending) {
+  stable_sort(m_data.begin(), m_data.end(),
+              [col, ascending](const cellRow& a, const cellRow& b) {
+                return ascending ? a[col].str() < b[col].str()
+                                 : b[col].str() < a[col].str();
+              });
+}
+
 wxString myGridStringTable::GetRowLabelValue(int row) {
   if (row > (int)(m_rowLabels.GetCount()) - 1) {
     // using default label
@@ -10182,14 +9925,13 @@ void TimerInterval::OnClose(wxCloseEvent& event) {
 
   if (ok == true &&
       (opt->timerType == 0 && !dialog->logbookPlugIn->eventsEnabled)) {
-    if (dialog->logbookPlugIn->m_timer->IsRunning())
-      dialog->logbookPlugIn->m_timer->Stop();
+    dialog->scheduler->stopInterval();
     if (opt->timerSec > 0 && dialog->logbookPlugIn->opt->timerType == 0)
-      dialog->logbookPlugIn->m_timer->Start(opt->timerSec);
+      dialog->scheduler->startInterval(opt->timerSec);
   } else if (ok == true && opt->timerType != 0) {
-    if (dialog->logbookPlugIn->m_timer->IsRunning())
-      dialog->logbookPlugIn->m_timer->Stop();
+    dialog->scheduler->stopInterval();
   }
+  if (ok) dialog->loadTimerEx();
 
   dialog->setTitleExt();
   dialog->SetTitle(dialog->logbook->title + dialog->titleExt);
@@ -10216,7 +9958,7 @@ void TimerInterval::OnRadioButtonIndividual(wxCommandEvent& event) {
 void TimerInterval::OnSpinCtrlFullh(wxSpinEvent& event) {
   if (m_spinCtrl4->GetValue() != oldFullHour) {
     dialog->fullHourPlus = m_spinCtrl4->GetValue();
-    dialog->fullHourModified = true;
+    dialog->scheduler->restartFullHour();
   }
 }
 
@@ -10419,7 +10161,7 @@ void TimerInterval::init(Options* opt, LogbookDialog* dialog) {
   this->opt = opt;
   this->dialog = dialog;
   timerruns = false;
-  dialog->fullHourModified = true;
+  dialog->scheduler->restartFullHour();
   oldSpinH = opt->thour;
   oldSpinM = opt->tmin;
   oldSpinS = opt->tsec;
@@ -27,10 +27,13 @@
 #ifndef __LOGBOOKDIALOG__
 #define __LOGBOOKDIALOG__
 
+#include "CellPool.h"
 #include "CrewList.h"
 #include "Maintenance.h"
 #include "boat.h"
 #include "OverView.h"
+#include "RowLayout.h"
+#include "TextBlocks.h"
 #include "tinyxml.h"
 
 #include <wx/string.h>
@@ -55,6 +58,7 @@
 #include <wx/treectrl.h>
 #include <wx/dialog.h>
 #include <wx/filepicker.h>
+#include <wx/gauge.h>
 #include <wx/radiobox.h>
 #include <wx/calctrl.h>
 #include <wx/tglbtn.h>
@@ -64,6 +68,8 @@
 #include <wx/dnd.h>
 #include <wx/jsonreader.h>
 
+#include <vector>
+
 ///////////////////////////////////////////////////////////////////////////
 
 #define LOGGRIDS 3
@@ -89,6 +95,8 @@
 #define MENUFLIP				519
 #define MENUWAKECHANGE			520
 #define SELECT_TRACK			521
+#define TEXTBLOCKS				600
+#define MAXTEXTBLOCKS			400
 
 #define GPSTIMEOUT 5000
 #define LOGSAVETIME 900000
@@ -101,6 +109,10 @@ class Logbook;
 class logbookkonni_pi;
 class ColdFinger;
 class LogbookTimer;
+class LogbookScheduler;
+class ExportJob;
+class ExportSink;
+struct ExportRecord;
 class myBitmapButton;
 class wxJSONReader;
 
@@ -126,7 +138,14 @@ private:
     void				clearDataDir();
     void				addColdFingerDialog( wxMenu* m_menu1 );
     void				addColdFingerTextBlocks( wxMenu* m_menu1 );
-    wxTreeItemId		FindMenuItem( int grid, int col, wxString name );
+    void				rebuildTextBlocks();
+    void				OnGridEditorCreatedTextBlocks( wxGridEditorCreatedEvent& event );
+    void				OnTextCompleteTextBlocks( wxCommandEvent& event );
+
+    TextBlocks			textBlocks;
+    std::map<std::pair<int,int>, std::vector<wxMenuItem*> > textBlockMenus;
+    size_t				completeLength;
+    bool				completing;
     void				labelLeftClick( wxGridEvent& event, wxGrid* grid );
 
 public:
@@ -528,7 +547,6 @@ public:
     void OnSplitterSashPositionChangedWake( wxSplitterEvent& event );
     void OnGridLabelRightClickWake( wxGridEvent& event );
     void OnGridLabelLeftClickWake( wxGridEvent& event );
-    void OnIdleMainDialog( wxIdleEvent& event );
     void OnButtonClickStatusTimer( wxCommandEvent& event );
     void OnStatusBulletTimer( wxCommandEvent& event );
     void OnStatusBulletWatch( wxCommandEvent& event );
@@ -562,6 +580,8 @@ public:
     void gridGlobalScrolled( wxScrollWinEvent& event );
     void gridWeatherScrolled( wxScrollWinEvent& event );
     void gridMotorSailsScrolled( wxScrollWinEvent& event );
+    void queuePageOlderRows();
+    void pageOlderRows();
 
     void appendOSDirSlash( wxString* pString );
 
@@ -647,7 +667,7 @@ public:
     wxGrid* m_gridMaintenanceBuyParts;
     wxPanel* m_panelPolar;
 
-    LogbookDialog( logbookkonni_pi* d, wxTimer* t, LogbookTimer* lt, wxWindow* parent, wxWindowID id = wxID_ANY, const wxString& title = _( "Active Logbook" ), const wxPoint& pos = wxDefaultPosition, const wxSize& size = wxSize( 1010,535 ), long style = wxDEFAULT_DIALOG_STYLE|wxMAXIMIZE_BOX|wxMINIMIZE_BOX|wxRESIZE_BORDER );
+    LogbookDialog( logbookkonni_pi* d, LogbookTimer* lt, wxWindow* parent, wxWindowID id = wxID_ANY, const wxString& title = _( "Active Logbook" ), const wxPoint& pos = wxDefaultPosition, const wxSize& size = wxSize( 1010,535 ), long style = wxDEFAULT_DIALOG_STYLE|wxMAXIMIZE_BOX|wxMINIMIZE_BOX|wxRESIZE_BORDER );
     ~LogbookDialog();
 
     void m_gridGlobalOnContextMenu( wxMouseEvent &event )
@@ -683,11 +703,14 @@ public:
     wxString restoreDangerChar( wxString s );
     void startBrowser( wxString filename );
     void startApplication( wxString filename, wxString ext );
+    void exportInBackground( ExportSink* sink, wxString path );
+    void exportInBackground( ExportSink* sink, wxString path, wxString title,
+                             const wxArrayString& labels,
+                             std::vector<ExportRecord>& rows );
     void loadLayoutChoice( int grid, wxString path, wxChoice* choice, wxString filter );
     void setEqualRowHeight( int row );
+    void setEqualRowHeights();
     void init();
-    void OnTimerGPS( wxTimerEvent& ev );
-    void OnLogTimer( wxTimerEvent& ev );
     void OnTimerSails( wxTimerEvent& ev );
     int  showLayoutDialog( int grid, wxChoice *choice, wxString location, int format );
     bool isInArrayString( wxArrayString ar, wxString s );
@@ -736,13 +759,17 @@ public:
     wxString			layoutHTML;
     wxString			layoutODT;
     LogbookTimer*		logbookTimerWindow;
-    wxTimer*            timer;
-    wxTimer*			GPSTimer;
+    LogbookScheduler*	scheduler;
+    ExportJob*			exportJob;
+    wxPanel*			exportBar;		// progress of exportJob below the pages
+    wxStaticText*		exportText;
+    wxGauge*			exportGauge;
+    wxButton*			exportCancel;
+    bool				pagePending;
+    RowLayout			rowLayout;
     wxTimer*			SailsTimer;
     bool				statusGPS;
-    wxTimer*			logbookTimer;
     int					fullHourPlus;
-    bool				fullHourModified;
     int					sashPos;
 
     wxColour			defaultBackground;
@@ -761,13 +788,6 @@ public:
     int					totalColumns;
     wxFont				font;
 
-    // ODT-Strings for Export
-    wxString			content;
-    wxString			contentEnd;
-    wxString			manifest;
-    wxString			styles;
-    wxString			meta;
-
     // XML-String for Export Excel
     wxString			xmlHead;
     wxString			xmlEnd;
@@ -873,6 +893,9 @@ public:
     wxArrayString files;
     int selRow;
 
+    wxString      file( int row );
+    wxArrayString selectedFiles();
+
 #ifdef __WXMSW__
     SelectLogbook( wxWindow* parent, wxString path, wxWindowID id = wxID_ANY, const wxString& title = _( "Select Logbook" ), const wxPoint& pos = wxDefaultPosition, const wxSize& size = wxSize( 700,252 ), long style = wxDEFAULT_DIALOG_STYLE|wxRESIZE_BORDER );
 #else
@@ -883,9 +906,11 @@ public:
 };
 
 ///////////////////////////////////////////////////////////////////////////
-WX_DECLARE_OBJARRAY( wxArrayString, myGridStringArray ); //(,
-//class WXDLLIMPEXP_ADV);
-
+/**
+ * The table behind the logbook, crew and maintenance grids. A cell is a
+ * handle into the CellPool, so repeated texts are stored once and cells
+ * compare by pointer with GetCell().
+ */
 class myGridStringTable : public wxGridTableBase
 {
 public:
@@ -916,10 +941,14 @@ public:
     wxString GetRowLabelValue( int row );
     wxString GetColLabelValue( int col );
 
-    wxGridStringArray m_data;
+    const CellPool::Cell& GetCell( int row, int col ) const { return m_data[row][col]; }
+    void SortRows( int col, bool ascending );
 
 private:
+    typedef std::vector<CellPool::Cell> cellRow;
 
+    std::vector<cellRow> m_data;
+    size_t            m_numCols;
 
     // These only get used if you set your own labels, otherwise the
     // GetRow/ColLabelValue functions return wxGridTableBase defaults
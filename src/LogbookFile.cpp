@@ -0,0 +1,162 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef WX_PRECOMP
+#include <wx/wx.h>
+#endif
+
+#include <wx/datetime.h>
+#include <wx/dir.h>
+#include <wx/filename.h>
+#include <wx/tokenzr.h>
+
+#include "LogbookFile.h"
+
+using namespace std;
+
+#define WOFS LogbookFile::NAVCOLS
+#define MOFS (LogbookFile::NAVCOLS + LogbookFile::WEATHERCOLS)
+
+// names are part of the plugin message API, never translate them
+static const char* names[LogbookFile::COLUMNS] = {
+    "Route",        "Date",           "Time",         "Status",
+    "Watch",        "Distance",       "DistanceTotal", "Position",
+    "COG",          "Heading",        "SOG",          "STW",
+    "Depth",        "Remarks",
+    "Pressure",     "Humidity",       "AirTemperature", "WaterTemperature",
+    "WindDirection", "WindSpeed",     "WindDirectionApparent",
+    "WindSpeedApparent", "Current",   "CurrentSpeed", "Wave",
+    "Swell",        "Weather",        "Clouds",       "Visibility",
+    "Motor",        "MotorTotal",     "RPM1",         "Motor1",
+    "Motor1Total",  "RPM2",           "Fuel",         "FuelTotal",
+    "Sails",        "Reef",           "Generator",    "GeneratorTotal",
+    "Bank1",        "Bank1Total",     "Bank2",        "Bank2Total",
+    "Watermaker",   "WatermakerTotal", "WatermakerOutput", "Water",
+    "WaterTotal",   "MotorRemarks",   "RouteGUID",    "TrackGUID"};
+
+// position of every file field in a record, -1 for the date/time parts
+const int LogbookFile::fieldToColumn[LogbookFile::FILEFIELDS] = {
+    0, -1, -1, -1, -1, -1,
+    -1, 3, 4, 5, 6, 7,
+    8, 9, 10, 11, 12, 13,
+    WOFS + 0, WOFS + 4, WOFS + 5, WOFS + 8, WOFS + 9, WOFS + 10,
+    WOFS + 11, WOFS + 12, WOFS + 13, WOFS + 14, MOFS + 0, MOFS + 1,
+    MOFS + 6, MOFS + 7, MOFS + 8, MOFS + 9, MOFS + 19, MOFS + 20,
+    MOFS + 21, WOFS + 1, WOFS + 2, WOFS + 3, MOFS + 3, MOFS + 4,
+    MOFS + 10, MOFS + 11, MOFS + 12, MOFS + 13, MOFS + 14, MOFS + 15,
+    MOFS + 16, MOFS + 17, MOFS + 18, MOFS + 22, MOFS + 23, MOFS + 2,
+    MOFS + 5, WOFS + 6, WOFS + 7};
+
+wxString LogbookFile::columnName(int col) {
+  if (col < 0 || col >= COLUMNS) return wxEmptyString;
+  return names[col];
+}
+
+int LogbookFile::column(const wxString& name) {
+  long n;
+  if (name.ToLong(&n)) return (n >= 0 && n < COLUMNS) ? (int)n : -1;
+  for (int i = 0; i < COLUMNS; i++)
+    if (name.CmpNoCase(names[i]) == 0) return i;
+  return -1;
+}
+
+void LogbookFile::gridColumn(int col, int* grid, int* gridCol) {
+  if (col < WOFS) {
+    *grid = 0;
+    *gridCol = col;
+  } else if (col < MOFS) {
+    *grid = 1;
+    *gridCol = col - WOFS;
+  } else {
+    *grid = 2;
+    *gridCol = col - MOFS;
+  }
+}
+
+// the column a file field goes to, -1 for the date/time parts
+int LogbookFile::fieldColumn(int field) {
+  if (field < 0 || field >= FILEFIELDS) return -1;
+  return fieldToColumn[field];
+}
+
+wxString LogbookFile::restore(const wxString& s) {
+  wxString r = s;
+  r.Replace("\\n", "\n");
+  if (!r.IsEmpty()) r.RemoveLast();  // every field is written with a blank
+  return r;
+}
+
+bool LogbookFile::parse(const wxString& line, wxArrayString& record) {
+  if (line.IsEmpty() || line.StartsWith("#1.2#")) return false;
+
+  record.Clear();
+  record.Add(wxEmptyString, COLUMNS);
+
+  long date[3] = {-1, -1, -1}, time[3] = {-1, -1, -1};
+  wxStringTokenizer tkz(line, "\t", wxTOKEN_RET_EMPTY);
+  for (int c = 0; tkz.HasMoreTokens() && c < FILEFIELDS; c++) {
+    wxString s = restore(tkz.GetNextToken());
+    if (c >= 1 && c <= 3) {
+      if (!s.Trim().ToLong(&date[c - 1])) date[c - 1] = -1;
+    } else if (c >= 4 && c <= 6) {
+      if (!s.Trim().ToLong(&time[c - 4])) time[c - 4] = -1;
+    } else
+      record[fieldToColumn[c]] = s;
+  }
+
+  // file order is month (0-based), day, year
+  if (date[0] >= 0 && date[1] > 0 && date[2] > 0)
+    record[RDATE] = wxString::Format("%04ld-%02ld-%02ld", date[2], date[0] + 1,
+                                     date[1]);
+  if (time[0] >= 0 && time[1] >= 0)
+    record[RTIME] = wxString::Format("%02ld:%02ld:%02ld", time[0], time[1],
+                                     (time[2] < 0) ? 0L : time[2]);
+  return true;
+}
+
+wxString LogbookFile::timestamp(const wxArrayString& record) {
+  if (record[RDATE].IsEmpty()) return wxEmptyString;
+  return record[RDATE] + "T" +
+         (record[RTIME].IsEmpty() ? wxString("00:00:00") : record[RTIME]);
+}
+
+wxString LogbookFile::isoTimestamp(const wxString& s) {
+  wxDateTime dt;
+  if (dt.ParseISOCombined(s, 'T') || dt.ParseISOCombined(s, ' '))
+    return dt.FormatISOCombined('T');
+  if (dt.ParseISODate(s)) return dt.FormatISODate() + "T00:00:00";
+  return wxEmptyString;
+}
+
+bool LogbookFile::isArchive(const wxString& fileName) {
+  wxFileName fn(fileName);
+  return fn.GetName().StartsWith("until_") &&
+         fn.GetName().EndsWith("_logbook");
+}
+
+wxArrayString LogbookFile::archives(const wxString& dataDir) {
+  wxArrayString files;
+  if (wxDir::Exists(dataDir)) {
+    wxDir::GetAllFiles(dataDir, &files, "until_*_logbook.txt", wxDIR_FILES);
+    wxDir::GetAllFiles(dataDir, &files, "until_*_logbook.lbz", wxDIR_FILES);
+  }
+  // the names carry ISO date and time, so this is chronological
+  files.Sort();
+  return files;
+}
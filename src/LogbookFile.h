@@ -0,0 +1,63 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#ifndef _LOGBOOKFILE_H_
+#define _LOGBOOKFILE_H_
+
+#ifndef  WX_PRECOMP
+#include "wx/wx.h"
+#endif //precompiled headers
+
+#include <wx/arrstr.h>
+#include <wx/string.h>
+
+/**
+ * Reads the #1.2# logbook file format without any grid.
+ *
+ * A record holds one logbook line in the column order of Logbook::fields
+ * (navigation, weather, motor/sails grid). Date and time are kept as ISO
+ * strings ("2021-06-30", "14:05:00") so records sort and compare as text.
+ */
+class LogbookFile
+{
+public:
+    enum { NAVCOLS = 14, WEATHERCOLS = 15, MOTORCOLS = 24,
+           COLUMNS = NAVCOLS + WEATHERCOLS + MOTORCOLS,
+           FILEFIELDS = 57
+         };
+    enum { ROUTE = 0, RDATE = 1, RTIME = 2, POSITION = 7 };
+
+    static wxString columnName( int col );
+    static int      column( const wxString& name );
+    static void     gridColumn( int col, int* grid, int* gridCol );
+    static int      fieldColumn( int field );
+
+    static bool     parse( const wxString& line, wxArrayString& record );
+    static wxString timestamp( const wxArrayString& record );
+    static wxString isoTimestamp( const wxString& s );
+    static wxString restore( const wxString& s );
+
+    static wxArrayString archives( const wxString& dataDir );
+    static bool     isArchive( const wxString& fileName );
+
+private:
+    static const int fieldToColumn[FILEFIELDS];
+};
+#endif
@@ -33,6 +33,7 @@
 #include <wx/wfstream.h>
 #include <wx/zipstrm.h>
 
+#include "ExportPipeline.h"
 #include "Logbook.h"
 #include "LogbookHTML.h"
 #include "LogbookDialog.h"
@@ -289,7 +290,7 @@ wxString LogbookHTML::toHTML(wxString path, wxString layout, bool mode) {
   wxArrayInt arrayRows;
   int count = 0, selCount = 0;
   bool selection = false;
-  route = wxEmptyString;
+  route = CellPool::Cell();
 
   selCount = parent->m_gridGlobal->GetSelectedRows().Count();
 
@@ -420,7 +421,7 @@ wxString LogbookHTML::replacePlaceholder(wxString html, wxString htmlHeader,
       switch (col) {
         case ROUTE:
           if (route !=
-              Export::replaceNewLine(mode, g->GetCellValue(row, col), false)) {
+              ((myGridStringTable *)g->GetTable())->GetCell(row, col)) {
             htmlHeader.Replace(
                 "#ROUTE#",
                 Export::replaceNewLine(mode, g->GetCellValue(row, col), false));
@@ -430,8 +431,7 @@ wxString LogbookHTML::replacePlaceholder(wxString html, wxString htmlHeader,
                 false);
             htmlFile << htmlHeader;
           }
-          route =
-              Export::replaceNewLine(mode, g->GetCellValue(row, col), false);
+          route = ((myGridStringTable *)g->GetTable())->GetCell(row, col);
 
           break;
         case RDATE:
@@ -1047,7 +1047,7 @@ wxString LogbookHTML::toODT(wxString path, wxString layout, bool mode) {
   wxArrayInt arrayRows;
   int count = 0, selCount = 0;
   bool selection = false;
-  route = wxEmptyString;
+  route = CellPool::Cell();
 
   selCount = parent->m_gridGlobal->GetSelectedRows().Count();
 
@@ -1184,164 +1184,19 @@ wxString LogbookHTML::toODT(wxString path, wxString layout, bool mode) {
   return filename;
 }
 
-void LogbookHTML::toCSV(wxString path) {
-  wxString s, temp;
+void LogbookHTML::toCSV(wxString path) { toTables(path, "", ""); }
 
-  if (::wxFileExists(path)) ::wxRemoveFile(path);
-
-  wxFileOutputStream output(path);
-  wxTextOutputStream csvFile(output);
-
-  for (int n = 0; n < parent->numPages; n++) {
-    for (int i = 0; i < parent->logGrids[n]->GetNumberCols(); i++) {
-      wxString str = "\"" + parent->logGrids[n]->GetColLabelValue(i) + "\",";
-      if (i == LogbookHTML::POSITION && n == 0) {
-        csvFile << str;
-        csvFile << str;
-      } else
-        csvFile << str;
-    }
-  }
-  csvFile << "\n";
-  for (int row = 0; row < parent->m_gridGlobal->GetNumberRows(); row++) {
-    for (int grid = 0; grid < parent->numPages; grid++) {
-      for (int col = 0; col < parent->logGrids[grid]->GetNumberCols(); col++) {
-        temp = parent->logGrids[grid]->GetCellValue(row, col);
-        if (col == LogbookHTML::POSITION && grid == 0) {
-          wxStringTokenizer p(temp, "\n");
-          wxString lat = p.GetNextToken();
-          wxString lon = p.GetNextToken();
-          temp = lat + "\",\"" + lon;
-        }
-        s += "\"" + temp + "\",";
-      }
-    }
-    s.RemoveLast();
-    csvFile << s + "\n";
-    s = wxEmptyString;
-  }
-  output.Close();
-}
-
-void LogbookHTML::toXML(wxString path) {
-  wxString s = "";
-  wxString temp;
-
-  if (::wxFileExists(path)) ::wxRemoveFile(path);
-
-  wxFileOutputStream output(path);
-  wxTextOutputStream xmlFile(output);
-
-  xmlFile << parent->xmlHead;
-
-  s = wxString::Format("<Row>");
-  for (int n = 0; n < parent->numPages; n++) {
-    for (int i = 0; i < parent->logGrids[n]->GetNumberCols(); i++) {
-      s += "<Cell>\n";
-      s += "<Data ss:Type=\"String\">#DATA#</Data>\n";
-      s.Replace("#DATA#", parent->logGrids[n]->GetColLabelValue(i));
-      s += "</Cell>";
-    }
-  }
-  s += "</Row>>";
-  xmlFile << s;
-  for (int row = 0; row < parent->m_gridGlobal->GetNumberRows(); row++) {
-    xmlFile << wxString::Format("<Row ss:Height=\"%u\">",
-                                parent->m_gridGlobal->GetRowHeight(row));
-    for (int grid = 0; grid < parent->numPages; grid++) {
-      for (int col = 0; col < parent->logGrids[grid]->GetNumberCols(); col++) {
-        s = "<Cell>\n";
-        s += "<Data ss:Type=\"String\">#DATA#</Data>\n";
-        temp = parent->logGrids[grid]->GetCellValue(row, col);
-        temp.Replace("&", "&amp;");
-        temp.Replace("\\n", "&#xA;");
-        temp.Replace("\"", "&quot;");
-        temp.Replace("<", "&lt;");
-        temp.Replace(">", "&gt;");
-        temp.Replace("'", "&apos;");
-        s.Replace("#DATA#", temp);
-        s += "</Cell>";
-        xmlFile << s;
-      }
-    }
-    xmlFile << "</Row>>";
-    ;
-  }
-  xmlFile << parent->xmlEnd;
-  output.Close();
-}
-
-void LogbookHTML::toODS(wxString path) {
-  wxString s = "";
-  wxString line;
-  wxString temp;
-
-  wxFFileOutputStream out(path);
-  wxZipOutputStream zip(out);
-  wxTextOutputStream txt(zip);
-  wxString sep(wxFileName::GetPathSeparator());
-
-  zip.PutNextEntry("content.xml");
-  txt << parent->content;
-
-  txt << "<table:table-row table:style-name=\"ro2\">";
-
-  for (int n = 0; n < parent->numPages; n++) {
-    for (int i = 0; i < parent->logGrids[n]->GetNumberCols(); i++) {
-      txt << "<table:table-cell office:value-type=\"string\">";
-      txt << "<text:p>";
-      txt << parent->logGrids[n]->GetColLabelValue(i);
-      txt << "</text:p>";
-      txt << "</table:table-cell>";
-    }
-  }
-  txt << "</table:table-row>";
-  for (int row = 0; row < parent->m_gridGlobal->GetNumberRows(); row++) {
-    txt << "<table:table-row table:style-name=\"ro2\">";
-    for (int grid = 0; grid < parent->numPages; grid++) {
-      for (int col = 0; col < parent->logGrids[grid]->GetNumberCols(); col++) {
-        wxString s = parent->logGrids[grid]->GetCellValue(row, col);
-        s.Replace("&", "&amp;");
-        s.Replace("\"", "&quot;");
-        s.Replace("<", "&lt;");
-        s.Replace(">", "&gt;");
-        s.Replace("'", "&apos;");
-
-        txt << "<table:table-cell office:value-type=\"string\">";
-        txt << "<text:p>";
-        txt << s;
-        txt << "</text:p>";
-        txt << "</table:table-cell>";
-      }
-    }
-    txt << "</table:table-row>";
-  }
-  txt << parent->contentEnd;
-
-  zip.PutNextEntry("mimetype");
-  txt << "application/vnd.oasis.opendocument.spreadsheet";
-
-  zip.PutNextEntry("styles.xml");
-  txt << parent->styles;
-
-  zip.PutNextEntry("meta.xml");
-  txt << parent->meta;
-
-  zip.PutNextEntry("META-INF" + sep + "manifest.xml");
-  txt << parent->manifest;
-
-  zip.PutNextEntry("Thumbnails" + sep);
+void LogbookHTML::toXML(wxString path) { toTables("", path, ""); }
 
-  zip.PutNextEntry("Configurations2" + sep + "floater");
-  zip.PutNextEntry("Configurations2" + sep + "menubar");
-  zip.PutNextEntry("Configurations2" + sep + "popupmenu");
-  zip.PutNextEntry("Configurations2" + sep + "progressbar");
-  zip.PutNextEntry("Configurations2" + sep + "statusbar");
-  zip.PutNextEntry("Configurations2" + sep + "toolbar");
-  zip.PutNextEntry("Configurations2" + sep + "images" + sep + "Bitmaps");
+void LogbookHTML::toODS(wxString path) { toTables("", "", path); }
 
-  zip.Close();
-  out.Close();
+void LogbookHTML::toTables(wxString csv, wxString xml, wxString ods) {
+  ExportPipeline pipeline(parent, true);
+  if (!csv.IsEmpty()) pipeline.add(new CSVSink(csv));
+  if (!xml.IsEmpty()) pipeline.add(new XMLSink(xml));
+  if (!ods.IsEmpty())
+    pipeline.add(new ODSSink(ods, LogbookDialog::datePattern));
+  pipeline.run();
 }
 
 void LogbookHTML::backup(wxString path) {
@@ -1351,11 +1206,14 @@ void LogbookHTML::backup(wxString path) {
 
 void LogbookHTML::toKML(wxString path) {
   wxString datetime, position, description, temp, folder, t, header,
-      logpointName, route = "nil", oldroute, remarks, fRemarks, label, pathXML;
+      logpointName, oldroute, remarks, fRemarks, label, pathXML;
   wxString snil = "---";
   wxString trackID = wxEmptyString, trackOldID = wxEmptyString;
   wxString routeID = wxEmptyString, routeOldID = wxEmptyString;
 
+  CellPool::Cell route;
+  myGridStringTable *global =
+      (myGridStringTable *)parent->m_gridGlobal->GetTable();
   bool error = false, first = true, rfirst = true;
   wxDateTime dt;
   int maxRow = parent->m_gridGlobal->GetNumberRows(), row = 0;
@@ -1392,7 +1250,7 @@ void LogbookHTML::toKML(wxString path) {
           switch (col) {
             case LogbookHTML::ROUTE:
               // temp.Replace("#ROW#",wxString::Format(_("Row: %i"),row));
-              if (e != route) {
+              if (first || global->GetCell(row, col) != route) {
                 if (!first) (*kmlFile) << parent->kmlEndFolder;
                 first = false;
 
@@ -1400,7 +1258,7 @@ void LogbookHTML::toKML(wxString path) {
                 folder.Replace("#NAME#", e);
                 (*kmlFile) << folder;
 
-                route = e;
+                route = global->GetCell(row, col);
                 rfirst = true;
                 routeID = wxEmptyString;
 
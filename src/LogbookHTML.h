@@ -24,6 +24,8 @@
 #include <wx/txtstrm.h>
 #include <wx/jsonreader.h>
 
+#include "CellPool.h"
+
 class LogbookDialog;
 class Logbook;
 #include <map>
@@ -44,6 +46,7 @@ public:
     void toCSV( wxString path );
     void toXML( wxString path );
     void toODS( wxString path );
+    void toTables( wxString csv, wxString xml, wxString ods );
     void backup( wxString path );
     void setFileName( wxString s, wxString l );
     void setPlaceholders();
@@ -96,7 +99,7 @@ public:
     wxString layout_locn;
     wxString fileName;
 
-    wxString route;
+    CellPool::Cell route;
 
     wxTextOutputStream *kmlFile;
 };
@@ -40,6 +40,7 @@
 #include "Logbook.h"
 #include "LogbookDialog.h"
 #include "Options.h"
+#include "UnitConverter.h"
 #include "folder.xpm"
 #include "logbook_pi.h"
 
@@ -2395,8 +2396,32 @@ void LogbookOptions::onCheckBoxToolTips(wxCommandEvent& ev) {
   }
 }
 
+// the unit every quantity is logged in with these options
+static void unitTargets(Options* opt, int* units) {
+  units[UnitConverter::DISTANCE] = opt->showDistanceChoice;
+  units[UnitConverter::BOATSPEED] = opt->showBoatSpeedchoice;
+  units[UnitConverter::WINDSPEED] = opt->showWindSpeedchoice;
+  units[UnitConverter::DEPTH] = opt->showDepth;
+  units[UnitConverter::WAVE] = opt->showWaveSwell;
+  units[UnitConverter::TEMPERATURE] = Units::temperature(opt->temperature);
+  units[UnitConverter::VOLUME] = Units::volume(opt->vol);
+}
+
+static void unitLabels(Options* opt, UnitConverter& units) {
+  int q[] = {UnitConverter::DEPTH, UnitConverter::WAVE};
+  for (int i = 0; i < 2; i++) {
+    units.setLabel(q[i], 0, opt->meter);
+    units.setLabel(q[i], 1, opt->feet);
+    units.setLabel(q[i], 2, opt->fathom);
+  }
+  units.setLabel(UnitConverter::TEMPERATURE,
+                 Units::temperature(opt->temperature), opt->temperature);
+  units.setLabel(UnitConverter::VOLUME, Units::volume(opt->vol), opt->vol);
+}
+
 void LogbookOptions::OnButtonOKClick(wxCommandEvent& ev) {
   int iNewDateFormat;
+  int oldUnits[UnitConverter::QUANTITIES], newUnits[UnitConverter::QUANTITIES];
 
   int sel1 = m_choiceDate1->GetSelection();
   int sel2 = m_choiceDate2->GetSelection();
@@ -2415,8 +2440,10 @@ void LogbookOptions::OnButtonOKClick(wxCommandEvent& ev) {
     return;
   }
 
+  unitTargets(opt, oldUnits);
   getValues();
   updateChoiceBoxes();
+  unitTargets(opt, newUnits);
 
   LogbookDialog* dlg = log_pi->m_plogbook_window;
 
@@ -2446,6 +2473,24 @@ void LogbookOptions::OnButtonOKClick(wxCommandEvent& ev) {
   } else
     ev.Skip();
 
+  // what was logged so far may follow the new units
+  UnitConverter units;
+  for (int q = 0; q < UnitConverter::QUANTITIES; q++)
+    if (newUnits[q] != oldUnits[q]) units.setTarget(q, newUnits[q]);
+  if (NULL != dlg && units.hasTarget() &&
+      wxMessageBox(_("The units have changed.\n\nConvert the logbook and "
+                     "its archives to the new units ?"),
+                   _("Units"), wxYES_NO | wxICON_QUESTION, this) == wxYES) {
+    unitLabels(opt, units);
+    dlg->logbook->update();
+    if (!units.convertDir(dlg->data))
+      wxMessageBox(_("Not all logbooks could be converted."));
+    if (!modified) {
+      dlg->logbook->clearAllGrids();
+      dlg->logbook->loadData();
+    }
+  }
+
   if (NULL != dlg && modified) {
     dlg->logbook->update();
     dlg->maintenance->update();
@@ -2471,7 +2516,7 @@ void LogbookOptions::OnButtonOKClick(wxCommandEvent& ev) {
     LogbookDialog::datePattern = newPattern;
 
     if (dlg->crewList->getDayOne(1) != -1)
-      dlg->crewList->dayNow(false);
+      dlg->crewList->dayNow();
     else {
       bool dummy = false;
 
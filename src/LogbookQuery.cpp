@@ -0,0 +1,226 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef WX_PRECOMP
+#include <wx/wx.h>
+#endif
+
+#include <wx/jsonwriter.h>
+
+#include <memory>
+
+#include "Logbook.h"
+#include "LogbookArchive.h"
+#include "LogbookDialog.h"
+#include "LogbookFile.h"
+#include "LogbookQuery.h"
+
+using namespace std;
+
+void LogbookQuery::range(RequestRunner* runner, LogbookDialog* d,
+                         wxJSONValue& request) {
+  launch(runner, d, request, false);
+}
+
+void LogbookQuery::query(RequestRunner* runner, LogbookDialog* d,
+                         wxJSONValue& request) {
+  launch(runner, d, request, true);
+}
+
+void LogbookQuery::launch(RequestRunner* runner, LogbookDialog* d,
+                          wxJSONValue& request, bool filters) {
+  shared_ptr<LogbookQuery> q(new LogbookQuery);
+  q->responseId = filters ? "LOGBOOK_LOG_QUERY_RESPONSE"
+                          : "LOGBOOK_LOG_RANGE_RESPONSE";
+  q->setup(request, filters);
+  q->prepare(d);
+  runner->run([q](RequestRunner::Send send, RequestRunner::Stopping stopping) {
+    q->scan(send, stopping);
+  });
+}
+
+void LogbookQuery::setup(wxJSONValue& request, bool filters) {
+  // the worker keeps the id after the request is gone
+  id = request.HasMember("Id") ? RequestRunner::unshared(request["Id"])
+                               : wxJSONValue();
+  from = request.HasMember("From") ? request["From"].AsLong() : 0;
+  to = request.HasMember("To") ? request["To"].AsLong() : -1;
+  offset = request.HasMember("Offset") ? request["Offset"].AsLong() : 0;
+  limit = request.HasMember("Limit") ? request["Limit"].AsLong() : 0;
+  chunkSize =
+      request.HasMember("ChunkSize") ? request["ChunkSize"].AsInt() : 250;
+  if (chunkSize <= 0) chunkSize = 250;
+  archives = request.HasMember("Archives") && request["Archives"].AsBool();
+  count = request.HasMember("Count") && request["Count"].AsBool();
+
+  start = end = wxEmptyString;
+  if (request.HasMember("Start"))
+    start = LogbookFile::isoTimestamp(request["Start"].AsString());
+  if (request.HasMember("End"))
+    end = LogbookFile::isoTimestamp(request["End"].AsString());
+
+  columns.clear();
+  if (request.HasMember("Columns")) {
+    wxJSONValue& c = request["Columns"];
+    for (int i = 0; i < c.Size(); i++) {
+      int col = LogbookFile::column(c[i].IsString()
+                                        ? c[i].AsString()
+                                        : wxString::Format("%i", c[i].AsInt()));
+      if (col >= 0) columns.push_back(col);
+    }
+  }
+  if (columns.empty())
+    for (int i = 0; i < LogbookFile::COLUMNS; i++) columns.push_back(i);
+
+  where.clear();
+  contains.clear();
+  if (filters) {
+    wxArrayString keys;
+    if (request.HasMember("Where")) {
+      keys = request["Where"].GetMemberNames();
+      for (unsigned int i = 0; i < keys.Count(); i++) {
+        int col = LogbookFile::column(keys[i]);
+        if (col >= 0)
+          where.push_back(make_pair(col, request["Where"][keys[i]].AsString()));
+      }
+    }
+    if (request.HasMember("Contains")) {
+      keys = request["Contains"].GetMemberNames();
+      for (unsigned int i = 0; i < keys.Count(); i++) {
+        int col = LogbookFile::column(keys[i]);
+        if (col >= 0)
+          contains.push_back(make_pair(
+              col, request["Contains"][keys[i]].AsString().Lower()));
+      }
+    }
+  }
+}
+
+// UI thread: the active logbook is written here, so it is mapped here;
+// archives do not change and are opened by the worker
+void LogbookQuery::prepare(LogbookDialog* d) {
+  // a query only reads, the file is written just for unsaved edits
+  Logbook* logbook = d->logbook;
+  if (logbook->modified) logbook->update();
+
+  if (archives) candidates = LogbookFile::archives(d->data);
+  active.add(logbook->logbookData_actual);
+}
+
+void LogbookQuery::scan(RequestRunner::Send send,
+                        RequestRunner::Stopping stopping) {
+  reply = send;
+  matched = returned = 0;
+  more = false;
+  chunk = 0;
+  rows = wxJSONValue(wxJSONTYPE_ARRAY);
+
+  // without a row range the summaries tell which archives can match,
+  // by time, route and words
+  VoyageView view;
+  bool rowRange = from > 0 || to >= 0;
+  for (unsigned int i = 0; i < candidates.Count(); i++)
+    if (rowRange || (LogbookArchive::mayContain(candidates[i], start, end) &&
+                     LogbookArchive::mayMatch(candidates[i], where, contains)))
+      view.add(candidates[i]);
+
+  // the archives, then the active logbook; rows outside From/To are never
+  // read, and with Limit reached only Count reads on
+  VoyageView* views[] = {&view, &active};
+  long first = 0;
+  bool going = true;
+  wxArrayString record;
+  for (int v = 0; v < 2 && going; v++) {
+    long last = first + views[v]->rows() - 1;
+    if (to >= 0 && to < last) last = to;
+    index = wxMax(from, first);
+    for (; index <= last && going; index++) {
+      if ((index & 0xff) == 0 && stopping()) return;
+      long row;
+      int segment = views[v]->locate(index - first, &row);
+      if (!views[v]->record(index - first, record)) continue;
+      going = add(views[v]->segmentName(segment), row, record);
+    }
+    first += views[v]->rows();
+  }
+  send(true);
+}
+
+bool LogbookQuery::matches(const wxArrayString& record) {
+  if (!start.IsEmpty() || !end.IsEmpty()) {
+    wxString ts = LogbookFile::timestamp(record);
+    if (ts.IsEmpty()) return false;
+    if (!start.IsEmpty() && ts < start) return false;
+    if (!end.IsEmpty() && ts > end) return false;
+  }
+  for (unsigned int i = 0; i < where.size(); i++)
+    if (record[where[i].first] != where[i].second) return false;
+  for (unsigned int i = 0; i < contains.size(); i++)
+    if (record[contains[i].first].Lower().Find(contains[i].second) ==
+        wxNOT_FOUND)
+      return false;
+  return true;
+}
+
+// false once the page is full and no one asked for the count
+bool LogbookQuery::add(const wxString& logbook, int row,
+                       const wxArrayString& record) {
+  if (!matches(record)) return true;
+  if (matched++ < offset) return true;
+  if (limit > 0 && returned >= limit) {
+    more = true;
+    return count;
+  }
+
+  wxJSONValue r;
+  r["Logbook"] = logbook;
+  r["Row"] = row;
+  wxJSONValue& values = r["Values"];
+  for (unsigned int i = 0; i < columns.size(); i++)
+    values.Append(record[columns[i]]);
+  rows.Append(r);
+  returned++;
+
+  if (rows.Size() >= chunkSize) send(false);
+  return true;
+}
+
+void LogbookQuery::send(bool last) {
+  wxJSONValue out;
+  if (id.IsValid()) out["Id"] = id;
+  out["Chunk"] = chunk++;
+  if (chunk == 1) {
+    wxJSONValue& names = out["Columns"];
+    for (unsigned int i = 0; i < columns.size(); i++)
+      names.Append(LogbookFile::columnName(columns[i]));
+  }
+  out["Rows"] = rows;
+  out["Last"] = last;
+  if (last) {
+    if (!more || count) out["Matched"] = (int)matched;
+    out["More"] = more;
+  }
+
+  wxJSONWriter w(wxJSONWRITER_NONE);
+  wxString body;
+  w.Write(out, body);
+  reply(responseId, body);
+
+  rows = wxJSONValue(wxJSONTYPE_ARRAY);
+}
@@ -0,0 +1,106 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#ifndef _LOGBOOKQUERY_H_
+#define _LOGBOOKQUERY_H_
+
+#ifndef  WX_PRECOMP
+#include "wx/wx.h"
+#endif //precompiled headers
+
+#include <wx/jsonval.h>
+
+#include <utility>
+#include <vector>
+
+#include "RequestRunner.h"
+#include "VoyageView.h"
+
+class LogbookDialog;
+
+/**
+ * Answers LOGBOOK_LOG_RANGE_REQUEST and LOGBOOK_LOG_QUERY_REQUEST.
+ *
+ * Request members (all optional):
+ *   "Id"        echoed in every response chunk
+ *   "From","To" row numbers, counted over all selected logbooks
+ *   "Start","End" ISO date/time range
+ *   "Columns"   names or numbers of the columns to return
+ *   "Where"     { column : value }, exact match       (query only)
+ *   "Contains"  { column : text }, case-insensitive  (query only)
+ *   "Offset","Limit" paging over the matching rows
+ *   "ChunkSize" rows per response message, default 250
+ *   "Archives"  include the until_*_logbook.txt files, oldest first
+ *   "Count"     go on past Limit to count every match
+ *
+ * The logbooks are read through a VoyageView, so "Row" is the row within
+ * the logbook named in "Logbook" and From/To cost nothing for the rows
+ * they skip.
+ *
+ * The request is taken apart and the active logbook mapped on the UI
+ * thread, the rows are read and matched on a RequestRunner thread. Rows
+ * are sent as a sequence of <request>_RESPONSE messages; the last one
+ * carries "Last":true and "More". The scan stops once Limit rows are
+ * sent, "Matched" (all matching rows, whatever the page) is only given
+ * when all rows were looked at: without Limit, or with "Count":true.
+ */
+class LogbookQuery
+{
+public:
+    static void range( RequestRunner* runner, LogbookDialog* d,
+                       wxJSONValue& request );
+    static void query( RequestRunner* runner, LogbookDialog* d,
+                       wxJSONValue& request );
+
+private:
+    static void launch( RequestRunner* runner, LogbookDialog* d,
+                        wxJSONValue& request, bool filters );
+
+    void setup( wxJSONValue& request, bool filters );
+    void prepare( LogbookDialog* d );
+    void scan( RequestRunner::Send send, RequestRunner::Stopping stopping );
+    bool add( const wxString& logbook, int row, const wxArrayString& record );
+    bool matches( const wxArrayString& record );
+    void send( bool last );
+
+    VoyageView   active;
+    wxArrayString candidates;
+    RequestRunner::Send reply;
+
+    wxString     responseId;
+    wxJSONValue  id;
+    std::vector<int> columns;
+    std::vector<std::pair<int, wxString> > where;
+    std::vector<std::pair<int, wxString> > contains;
+    long         from, to;
+    wxString     start, end;
+    long         offset, limit;
+    int          chunkSize;
+    bool         archives;
+    bool         count;
+
+    long         index;
+    long         matched;
+    long         returned;
+    bool         more;
+    int          chunk;
+    wxJSONValue  rows;
+};
+#endif
@@ -0,0 +1,254 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef WX_PRECOMP
+#include <wx/wx.h>
+#endif
+
+#include <algorithm>
+
+#include "CrewList.h"
+#include "Logbook.h"
+#include "LogbookDialog.h"
+#include "LogbookScheduler.h"
+#include "Options.h"
+#include "logbook_pi.h"
+
+using namespace std;
+
+LogbookScheduler::LogbookScheduler(LogbookDialog* d) : wxTimer() {
+  dialog = d;
+  interval = 0;
+  hoursPlus = 1;
+  saves = 0;
+}
+
+// Full hour, individual, watch and course deadlines are wall clock times on
+// the logbook clock; the others are plain durations and must keep running
+// when the GPS time stops.
+static bool onLogbookClock(int event) {
+  return event == LogbookScheduler::FULLHOUR ||
+         event == LogbookScheduler::INDIVIDUAL ||
+         event == LogbookScheduler::WATCH || event == LogbookScheduler::COURSE;
+}
+
+wxDateTime LogbookScheduler::now() {
+  Logbook* logbook = dialog->logbook;
+  if (logbook && logbook->sDate != wxEmptyString)
+    return logbook->mCorrectedDateTime;
+  return wxDateTime::Now();
+}
+
+void LogbookScheduler::start() {
+  wxDateTime n = wxDateTime::UNow();
+  due[GPS] = n + wxTimeSpan::Milliseconds(GPSTIMEOUT);
+  due[SAVE] = n + wxTimeSpan::Milliseconds(LOGSAVETIME);
+  restartFullHour();
+}
+
+void LogbookScheduler::setFullHour(int plus, const vector<int>& minutes) {
+  hoursPlus = plus;
+  fullMinutes = minutes;
+  sort(fullMinutes.begin(), fullMinutes.end());
+  restartFullHour();
+}
+
+void LogbookScheduler::setIndividual(const vector<int>& minutesOfDay) {
+  individual = minutesOfDay;
+  sort(individual.begin(), individual.end());
+  reschedule();
+}
+
+void LogbookScheduler::restartFullHour() {
+  fullHour = now();
+  fullHour.SetMinute(0).SetSecond(0).SetMillisecond(0);
+  fired[FULLHOUR] = wxInvalidDateTime;
+  reschedule();
+}
+
+void LogbookScheduler::startInterval(long ms) {
+  interval = ms;
+  due[INTERVAL] = wxDateTime::UNow() + wxTimeSpan::Milliseconds(ms);
+  reschedule();
+}
+
+void LogbookScheduler::stopInterval() {
+  interval = 0;
+  due[INTERVAL] = wxInvalidDateTime;
+  reschedule();
+}
+
+void LogbookScheduler::at(int event, wxDateTime when) {
+  due[event] = when;
+  reschedule();
+}
+
+void LogbookScheduler::cancel(int event) { due[event] = wxInvalidDateTime; }
+
+wxDateTime LogbookScheduler::nextFullHour(const wxDateTime& from) {
+  if (fullMinutes.empty()) return wxInvalidDateTime;
+
+  // an entry of the hour after the last minute moves on by hoursPlus, a plus
+  // of 0 repeats the same hour every day
+  int plus = (hoursPlus > 0) ? hoursPlus : 24;
+  if (from > fullHour) {
+    long steps = (from - fullHour).GetHours() / plus;
+    if (steps > 0) fullHour += wxTimeSpan::Hours(steps * plus);
+  }
+  while (true) {
+    for (unsigned int i = 0; i < fullMinutes.size(); i++) {
+      wxDateTime t = fullHour + wxTimeSpan::Minutes(fullMinutes[i]);
+      if (t > from) return t;
+    }
+    fullHour += wxTimeSpan::Hours(plus);
+  }
+}
+
+wxDateTime LogbookScheduler::nextIndividual(const wxDateTime& from) {
+  if (individual.empty()) return wxInvalidDateTime;
+
+  wxDateTime day = from;
+  day.ResetTime();
+  vector<int>::iterator it =
+      upper_bound(individual.begin(), individual.end(),
+                  from.GetHour() * 60 + from.GetMinute());
+  if (it == individual.end()) {
+    day += wxDateSpan::Day();
+    it = individual.begin();
+  }
+  return day + wxTimeSpan::Minutes(*it);
+}
+
+wxDateTime LogbookScheduler::next(int event, const wxDateTime& from) {
+  Options* opt = dialog->logbookPlugIn->opt;
+  bool timer = opt->timer && !dialog->logbookPlugIn->eventsEnabled;
+
+  // a deadline is never hit twice
+  wxDateTime after = from;
+  if (fired[event].IsValid() && fired[event] > after) after = fired[event];
+
+  switch (event) {
+    case FULLHOUR:
+      return (timer && opt->timerType == 1) ? nextFullHour(after)
+                                            : wxInvalidDateTime;
+    case INDIVIDUAL:
+      return (timer && opt->timerType == 2) ? nextIndividual(after)
+                                            : wxInvalidDateTime;
+    case WATCH:
+      return dialog->crewList->nextWatchChange(after);
+    default:
+      return due[event];
+  }
+}
+
+void LogbookScheduler::reschedule() {
+  wxDateTime clock[2] = {wxDateTime::UNow(), now()};
+  long sleep = -1;
+
+  for (int e = 0; e < EVENTS; e++) {
+    wxDateTime n = clock[onLogbookClock(e)];
+    due[e] = next(e, n);
+    if (!due[e].IsValid()) continue;
+
+    // the system clock was set back, do not sleep longer than one period
+    if (e == GPS && due[e] > n + wxTimeSpan::Milliseconds(GPSTIMEOUT))
+      due[e] = n + wxTimeSpan::Milliseconds(GPSTIMEOUT);
+    if (e == SAVE && due[e] > n + wxTimeSpan::Milliseconds(LOGSAVETIME))
+      due[e] = n + wxTimeSpan::Milliseconds(LOGSAVETIME);
+    if (e == INTERVAL && due[e] > n + wxTimeSpan::Milliseconds(interval))
+      due[e] = n + wxTimeSpan::Milliseconds(interval);
+
+    long ms = (due[e] > n) ? (due[e] - n).GetMilliseconds().ToLong() : 0;
+    if (sleep < 0 || ms < sleep) sleep = ms;
+  }
+
+  if (sleep < 0) {
+    Stop();
+    return;
+  }
+  StartOnce(wxMax(sleep, 1L));
+}
+
+void LogbookScheduler::Notify() {
+  wxDateTime clock[2] = {wxDateTime::UNow(), now()};
+
+  for (int e = 0; e < EVENTS; e++) {
+    if (!due[e].IsValid() || due[e] > clock[onLogbookClock(e)]) continue;
+    fired[e] = due[e];
+    fire(e);
+  }
+  reschedule();
+}
+
+void LogbookScheduler::fire(int event) {
+  logbookkonni_pi* plugin = dialog->logbookPlugIn;
+  Logbook* logbook = dialog->logbook;
+  wxDateTime n = wxDateTime::UNow();
+
+  switch (event) {
+    case INTERVAL:
+      due[INTERVAL] += wxTimeSpan::Milliseconds(interval);
+      if (due[INTERVAL] <= n)
+        due[INTERVAL] = n + wxTimeSpan::Milliseconds(interval);
+      dialog->logbookTimerWindow->timerEvent();
+      break;
+
+    case FULLHOUR:
+    case INDIVIDUAL:
+      dialog->logbookTimerWindow->timerEvent();
+      break;
+
+    case WATCH: {
+      bool active = ActualWatch::active;
+      dialog->crewList->dayNow();
+      if (active && plugin->opt->guardChange && !plugin->eventsEnabled) {
+        dialog->logbookTimerWindow->popUp();
+        logbook->guardChange = true;
+        logbook->appendRow(true, true);
+        logbook->guardChange = false;
+      }
+      break;
+    }
+
+    case COURSE:
+      due[COURSE] = wxInvalidDateTime;
+      logbook->courseChangeDue();
+      break;
+
+    case GPS:
+      due[GPS] = n + wxTimeSpan::Milliseconds(GPSTIMEOUT);
+      logbook->checkNMEADeviceIsOn();
+      logbook->checkGPS(true);
+      if (dialog->statusGPS != logbook->gpsStatus) {
+        dialog->statusGPS = logbook->gpsStatus;
+        dialog->crewList->dayNow();
+      }
+      break;
+
+    case SAVE:
+      due[SAVE] = n + wxTimeSpan::Milliseconds(LOGSAVETIME);
+      logbook->update();  // save Data every 15 Minutes, if modified
+      if (++saves == 6) {
+        dialog->maintenance->checkService(
+            dialog->m_gridGlobal->GetNumberRows() - 1);
+        saves = 0;
+      }
+      break;
+  }
+}
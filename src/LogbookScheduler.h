@@ -0,0 +1,79 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#ifndef _LOGBOOKSCHEDULER_H_
+#define _LOGBOOKSCHEDULER_H_
+
+#ifndef  WX_PRECOMP
+#include "wx/wx.h"
+#endif //precompiled headers
+
+#include <wx/datetime.h>
+#include <wx/timer.h>
+
+#include <vector>
+
+class LogbookDialog;
+
+/**
+ * One-shot timer that sleeps until the earliest of all timed triggers:
+ * the normal timer interval, the full hour and individual timer lists,
+ * the next watch change, a pending course change, the GPS check and
+ * saving the logbook. Deadlines are kept on the logbook clock (GPS time
+ * when available), so entries get the exact minute they were set for.
+ */
+class LogbookScheduler : public wxTimer
+{
+public:
+    enum events {INTERVAL,FULLHOUR,INDIVIDUAL,WATCH,COURSE,GPS,SAVE,EVENTS};
+
+    LogbookScheduler( LogbookDialog* d );
+
+    void        start();
+    void        setFullHour( int hoursPlus, const std::vector<int>& minutes );
+    void        setIndividual( const std::vector<int>& minutesOfDay );
+    void        restartFullHour();
+    void        startInterval( long ms );
+    void        stopInterval();
+    bool        intervalRunning() { return interval > 0; }
+    void        at( int event, wxDateTime due );
+    void        cancel( int event );
+    void        reschedule();
+    wxDateTime  now();
+
+    virtual void Notify();
+
+private:
+    wxDateTime  next( int event, const wxDateTime& from );
+    wxDateTime  nextFullHour( const wxDateTime& from );
+    wxDateTime  nextIndividual( const wxDateTime& from );
+    void        fire( int event );
+
+    LogbookDialog* dialog;
+    wxDateTime  due[EVENTS];
+    wxDateTime  fired[EVENTS];
+    long        interval;
+    int         hoursPlus;
+    std::vector<int> fullMinutes;
+    wxDateTime  fullHour;
+    std::vector<int> individual;
+    int         saves;
+};
+#endif
@@ -0,0 +1,145 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef WX_PRECOMP
+#include <wx/wx.h>
+#endif
+
+#include <wx/jsonsax.h>
+
+#include "MessageRouter.h"
+
+using namespace std;
+
+MessageRouter::MessageRouter(void) : done(mutex) {
+  worker = NULL;
+  queued = finished = 0;
+  stopped = false;
+}
+
+MessageRouter::~MessageRouter(void) { stop(); }
+
+void MessageRouter::add(const wxString& id, int flags, Handler handler,
+                        Filter filter, Validator validator) {
+  route r;
+  r.flags = flags;
+  r.handler = handler;
+  r.filter = filter;
+  r.validator = validator;
+  routes[id] = r;
+}
+
+void MessageRouter::start() {
+  if (worker) return;
+  stopped = false;
+  worker = new Worker(this);
+  if (worker->Run() != wxTHREAD_NO_ERROR) {
+    delete worker;
+    worker = NULL;
+  }
+}
+
+void MessageRouter::stop() {
+  if (!worker) return;
+  job quit;
+  quit.r = NULL;
+  queue.Post(quit);
+  worker->Wait();
+  delete worker;
+  worker = NULL;
+
+  // what the worker already decoded is dropped, the handlers must not
+  // run while the plugin is going away
+  stopped = true;
+  ProcessPendingEvents();
+  queued = finished = 0;
+}
+
+bool MessageRouter::dispatch(wxString& id, wxString& body) {
+  unordered_map<wxString, route, wxStringHash, wxStringEqual>::const_iterator
+      it = routes.find(id);
+  if (it == routes.end()) return false;
+
+  const route& r = it->second;
+  if (r.filter && !r.filter()) return true;
+
+  if ((r.flags & ASYNC) == ASYNC && worker) {
+    job j;
+    j.r = &r;
+    j.body = body.Clone();  // the worker must own an unshared copy
+    queued++;
+    queue.Post(j);
+    return true;
+  }
+
+  // synchronous handlers must see every async message received before them
+  flush();
+
+  wxJSONValue data;
+  if (r.flags & JSON) {
+    wxJSONSaxReader reader;
+    if (reader.Parse(body, &data) != 0) return true;
+    if (r.validator && !r.validator(data)) return true;
+  }
+  r.handler(data, body);
+  return true;
+}
+
+void MessageRouter::flush() {
+  {
+    wxMutexLocker lock(mutex);
+    while (finished < queued) done.Wait();
+  }
+  ProcessPendingEvents();
+}
+
+void MessageRouter::parsed() {
+  wxMutexLocker lock(mutex);
+  finished++;
+  done.Broadcast();
+}
+
+void MessageRouter::apply(const route* r, wxJSONValue* data) {
+  wxString body;
+  if (!stopped) r->handler(*data, body);
+  delete data;
+}
+
+wxThread::ExitCode MessageRouter::Worker::Entry() {
+  job j;
+  while (router->queue.Receive(j) == wxMSGQUEUE_NO_ERROR) {
+    if (!j.r) break;
+
+    wxJSONValue* data = new wxJSONValue();
+    wxJSONSaxReader reader;
+    if (reader.Parse(j.body, data) != 0 ||
+        (j.r->validator && !j.r->validator(*data))) {
+      delete data;
+      router->parsed();
+      continue;
+    }
+
+    // the value is handed over, the worker keeps no reference to it
+    MessageRouter* mr = router;
+    const route* r = j.r;
+    mr->CallAfter([mr, r, data]() { mr->apply(r, data); });
+    router->parsed();
+  }
+  return (ExitCode)0;
+}
@@ -0,0 +1,101 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#ifndef _MESSAGEROUTER_H_
+#define _MESSAGEROUTER_H_
+
+#ifndef  WX_PRECOMP
+#include "wx/wx.h"
+#endif //precompiled headers
+
+#include <wx/hashmap.h>
+#include <wx/msgqueue.h>
+#include <wx/thread.h>
+#include <wx/jsonval.h>
+
+#include <functional>
+#include <unordered_map>
+
+/**
+ * Table driven dispatcher for OpenCPN plugin messages.
+ *
+ * OpenCPN hands every plugin message of every plugin to SetPluginMessage,
+ * so unknown ids are rejected with a single hash lookup. Routes flagged
+ * ASYNC have their JSON body decoded and validated on a worker thread; only
+ * the handler itself, which touches the grids, runs on the UI thread.
+ */
+class MessageRouter : public wxEvtHandler
+{
+public:
+    enum flags { SYNC = 0, JSON = 1, ASYNC = 3 };	// ASYNC implies JSON
+
+    typedef std::function<void( wxJSONValue& data, wxString& body )> Handler;
+    typedef std::function<bool()> Filter;
+    typedef std::function<bool( wxJSONValue& data )> Validator;
+
+    MessageRouter( void );
+    ~MessageRouter( void );
+
+    void add( const wxString& id, int flags, Handler handler,
+              Filter filter = Filter(), Validator validator = Validator() );
+    bool dispatch( wxString& id, wxString& body );
+    void flush();
+
+    void start();
+    void stop();
+
+private:
+    struct route
+    {
+        int       flags;
+        Handler   handler;
+        Filter    filter;
+        Validator validator;
+    };
+
+    struct job
+    {
+        const route* r;
+        wxString     body;
+    };
+
+    class Worker : public wxThread
+    {
+    public:
+        Worker( MessageRouter* r ) : wxThread( wxTHREAD_JOINABLE ), router( r ) {}
+        virtual ExitCode Entry();
+    private:
+        MessageRouter* router;
+    };
+
+    void parsed();
+    void apply( const route* r, wxJSONValue* data );
+
+    std::unordered_map<wxString, route, wxStringHash, wxStringEqual> routes;
+    wxMessageQueue<job> queue;
+    Worker*     worker;
+
+    wxMutex     mutex;
+    wxCondition done;
+    unsigned long queued;
+    unsigned long finished;
+    bool        stopped;
+};
+#endif
@@ -0,0 +1,185 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef WX_PRECOMP
+#include <wx/wx.h>
+#endif
+
+#include <wx/tokenzr.h>
+
+#include "NMEAArbiter.h"
+
+using namespace std;
+
+// names used in the priority option, in the order of NMEAArbiter::data
+static const char* kindNames[NMEAArbiter::DATAKINDS] = {
+    "POSITION", "COURSE",  "TIME",  "HEADING",   "SPEED",
+    "WINDTRUE", "WINDREL", "DEPTH", "WATERTEMP", "ROUTE"};
+
+const wxString NMEAArbiter::FIXTALKER = "OC";
+
+NMEAArbiter::NMEAArbiter() : failover(5), next(0) {
+  for (int i = 0; i < RECENT; i++) {
+    recent[i] = 0;
+    recentTime[i] = -1;
+  }
+  for (int i = 0; i < DATAKINDS; i++) {
+    owners[i].rank = 0;
+    owners[i].heard = 0;
+  }
+}
+
+void NMEAArbiter::setPriority(const wxString& list, int seconds) {
+  for (int i = 0; i <= DATAKINDS; i++) priority[i].Clear();
+  failover = seconds > 0 ? seconds : 5;
+
+  wxStringTokenizer groups(list, ";");
+  while (groups.HasMoreTokens()) {
+    wxString group = groups.GetNextToken().Trim().Trim(false).Upper();
+    int k = DATAKINDS;
+    bool wind = false;
+    if (group.Contains("=")) {
+      wxString name = group.BeforeFirst('=').Trim();
+      group = group.AfterFirst('=');
+      // WIND is the list of both wind kinds
+      wind = name == "WIND";
+      for (k = 0; k < DATAKINDS; k++)
+        if (name == kindNames[k] || (wind && k == WINDTRUE)) break;
+      if (k == DATAKINDS) continue;  // unknown kind, ignore the list
+    }
+    wxStringTokenizer talkers(group, ",");
+    while (talkers.HasMoreTokens()) {
+      wxString t = talkers.GetNextToken().Trim().Trim(false);
+      if (t.IsEmpty()) continue;
+      priority[k].Add(t);
+      if (wind) priority[WINDREL].Add(t);
+    }
+  }
+
+  // owners keep their data, but are ranked by the new lists
+  for (int i = 0; i < DATAKINDS; i++)
+    if (!owners[i].talker.IsEmpty())
+      owners[i].rank = rank(i, owners[i].talker);
+}
+
+int NMEAArbiter::kinds(const wxString& m) {
+  if (m == "RMC") return bit(POSITION) | bit(COURSE) | bit(TIME);
+  if (m == "GGA" || m == "GLL") return bit(POSITION);
+  if (m == "ZDA") return bit(TIME);
+  if (m == "HDT" || m == "HDM" || m == "HDG") return bit(HEADING);
+  if (m == "VHW") return bit(SPEED);
+  if (m == "MWV") return bit(WINDTRUE) | bit(WINDREL);
+  if (m == "VWT") return bit(WINDTRUE);
+  if (m == "VWR") return bit(WINDREL);
+  if (m == "DBT" || m == "DPT") return bit(DEPTH);
+  if (m == "MTW") return bit(WATERTEMP);
+  if (m == "RMB") return bit(ROUTE);
+  return 0;
+}
+
+// FNV-1a over the sentence without its line end
+wxUint32 NMEAArbiter::hash(const wxString& s) {
+  wxUint32 h = 2166136261u;
+  for (wxString::const_iterator it = s.begin(); it != s.end(); ++it) {
+    wxUniChar c = *it;
+    if (c == '\r' || c == '\n') break;
+    h = (h ^ (wxUint32)c.GetValue()) * 16777619u;
+  }
+  return h;
+}
+
+// the n-th comma separated field, the address being field 0
+wxString NMEAArbiter::field(const wxString& s, int n) {
+  wxString rest = s.BeforeFirst('*');
+  for (int i = 0; i < n; i++) rest = rest.AfterFirst(',');
+  return rest.BeforeFirst(',').Trim();
+}
+
+// a sentence without a fix or flagged void carries no data
+bool NMEAArbiter::valid(const wxString& m, const wxString& s) {
+  if (m == "RMC") return field(s, 2) == "A";
+  if (m == "GLL") return field(s, 6) != "V";
+  if (m == "GGA") {
+    wxString quality = field(s, 6);
+    return !quality.IsEmpty() && quality != "0";
+  }
+  if (m == "MWV") return field(s, 5) != "V";
+  return true;
+}
+
+int NMEAArbiter::rank(int k, const wxString& talker) const {
+  int i = priority[k].Index(talker);
+  if (i != wxNOT_FOUND) return i;
+  // the default list ranks below a list for the kind
+  i = priority[DATAKINDS].Index(talker);
+  if (i != wxNOT_FOUND) return (int)priority[k].Count() + i;
+  return (int)(priority[k].Count() + priority[DATAKINDS].Count());
+}
+
+int NMEAArbiter::accept(const wxString& sentence, double now) {
+  wxUint32 h = hash(sentence);
+  for (int i = 0; i < RECENT; i++)
+    if (recent[i] == h && recentTime[i] >= 0 &&
+        now - recentTime[i] < DUPLICATEMS / 1000.0)
+      return 0;
+  recent[next] = h;
+  recentTime[next] = now;
+  next = (next + 1) % RECENT;
+
+  // $ttsss, anything shorter or proprietary is left to the parser
+  if (sentence.Length() < 6 || sentence[0] != '$' || sentence[1] == 'P')
+    return ALL;
+  wxString mnemonic = sentence.Mid(3, 3);
+  int carried = kinds(mnemonic);
+  if (!carried) return ALL;
+  if (mnemonic == "MWV")
+    carried = field(sentence, 2) == "T" ? bit(WINDTRUE) : bit(WINDREL);
+
+  return own(carried, sentence.Mid(1, 2), valid(mnemonic, sentence), now);
+}
+
+int NMEAArbiter::acceptFix(bool valid, double now) {
+  return own(bit(POSITION) | bit(COURSE), FIXTALKER, valid, now);
+}
+
+// every kind has its own owner, the talker keeps the ones it wins
+int NMEAArbiter::own(int carried, const wxString& talker, bool valid,
+                     double now) {
+  int owned = 0;
+  for (int k = 0; k < DATAKINDS; k++) {
+    if (!(carried & bit(k))) continue;
+    owner& o = owners[k];
+    if (!valid) {
+      // an owner without data makes way for the next talker at once
+      if (o.talker == talker) o.talker.Clear();
+      continue;
+    }
+    if (o.talker != talker) {
+      int r = rank(k, talker);
+      if (!o.talker.IsEmpty() && r >= o.rank && now - o.heard <= failover)
+        continue;
+      o.talker = talker;
+      o.rank = r;
+    }
+    o.heard = now;
+    owned |= bit(k);
+  }
+  return owned;
+}
@@ -0,0 +1,95 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#ifndef _NMEAARBITER_H_
+#define _NMEAARBITER_H_
+
+#ifndef  WX_PRECOMP
+#include "wx/wx.h"
+#endif //precompiled headers
+
+#include <wx/arrstr.h>
+
+/**
+ * Picks one talker per kind of data before a sentence is parsed.
+ *
+ * A sentence that is an exact copy of one seen within DUPLICATEMS, as a
+ * multiplexer echoing its inputs sends them, is dropped on a hash of its
+ * text. Of the rest, every kind of data (position, heading, wind ...) is
+ * owned by one talker: the first one heard, until a talker with a higher
+ * priority shows up or the owner has been silent for failover seconds.
+ * A sentence carrying several kinds, as RMC with position, course over
+ * ground and date, is arbitrated per kind. accept() returns the mask of
+ * the kinds the talker owns, the parser only takes those fields. A
+ * sentence that owns none is dropped, so the logged values do not flap
+ * between sources and the losers are never parsed. True and relative
+ * wind are separate kinds, MWV is sorted by its reference field.
+ *
+ * Only valid data counts as heard: RMC or GLL with status V and GGA
+ * without a fix neither take a kind nor keep it, the owner gives it up at
+ * once. OpenCPN's own position fix competes for position and course as
+ * talker FIXTALKER through acceptFix().
+ *
+ * The priority is a list of talker IDs, best first, with optional lists
+ * per kind of data: "GP,GN;HEADING=HC,II;WINDTRUE=WI,II". WIND sets the
+ * list of both wind kinds. Talkers not listed rank below the listed ones. Sentences that belong to no kind (XDR, MDA,
+ * RPM, proprietary) always pass, they carry several sensors.
+ */
+class NMEAArbiter
+{
+public:
+    enum data {POSITION,COURSE,TIME,HEADING,SPEED,WINDTRUE,WINDREL,DEPTH,
+               WATERTEMP,ROUTE,DATAKINDS};
+    enum { DUPLICATEMS = 250, RECENT = 32, ALL = ~0 };
+
+    NMEAArbiter();
+
+    void      setPriority( const wxString& priority, int failover );
+    int       accept( const wxString& sentence, double now );
+    int       acceptFix( bool valid, double now );
+
+    static int      kinds( const wxString& mnemonic );
+    static int      bit( int kind ) { return 1 << kind; }
+    static wxUint32 hash( const wxString& sentence );
+    static wxString field( const wxString& sentence, int n );
+    static bool     valid( const wxString& mnemonic, const wxString& sentence );
+
+    static const wxString FIXTALKER;
+
+private:
+    int       rank( int kind, const wxString& talker ) const;
+    int       own( int carried, const wxString& talker, bool valid, double now );
+
+    struct owner
+    {
+        wxString       talker;
+        int            rank;
+        double         heard;
+    };
+
+    wxArrayString priority[DATAKINDS + 1];   // last is the default list
+    double    failover;
+    owner     owners[DATAKINDS];
+
+    wxUint32  recent[RECENT];
+    double    recentTime[RECENT];
+    int       next;
+};
+#endif
@@ -0,0 +1,330 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef WX_PRECOMP
+#include <wx/wx.h>
+#endif
+
+#include <wx/datetime.h>
+#include <wx/filename.h>
+
+#include "ExportTemplates.h"
+#include "ODSWriter.h"
+#include "Units.h"
+
+using namespace std;
+
+// decimals a unit number style is made for, more are rounded to this
+#define MAXDECIMALS 3
+
+static wxString escapeXML(wxString s) {
+  s.Replace("&", "&amp;");
+  s.Replace("\"", "&quot;");
+  s.Replace("<", "&lt;");
+  s.Replace(">", "&gt;");
+  s.Replace("'", "&apos;");
+  return s;
+}
+
+// one paragraph per line of the cell
+static wxString paragraphs(const wxString& s) {
+  wxString p;
+  wxArrayString lines = wxSplit(s, '\n', '\0');
+  for (unsigned int i = 0; i < lines.Count(); i++)
+    p += "<text:p>" + escapeXML(lines[i]) + "</text:p>";
+  return p;
+}
+
+static bool blank(const wxString& s) {
+  return s.find_first_not_of(" \t\r\n") == wxString::npos;
+}
+
+static wxString emptyCells(long n) {
+  if (n == 1) return "<table:table-cell />";
+  return wxString::Format(
+      "<table:table-cell table:number-columns-repeated=\"%ld\" />", n);
+}
+
+// the numbers in s, "30.06.21 14:05" gives 30 6 21 14 5
+static int numbers(const wxString& s, long* n, int max) {
+  int count = 0;
+  bool in = false;
+  for (size_t i = 0; i < s.Length() && count <= max; i++)
+    if (s[i] >= '0' && s[i] <= '9') {
+      if (!in && count == max) return max + 1;
+      if (!in) n[count++] = 0;
+      n[count - 1] = n[count - 1] * 10 + (s[i] - '0');
+      in = true;
+    } else
+      in = false;
+  return count;
+}
+
+ODSWriter::ODSWriter(const wxString& pattern)
+    : content(ExportTemplates::content),
+      contentEnd(ExportTemplates::contentEnd),
+      styles(ExportTemplates::styles),
+      meta(ExportTemplates::meta),
+      manifest(ExportTemplates::manifest),
+      out(NULL),
+      zip(NULL),
+      txt(NULL),
+      emptyRows(0) {
+  // "ddmmyyyy" gives "dmy"
+  for (size_t i = 0; i < pattern.Length(); i++)
+    if (wxString("dmy").Find(pattern[i]) != wxNOT_FOUND &&
+        !dateOrder.EndsWith(wxString(pattern[i])))
+      dateOrder += pattern[i];
+  wxDateTime::GetAmPmStrings(&am, &pm);
+
+  for (int k = 0; k < Units::KINDS; k++)
+    for (int u = 0; u < Units::MAXUNITS && Units::table[k][u].label; u++)
+      if (unitStyles.find(Units::table[k][u].label) == unitStyles.end()) {
+        int n = (int)unitStyles.size();
+        unitStyles[Units::table[k][u].label] = n;
+      }
+}
+
+ODSWriter::~ODSWriter() {
+  delete txt;
+  delete zip;
+  delete out;
+}
+
+bool ODSWriter::open(const wxString& p, const wxString& table, int columns) {
+  path = p;
+  out = new wxFFileOutputStream(path);
+  if (!out->IsOk()) return false;
+  zip = new wxZipOutputStream(*out);
+  txt = new wxTextOutputStream(*zip);
+
+  wxString head = content;
+  head.Replace("table:name=\"Logbook\"", "table:name=\"" + table + "\"");
+  head.Replace(
+      "table:number-columns-repeated=\"33\"",
+      wxString::Format("table:number-columns-repeated=\"%i\"", columns));
+
+  // a number style per unit and number of decimals, see cell()
+  wxString s;
+  map<wxString, int>::iterator it;
+  for (it = unitStyles.begin(); it != unitStyles.end(); it++)
+    for (int d = 0; d <= MAXDECIMALS; d++) {
+      s += wxString::Format(
+          "<number:number-style style:name=\"N%i_%i\">"
+          "<number:number number:decimal-places=\"%i\" "
+          "number:min-integer-digits=\"1\" />"
+          "<number:text> %s</number:text></number:number-style>",
+          it->second, d, d, escapeXML(it->first));
+      s += wxString::Format(
+          "<style:style style:name=\"ce%i_%i\" style:family=\"table-cell\" "
+          "style:parent-style-name=\"Default\" "
+          "style:data-style-name=\"N%i_%i\" />",
+          it->second, d, it->second, d);
+    }
+  head.Replace("</office:automatic-styles>", s + "</office:automatic-styles>");
+
+  zip->PutNextEntry("content.xml");
+  *txt << head;
+  return true;
+}
+
+void ODSWriter::header(const wxArrayString& labels) {
+  vector<int> types(labels.Count(), STRING);
+  row(labels, &types);
+}
+
+void ODSWriter::row(const wxArrayString& cells, const vector<int>* types) {
+  row(render(cells, types));
+}
+
+void ODSWriter::row(const wxString& rendered) {
+  if (rendered.IsEmpty()) {
+    emptyRows++;
+    return;
+  }
+  flushEmptyRows();
+  write(rendered);
+}
+
+void ODSWriter::flushEmptyRows() {
+  if (emptyRows == 0) return;
+  write(wxString::Format(
+      "<table:table-row table:style-name=\"ro2\" "
+      "table:number-rows-repeated=\"%ld\"><table:table-cell />"
+      "</table:table-row>",
+      emptyRows));
+  emptyRows = 0;
+}
+
+wxString ODSWriter::render(const wxArrayString& cells,
+                           const vector<int>* types) const {
+  wxString s = "<table:table-row table:style-name=\"ro2\">";
+  long empty = 0;
+  bool any = false;
+  for (unsigned int i = 0; i < cells.Count(); i++) {
+    if (blank(cells[i])) {
+      empty++;
+      continue;
+    }
+    if (empty) s += emptyCells(empty);
+    empty = 0;
+    s += cell(cells[i], (types && i < types->size()) ? (*types)[i] : AUTO);
+    any = true;
+  }
+  // the empty cells at the end are left out, an empty row is left to row()
+  if (!any) return wxEmptyString;
+  return s + "</table:table-row>";
+}
+
+void ODSWriter::write(const wxString& xml) {
+  if (txt) *txt << xml;
+}
+
+wxString ODSWriter::cell(const wxString& s, int t) const {
+  wxString v = s;
+  v.Trim().Trim(false);
+  wxString iso;
+
+  if (t == DATE && isoDate(v, iso))
+    return "<table:table-cell office:value-type=\"date\" "
+           "office:date-value=\"" +
+           iso + "\">" + paragraphs(s) + "</table:table-cell>";
+  if (t == TIME && isoTime(v, iso))
+    return "<table:table-cell office:value-type=\"time\" "
+           "office:time-value=\"" +
+           iso + "\">" + paragraphs(s) + "</table:table-cell>";
+
+  if (t == AUTO) {
+    // -12.5, 0,75 or 12.40 kts; no leading zeros, that is an id or phone
+    size_t i = 0, n = v.Length(), digits = 0, point = wxString::npos;
+    if (i < n && (v[i] == '+' || v[i] == '-')) i++;
+    size_t first = i;
+    for (; i < n; i++)
+      if (v[i] >= '0' && v[i] <= '9')
+        digits++;
+      else if ((v[i] == '.' || v[i] == ',') && point == wxString::npos &&
+               digits)
+        point = i;
+      else
+        break;
+
+    wxString unit = v.Mid(i);
+    bool number = digits && digits <= 15 && point != i - 1 &&
+                  !(v[first] == '0' && first + 1 < n && v[first + 1] >= '0' &&
+                    v[first + 1] <= '9');
+    map<wxString, int>::const_iterator style = unitStyles.end();
+    if (number && !unit.IsEmpty()) {
+      style = unit.StartsWith(" ") ? unitStyles.find(unit.Mid(1))
+                                   : unitStyles.end();
+      number = style != unitStyles.end();
+    }
+
+    if (number) {
+      wxString value = v.Left(i);
+      value.Replace(",", ".");
+      if (value.StartsWith("+")) value.Remove(0, 1);
+      wxString c = "<table:table-cell ";
+      if (style != unitStyles.end()) {
+        int d = point == wxString::npos ? 0 : (int)(i - point - 1);
+        c += wxString::Format("table:style-name=\"ce%i_%i\" ", style->second,
+                              d > MAXDECIMALS ? MAXDECIMALS : d);
+      }
+      return c + "office:value-type=\"float\" office:value=\"" + value +
+             "\">" + paragraphs(s) + "</table:table-cell>";
+    }
+  }
+
+  return "<table:table-cell office:value-type=\"string\">" + paragraphs(s) +
+         "</table:table-cell>";
+}
+
+// "2021-06-30", else day, month and year in the order of the date pattern
+bool ODSWriter::isoDate(const wxString& s, wxString& iso) const {
+  long n[3];
+  long day = 0, month = 0, year = 0;
+  if (s.Length() >= 10 && s[4] == '-' && s[7] == '-' &&
+      numbers(s.Left(10), n, 3) == 3) {
+    year = n[0];
+    month = n[1];
+    day = n[2];
+  } else {
+    if (dateOrder.Length() != 3 || numbers(s, n, 3) != 3) return false;
+    for (int i = 0; i < 3; i++)
+      if (dateOrder[i] == 'd')
+        day = n[i];
+      else if (dateOrder[i] == 'm')
+        month = n[i];
+      else
+        year = n[i];
+    if (year < 100) year += 2000;
+  }
+  if (month < 1 || month > 12 || day < 1 || day > 31) return false;
+  iso = wxString::Format("%04ld-%02ld-%02ld", year, month, day);
+  return true;
+}
+
+// "14:05", "14:05:30" or "2:05 PM" as ISO duration
+bool ODSWriter::isoTime(const wxString& s, wxString& iso) const {
+  long n[3] = {0, 0, 0};
+  int count = numbers(s, n, 3);
+  if (!s.Contains(":") || count < 2 || count > 3) return false;
+
+  if (!pm.IsEmpty() && s.Contains(pm) && n[0] != 12)
+    n[0] += 12;
+  else if (!am.IsEmpty() && s.Contains(am) && n[0] == 12)
+    n[0] = 0;
+  if (n[0] > 23 || n[1] > 59 || n[2] > 59) return false;
+  iso = wxString::Format("PT%02ldH%02ldM%02ldS", n[0], n[1], n[2]);
+  return true;
+}
+
+bool ODSWriter::close() {
+  if (!txt) return false;
+
+  // empty rows at the end are not written
+  emptyRows = 0;
+  wxString sep(wxFileName::GetPathSeparator());
+  *txt << contentEnd;
+
+  zip->PutNextEntry("mimetype");
+  *txt << "application/vnd.oasis.opendocument.spreadsheet";
+
+  zip->PutNextEntry("styles.xml");
+  *txt << styles;
+
+  zip->PutNextEntry("meta.xml");
+  *txt << meta;
+
+  zip->PutNextEntry("META-INF" + sep + "manifest.xml");
+  *txt << manifest;
+
+  zip->PutNextEntry("Thumbnails" + sep);
+
+  zip->PutNextEntry("Configurations2" + sep + "floater");
+  zip->PutNextEntry("Configurations2" + sep + "menubar");
+  zip->PutNextEntry("Configurations2" + sep + "popupmenu");
+  zip->PutNextEntry("Configurations2" + sep + "progressbar");
+  zip->PutNextEntry("Configurations2" + sep + "statusbar");
+  zip->PutNextEntry("Configurations2" + sep + "toolbar");
+  zip->PutNextEntry("Configurations2" + sep + "images" + sep + "Bitmaps");
+
+  bool ok = zip->Close();
+  return out->Close() && ok;
+}
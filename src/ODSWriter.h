@@ -0,0 +1,86 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+#ifndef _ODSWRITER_H_
+#define _ODSWRITER_H_
+
+#ifndef  WX_PRECOMP
+#include "wx/wx.h"
+#endif //precompiled headers
+
+#include <wx/arrstr.h>
+#include <wx/txtstrm.h>
+#include <wx/wfstream.h>
+#include <wx/zipstrm.h>
+
+#include <map>
+#include <vector>
+
+/**
+ * Writes one table of an ODS spreadsheet straight into the zip.
+ *
+ * Cells are typed: a number becomes a float cell, a number followed by a
+ * unit of the Units table a float cell with a number style showing the
+ * unit, so logbook columns can be summed. Columns given as DATE or TIME
+ * become date and time cells, read in the order of the given date
+ * pattern (LogbookDialog::datePattern) or as ISO date. Everything else is a string cell.
+ *
+ * Runs of empty cells are written as one cell with
+ * table:number-columns-repeated, empty cells at the end of a row not at
+ * all, and row() collapses runs of empty rows with
+ * table:number-rows-repeated. render() only reads members copied at
+ * construction, so rows may be rendered on other threads and handed to
+ * row() in order; an empty row renders as nothing and is counted there.
+ */
+class ODSWriter
+{
+public:
+    enum type { AUTO, STRING, DATE, TIME };
+
+    ODSWriter( const wxString& datePattern );
+    ~ODSWriter();
+
+    bool      open( const wxString& path, const wxString& table, int columns );
+    void      header( const wxArrayString& labels );
+    void      row( const wxArrayString& cells, const std::vector<int>* types = NULL );
+    void      row( const wxString& rendered );
+    wxString  render( const wxArrayString& cells,
+                      const std::vector<int>* types = NULL ) const;
+    bool      close();
+
+private:
+    wxString  cell( const wxString& s, int t ) const;
+    bool      isoDate( const wxString& s, wxString& iso ) const;
+    bool      isoTime( const wxString& s, wxString& iso ) const;
+    void      flushEmptyRows();
+    void      write( const wxString& xml );
+
+    wxString  content, contentEnd, styles, meta, manifest;
+    wxString  dateOrder, am, pm;
+    std::map<wxString, int> unitStyles;
+
+    wxString  path;
+    wxFFileOutputStream* out;
+    wxZipOutputStream*   zip;
+    wxTextOutputStream*  txt;
+    long      emptyRows;
+};
+#endif
@@ -134,6 +134,22 @@ Options::Options(void) {
   dlgWidth = 1010;
   dlgHeight = 535;
   popup = true;
+  instrumentRecorder = false;
+  rollover = 0;
+  rolloverRows = 500;
+  rolloverSize = 256;
+  sealArchives = false;
+  // small Raspberry Pi and Android devices share their memory with the charts
+#if defined __OCPN__ANDROID__ || defined __arm__
+  lowMemory = true;
+#else
+  lowMemory = false;
+#endif
+  memoryBudget = 2048;
+  fleetDirs = wxEmptyString;
+  nmeaPriority = wxEmptyString;
+  nmeaFailover = 5;
+  xdrChannels = wxEmptyString;
   autostarttimer = false;
   for (int i = 0; i < 7; i++) {
     layoutPrefix[i] = "Label_";
@@ -47,6 +47,17 @@ public:
     int			dlgWidth;
     int			dlgHeight;
     bool		popup;
+    bool		instrumentRecorder;
+    int			rollover;
+    int			rolloverRows;
+    int			rolloverSize;
+    bool		sealArchives;
+    bool		lowMemory;
+    int			memoryBudget;
+    wxString	fleetDirs;
+    wxString	nmeaPriority;
+    int			nmeaFailover;
+    wxString	xdrChannels;
     bool        autostarttimer;
     bool		hourFormat;
     bool		statusbarGlobal;
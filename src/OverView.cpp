@@ -36,6 +36,7 @@
 #include "logbook_pi.h"
 #include "Options.h"
 #include "OverView.h"
+#include "VoyageView.h"
 
 using namespace std;
 OverView::OverView(LogbookDialog* d, wxString data, wxString lay,
@@ -137,7 +138,9 @@ void OverView::loadAllLogbooks() {
   wxArrayString files;
 
   logbooks.clear();
-  int i = wxDir::GetAllFiles(data_locn, &files, "*logbook*.txt", wxDIR_FILES);
+  wxDir::GetAllFiles(data_locn, &files, "*logbook*.txt", wxDIR_FILES);
+  wxDir::GetAllFiles(data_locn, &files, "*logbook*.lbz", wxDIR_FILES);
+  int i = files.Count();
 
   for (int f = 0; f < i; f++) {
     // wxFileName name(files.Item(f));
@@ -157,7 +160,11 @@ void OverView::selectLogbook() {
   grid->DeleteRows(0, grid->GetNumberRows());
   row = -1;
 
-  selectedLogbook = selLogbook.files[selLogbook.selRow];
+  // several logbooks are summed up as one voyage
+  wxArrayString selected = selLogbook.selectedFiles();
+  selectedLogbook = (selected.Count() > 1)
+                        ? wxJoin(selected, ';', '\0')
+                        : selLogbook.file(selLogbook.selRow);
   showAllLogbooks = false;
   loadLogbookData(selectedLogbook, false);
   opt->overviewAll = 2;
@@ -207,12 +214,16 @@ void OverView::loadLogbookData(wxString logbook, bool colour) {
 
   resetValues();
 
-  wxFileInputStream input(logbook);
-  wxTextInputStream* stream = new wxTextInputStream(input);
   wxString path = logbook;
+  VoyageView view;
+  wxArrayString files = wxSplit(path, ';', '\0');
+  for (unsigned int i = 0; i < files.Count(); i++) view.add(files[i]);
   wxFileName fn(logbook);
   logbook = fn.GetName();
-  if (logbook == "logbook")
+  if (files.Count() > 1)
+    logbook =
+        wxString::Format(_("Voyage over %i logbooks"), (int)files.Count());
+  else if (logbook == "logbook")
     logbook = _("Active Logbook");
   else {
     wxDateTime dt = parent->getDateTo(logbook);
@@ -225,10 +236,10 @@ void OverView::loadLogbookData(wxString logbook, bool colour) {
   wxString route = "xxx";
   int rowNewLogbook = -1;
 
-  stream->ReadLine();  // skip line with #1.2#
+  long line = 0;
   int month = 0, day = 0, year = 0, hour = 0, min = 0, sec = 0;
 
-  while ((!(t = stream->ReadLine()).IsEmpty())) {
+  while (line < view.rows() && !(t = view.line(line++)).IsEmpty()) {
     sign = wxEmptyString;
     rowNewLogbook++;
     wxStringTokenizer tkz(t, "\t", wxTOKEN_RET_EMPTY);
@@ -1253,10 +1264,13 @@ void OverView::gotoRoute() {
   wxString date = grid->GetCellValue(selectedRow, FSTART);
   wxString path = grid->GetCellValue(selectedRow, FPATH);
 
-  if (logbook->data_locn != path) {
+  if (path.Contains(";")) {
+    if (logbook->voyage != path) logbook->loadVoyage(wxSplit(path, ';', '\0'));
+  } else if (logbook->data_locn != path || !logbook->voyage.IsEmpty()) {
     logbook->data_locn = path;
     logbook->loadSelectedData(path);
   }
+  logbook->pageIn(logbook->heldRows(), true);
 
   int i;
   for (i = 0; i < parent->m_gridGlobal->GetNumberRows(); i++) {
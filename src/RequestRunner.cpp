@@ -0,0 +1,113 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef WX_PRECOMP
+#include <wx/wx.h>
+#endif
+
+#include <wx/jsonreader.h>
+#include <wx/jsonwriter.h>
+
+#include "RequestRunner.h"
+#include "ocpn_plugin.h"
+
+using namespace std;
+
+RequestRunner::RequestRunner() : stopped(false) {}
+
+RequestRunner::~RequestRunner() { stop(); }
+
+void RequestRunner::run(Job job) {
+  reap();
+  stopped = false;
+
+  Worker* w = new Worker(this, job);
+  if (w->Run() != wxTHREAD_NO_ERROR) {
+    // no thread to be had, then it is answered right here
+    delete w;
+    job([](const wxString& id,
+           const wxString& body) { SendPluginMessage(id, body); },
+        []() { return false; });
+    return;
+  }
+  wxMutexLocker locker(lock);
+  workers.push_back(w);
+}
+
+// joins the jobs that are done
+void RequestRunner::reap() {
+  vector<Worker*> done;
+  {
+    wxMutexLocker locker(lock);
+    for (size_t i = 0; i < workers.size();)
+      if (workers[i]->finished) {
+        done.push_back(workers[i]);
+        workers.erase(workers.begin() + i);
+      } else
+        i++;
+  }
+  for (size_t i = 0; i < done.size(); i++) {
+    done[i]->Wait();
+    delete done[i];
+  }
+}
+
+void RequestRunner::stop() {
+  vector<Worker*> all;
+  {
+    wxMutexLocker locker(lock);
+    all.swap(workers);
+  }
+  stopped = true;
+  for (size_t i = 0; i < all.size(); i++) {
+    all[i]->Delete();  // waits for the job to see stopping()
+    delete all[i];
+  }
+  // the replies queued by the jobs go unsent
+  DeletePendingEvents();
+}
+
+// a value the worker may use while the request is freed on the UI thread,
+// wxJSONValue shares its data by an unguarded reference count
+wxJSONValue RequestRunner::unshared(const wxJSONValue& value) {
+  wxJSONValue wrap, copy;
+  wrap.Append(value);
+  wxString text;
+  wxJSONWriter w(wxJSONWRITER_NONE);
+  w.Write(wrap, text);
+  wxJSONReader r;
+  if (r.Parse(text, &copy) != 0) return wxJSONValue();
+  return copy[0];
+}
+
+wxThread::ExitCode RequestRunner::Worker::Entry() {
+  RequestRunner* r = runner;
+  job(
+      [r](const wxString& id, const wxString& body) {
+        wxString i = id.Clone(), b = body.Clone();
+        r->CallAfter([r, i, b]() {
+          if (!r->stopped) SendPluginMessage(i, b);
+        });
+      },
+      [this]() { return TestDestroy(); });
+
+  wxMutexLocker locker(runner->lock);
+  finished = true;
+  return (ExitCode)0;
+}
@@ -0,0 +1,77 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#ifndef _REQUESTRUNNER_H_
+#define _REQUESTRUNNER_H_
+
+#ifndef  WX_PRECOMP
+#include "wx/wx.h"
+#endif //precompiled headers
+
+#include <wx/jsonval.h>
+#include <wx/thread.h>
+
+#include <functional>
+#include <vector>
+
+/**
+ * Answers plugin requests that only read logbook files on threads of
+ * their own, so a long query or a fleet overview does not stall OpenCPN.
+ *
+ * A job is prepared on the UI thread and owns all it reads afterwards. It
+ * calls send() for every reply; the replies reach SendPluginMessage() on
+ * the UI thread in the order they were sent. stopping() turns true when
+ * the job is to end, a job looks at it between rows or files. stop()
+ * ends all jobs and drops the replies not yet sent, the plugin calls it
+ * before it unloads.
+ */
+class RequestRunner : public wxEvtHandler
+{
+public:
+    typedef std::function<void( const wxString& id, const wxString& body )> Send;
+    typedef std::function<bool()> Stopping;
+    typedef std::function<void( Send send, Stopping stopping )> Job;
+
+    RequestRunner();
+    ~RequestRunner();
+
+    void      run( Job job );
+    void      stop();
+
+    static wxJSONValue unshared( const wxJSONValue& value );
+
+private:
+    class Worker : public wxThread
+    {
+    public:
+        Worker( RequestRunner* r, Job j ) : wxThread( wxTHREAD_JOINABLE ), runner( r ), job( j ), finished( false ) {}
+        virtual ExitCode Entry();
+        RequestRunner* runner;
+        Job       job;
+        bool      finished;     // under runner->lock
+    };
+
+    void      reap();
+
+    wxMutex   lock;
+    std::vector<Worker*> workers;
+    bool      stopped;
+};
+#endif
@@ -0,0 +1,132 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef WX_PRECOMP
+#include <wx/wx.h>
+#endif
+
+#include <wx/dcclient.h>
+#include <wx/generic/gridctrl.h>
+
+#include <vector>
+
+#include "RowLayout.h"
+
+using namespace std;
+
+static wxUint64 cellKey(const wxString& text, const wxFont& font,
+                        int width) {
+  wxUint64 h = wxULL(14695981039346656037);
+  for (wxString::const_iterator it = text.begin(); it != text.end(); ++it)
+    h = (h ^ (wxUint64)(*it).GetValue()) * wxULL(1099511628211);
+  const int more[] = {font.GetPointSize(), font.GetWeight(), font.GetStyle(),
+                      font.GetFamily(), width};
+  for (unsigned int i = 0; i < WXSIZEOF(more); i++)
+    h = (h ^ (wxUint64)(wxUint32)more[i]) * wxULL(1099511628211);
+  return h;
+}
+
+// the height of a row label, all labels are one line of the same font
+static int labelHeight(wxGrid* g, wxDC& dc) {
+  wxCoord w, h;
+  dc.SetFont(g->GetLabelFont());
+  dc.GetMultiLineTextExtent("0", &w, &h);
+  return g->GetRowLabelTextOrientation() == wxVERTICAL ? w : h;
+}
+
+int RowLayout::cellHeight(wxGrid* g, wxDC& dc, int row, int col) {
+  wxGridCellAttr* attr = g->GetCellAttr(row, col);
+  wxGridCellRenderer* r = attr->GetRenderer(g, row, col);
+  bool wraps = dynamic_cast<wxGridCellAutoWrapStringRenderer*>(r) != NULL;
+  wxUint64 key = cellKey(g->GetCellValue(row, col), attr->GetFont(),
+                         wraps ? g->GetColSize(col) : 0);
+
+  int height;
+  unordered_map<wxUint64, int>::const_iterator it = heights.find(key);
+  if (it != heights.end())
+    height = it->second;
+  else {
+    if (heights.size() >= MAXCELLS) heights.clear();
+    height = heights[key] = r->GetBestSize(*g, *attr, dc, row, col).y;
+  }
+  r->DecRef();
+  attr->DecRef();
+  return height;
+}
+
+// what AutoSizeRow() sets: the highest cell or label plus a margin
+int RowLayout::rowHeight(wxGrid** grids, wxDC** dcs, int* labels, int count,
+                         int row) {
+  int max = 0;
+  for (int i = 0; i < count; i++) {
+    for (int col = 0; col < grids[i]->GetNumberCols(); col++) {
+      if (!grids[i]->IsColShown(col)) continue;
+      int h = cellHeight(grids[i], *dcs[i], row, col);
+      if (h > max) max = h;
+    }
+    if (labels[i] > max) max = labels[i];
+  }
+  return max ? max + 6 : grids[0]->GetDefaultRowSize();
+}
+
+void RowLayout::apply(wxGrid** grids, int count, int row) {
+  if (row < 0) return;
+  for (int i = 0; i < count; i++)
+    if (row >= grids[i]->GetNumberRows()) return;
+
+  vector<wxDC*> dcs(count);
+  vector<int> labels(count);
+  for (int i = 0; i < count; i++) {
+    dcs[i] = new wxClientDC(grids[i]->GetGridWindow());
+    labels[i] = labelHeight(grids[i], *dcs[i]);
+  }
+
+  int height = rowHeight(grids, &dcs[0], &labels[0], count, row);
+  for (int i = 0; i < count; i++) {
+    grids[i]->SetRowSize(row, height);
+    delete dcs[i];
+  }
+}
+
+// after a load: one DC per grid and one layout pass for all rows
+void RowLayout::applyAll(wxGrid** grids, int count) {
+  int rows = grids[0]->GetNumberRows();
+  for (int i = 1; i < count; i++)
+    rows = wxMin(rows, grids[i]->GetNumberRows());
+  if (rows <= 0) return;
+
+  vector<wxDC*> dcs(count);
+  vector<int> labels(count);
+  for (int i = 0; i < count; i++) {
+    grids[i]->BeginBatch();
+    dcs[i] = new wxClientDC(grids[i]->GetGridWindow());
+    labels[i] = labelHeight(grids[i], *dcs[i]);
+  }
+
+  for (int row = 0; row < rows; row++) {
+    int height = rowHeight(grids, &dcs[0], &labels[0], count, row);
+    for (int i = 0; i < count; i++) grids[i]->SetRowSize(row, height);
+  }
+
+  for (int i = 0; i < count; i++) {
+    delete dcs[i];
+    grids[i]->EndBatch();
+  }
+}
@@ -0,0 +1,57 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#ifndef _ROWLAYOUT_H_
+#define _ROWLAYOUT_H_
+
+#ifndef  WX_PRECOMP
+#include "wx/wx.h"
+#endif //precompiled headers
+
+#include <wx/grid.h>
+
+#include <unordered_map>
+
+/**
+ * Row heights of grids shown side by side, as AutoSizeRow() would give
+ * them, with every row as high as its highest cell in any of the grids.
+ *
+ * The measured height of a cell is kept by a hash of its text, its font
+ * and, for wrapping renderers, its column width. A text seen before, in
+ * any row, column or grid, is not measured again; an edited cell or a
+ * resized wrapping column simply makes a new key. The cache is dropped
+ * when it reaches MAXCELLS entries.
+ */
+class RowLayout
+{
+public:
+    enum { MAXCELLS = 65536 };
+
+    void      apply( wxGrid** grids, int count, int row );
+    void      applyAll( wxGrid** grids, int count );
+
+private:
+    int       rowHeight( wxGrid** grids, wxDC** dcs, int* labels, int count,
+                         int row );
+    int       cellHeight( wxGrid* g, wxDC& dc, int row, int col );
+
+    std::unordered_map<wxUint64, int> heights;
+};
+#endif
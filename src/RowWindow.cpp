@@ -0,0 +1,124 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef WX_PRECOMP
+#include <wx/wx.h>
+#endif
+
+#include <climits>
+
+#include <wx/ffile.h>
+#include <wx/tokenzr.h>
+
+#include "LogbookFile.h"
+#include "RowWindow.h"
+
+using namespace std;
+
+// lines start after the #1.2# header and end at the first empty line,
+// where Logbook::loadData() stops reading
+int RowWindow::scan(const wxString& path) {
+  clear();
+  wxFFile file(path, "rb");
+  if (!file.IsOpened()) return 0;
+
+  char buf[65536], last = 0;
+  wxFileOffset pos = 0, start = 0;
+  bool header = true, done = false;
+  size_t n;
+  while (!done && (n = file.Read(buf, sizeof(buf))) > 0) {
+    for (size_t i = 0; i < n; last = buf[i++], pos++) {
+      if (buf[i] != '\n') continue;
+      wxFileOffset length = pos - start;
+      if (header)
+        header = false;
+      else if (length == 0 || (length == 1 && last == '\r')) {
+        done = true;
+        break;
+      } else
+        offsets.push_back(start);
+      start = pos + 1;
+    }
+  }
+  end = start;
+  return rows();
+}
+
+int RowWindow::fit(long budgetKB) const {
+  if (offsets.empty()) return MINROWS;
+  return fit(budgetKB, (end - offsets[0]) / rows());
+}
+
+int RowWindow::fit(long budgetKB, wxFileOffset line) {
+  // a cell handle per column, the pooled text in wide chars, the row
+  // height and cell attributes of the grids
+  wxFileOffset cost = line * sizeof(wxChar) +
+                      LogbookFile::COLUMNS * sizeof(void*) + ROWOVERHEAD;
+  wxFileOffset n = (wxFileOffset)budgetKB * 1024 / cost;
+  return n < MINROWS ? MINROWS : (n > INT_MAX ? INT_MAX : (int)n);
+}
+
+bool RowWindow::read(const wxString& path, int from, int to,
+                     wxArrayString& lines) const {
+  lines.Clear();
+  if (from >= to) return true;
+  wxFFile file(path, "rb");
+  size_t length = offset(to) - offset(from);
+  vector<char> buf(length);
+  if (!file.IsOpened() || !file.Seek(offset(from)) ||
+      file.Read(&buf[0], length) != length)
+    return false;
+
+  wxString text(&buf[0], wxConvUTF8, length);
+  wxStringTokenizer tkz(text, "\n");
+  while (tkz.HasMoreTokens()) {
+    wxString line = tkz.GetNextToken();
+    if (line.EndsWith("\r")) line.RemoveLast();
+    lines.Add(line);
+  }
+  return (int)lines.Count() == to - from;
+}
+
+// the held rows of the file at path, which is the file the offsets
+// describe, go to out unchanged and the offsets move along with them
+bool RowWindow::copy(const wxString& path, wxOutputStream& out) {
+  wxFileOffset shift = out.TellO() - offset(0);
+  if (kept > 0) {
+    wxFFile file(path, "rb");
+    if (!file.IsOpened() || !file.Seek(offset(0))) return false;
+    char buf[65536];
+    for (wxFileOffset left = offset(kept) - offset(0); left > 0;) {
+      size_t n = file.Read(buf, left < (wxFileOffset)sizeof(buf)
+                                    ? (size_t)left
+                                    : sizeof(buf));
+      if (n == 0 || !out.Write(buf, n).IsOk()) return false;
+      left -= n;
+    }
+  }
+  offsets.resize(kept);
+  for (size_t i = 0; i < offsets.size(); i++) offsets[i] += shift;
+  return true;
+}
+
+void RowWindow::clear() {
+  offsets.clear();
+  end = 0;
+  kept = 0;
+}
@@ -0,0 +1,72 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#ifndef _ROWWINDOW_H_
+#define _ROWWINDOW_H_
+
+#ifndef  WX_PRECOMP
+#include "wx/wx.h"
+#endif //precompiled headers
+
+#include <wx/arrstr.h>
+#include <wx/filefn.h>
+#include <wx/stream.h>
+
+#include <vector>
+
+/**
+ * The rows of the logbook file that the low memory mode leaves on disk.
+ *
+ * The grids hold the newest rows, at most as many as fit() allows for the
+ * memory budget; the held rows before them are only known by the offset
+ * of their line in the file. They are read back a page at a time, and
+ * copied over unchanged when the logbook is saved. The offsets describe
+ * the file as last scanned or written, so they are only good while the
+ * grids have no unsaved changes.
+ */
+class RowWindow
+{
+public:
+    enum { PAGEROWS = 100, MINROWS = 50, ROWOVERHEAD = 1024 };
+
+    RowWindow() : end( 0 ), kept( 0 ) {}
+
+    int       scan( const wxString& path );
+    int       fit( long budgetKB ) const;
+    static int fit( long budgetKB, wxFileOffset lineBytes );
+    bool      read( const wxString& path, int from, int to,
+                    wxArrayString& lines ) const;
+    bool      copy( const wxString& path, wxOutputStream& out );
+    void      add( wxFileOffset offset ) { offsets.push_back( offset ); }
+    void      finish( wxFileOffset offset ) { end = offset; }
+    void      hold( int rows ) { kept = rows; }
+    void      clear();
+
+    int       rows() const { return offsets.size(); }
+    int       held() const { return kept; }
+    wxFileOffset offset( int row ) const
+              { return row < rows() ? offsets[row] : end; }
+
+private:
+    std::vector<wxFileOffset> offsets;
+    wxFileOffset end;
+    int       kept;
+};
+#endif
@@ -0,0 +1,315 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef WX_PRECOMP
+#include <wx/wx.h>
+#endif
+
+#include <wx/filename.h>
+#include <wx/mstream.h>
+#include <wx/txtstrm.h>
+#include <wx/wfstream.h>
+#include <wx/zstream.h>
+
+#include <string.h>
+#include <algorithm>
+
+#include "LogbookFile.h"
+#include "SealedLogbook.h"
+
+using namespace std;
+
+// file layout:
+//   "LBZ1" header-line blocks... index index-offset(8) "LBZX"
+// numbers are little endian, strings are a 4 byte length and UTF-8
+
+static void putInt(string& s, wxUint64 v, int bytes) {
+  for (int i = 0; i < bytes; i++) s += (char)(v >> (8 * i));
+}
+
+static void putString(string& s, const wxString& str) {
+  wxScopedCharBuffer utf8 = str.utf8_str();
+  putInt(s, utf8.length(), 4);
+  s.append(utf8.data(), utf8.length());
+}
+
+static bool getInt(const char*& p, const char* end, wxUint64& v, int bytes) {
+  if (end - p < bytes) return false;
+  v = 0;
+  for (int i = bytes - 1; i >= 0; i--) v = (v << 8) | (unsigned char)p[i];
+  p += bytes;
+  return true;
+}
+
+static bool getString(const char*& p, const char* end, wxString& str) {
+  wxUint64 n;
+  if (!getInt(p, end, n, 4) || (wxUint64)(end - p) < n) return false;
+  str = wxString::FromUTF8(p, (size_t)n);
+  p += n;
+  return true;
+}
+
+SealedLogbook::SealedLogbook() {
+  total = 0;
+  cached = -1;
+}
+
+bool SealedLogbook::isSealed(const wxString& path) {
+  return wxFileName(path).GetExt() == "lbz";
+}
+
+wxString SealedLogbook::sealedPath(const wxString& textPath) {
+  wxFileName fn(textPath);
+  fn.SetExt("lbz");
+  return fn.GetFullPath();
+}
+
+wxString SealedLogbook::textPath(const wxString& sealedPath) {
+  wxFileName fn(sealedPath);
+  fn.SetExt("txt");
+  return fn.GetFullPath();
+}
+
+bool SealedLogbook::seal(const wxString& textPath) {
+  return pack(textPath) && commit(textPath);
+}
+
+// the sealed file goes next to the text file as .lbz.tmp, nothing that a
+// reader opens is touched
+bool SealedLogbook::pack(const wxString& textPath) {
+  wxFile in(textPath);
+  wxString text;
+  if (!in.IsOpened() || !in.ReadAll(&text, wxConvUTF8)) return false;
+  in.Close();
+
+  wxArrayString all = wxSplit(text, '\n', '\0');
+  wxString headLine;
+  vector<string> rows;
+  for (unsigned int i = 0; i < all.Count(); i++) {
+    wxString l = all[i];
+    if (l.EndsWith("\r")) l.RemoveLast();
+    if (l.IsEmpty()) continue;
+    if (l.StartsWith("#1.2#"))
+      headLine = l;
+    else
+      rows.push_back(string(l.utf8_str()));
+  }
+
+  string out("LBZ1");
+  putString(out, headLine);
+
+  string idx;
+  putInt(idx, (rows.size() + BLOCKROWS - 1) / BLOCKROWS, 4);
+  wxArrayString record;
+  for (size_t first = 0; first < rows.size(); first += BLOCKROWS) {
+    size_t last = min(rows.size(), first + BLOCKROWS);
+    string raw;
+    wxString start, end;
+    wxArrayString routes;
+    for (size_t r = first; r < last; r++) {
+      raw += rows[r];
+      raw += '\n';
+      if (!LogbookFile::parse(wxString::FromUTF8(rows[r].c_str()), record))
+        continue;
+      wxString ts = LogbookFile::timestamp(record);
+      if (!ts.IsEmpty() && (start.IsEmpty() || ts < start)) start = ts;
+      if (!ts.IsEmpty() && (end.IsEmpty() || ts > end)) end = ts;
+      if (routes.Index(record[LogbookFile::ROUTE]) == wxNOT_FOUND)
+        routes.Add(record[LogbookFile::ROUTE]);
+    }
+
+    wxMemoryOutputStream mem;
+    {
+      wxZlibOutputStream zlib(mem, wxZ_BEST_COMPRESSION, wxZLIB_ZLIB);
+      zlib.Write(raw.data(), raw.size());
+      zlib.Close();
+    }
+    size_t packed = mem.GetSize();
+
+    putInt(idx, out.size(), 8);
+    putInt(idx, packed, 4);
+    putInt(idx, raw.size(), 4);
+    putInt(idx, last - first, 4);
+    putString(idx, start);
+    putString(idx, end);
+    putInt(idx, routes.Count(), 4);
+    for (unsigned int i = 0; i < routes.Count(); i++)
+      putString(idx, routes[i]);
+
+    size_t at = out.size();
+    out.resize(at + packed);
+    mem.CopyTo(&out[at], packed);
+  }
+  wxUint64 idxOffset = out.size();
+  out += idx;
+  putInt(out, idxOffset, 8);
+  out += "LBZX";
+
+  // write aside and read back, commit() drops the text file
+  wxString path = sealedPath(textPath);
+  wxFile f;
+  if (!f.Create(path + ".tmp", true) ||
+      f.Write(out.data(), out.size()) != out.size())
+    return false;
+  f.Close();
+
+  SealedLogbook check;
+  bool ok = check.open(path + ".tmp") && check.rows() == (long)rows.size() &&
+            check.header() == headLine;
+  for (long r = 0; ok && r < check.rows(); r++)
+    ok = string(check.line(r).utf8_str()) == rows[r];
+  check.file.Close();
+  if (!ok) wxRemoveFile(path + ".tmp");
+  return ok;
+}
+
+bool SealedLogbook::commit(const wxString& textPath) {
+  wxString path = sealedPath(textPath);
+  if (!wxRenameFile(path + ".tmp", path, true)) {
+    wxRemoveFile(path + ".tmp");
+    return false;
+  }
+  return wxRemoveFile(textPath);
+}
+
+bool SealedLogbook::unseal(const wxString& sealedPath) {
+  SealedLogbook s;
+  if (!s.open(sealedPath)) return false;
+
+  wxString path = textPath(sealedPath);
+  {
+    wxFileOutputStream output(path + ".tmp");
+    if (!output.IsOk()) return false;
+    wxTextOutputStream stream(output, wxEOL_NATIVE, wxConvUTF8);
+    stream.WriteString(s.header() + "\n");
+    for (long r = 0; r < s.rows(); r++) stream.WriteString(s.line(r) + "\n");
+  }
+  s.file.Close();
+  if (!wxRenameFile(path + ".tmp", path, true)) return false;
+  return wxRemoveFile(sealedPath);
+}
+
+bool SealedLogbook::open(const wxString& path) {
+  index.clear();
+  total = 0;
+  cached = -1;
+  if (!file.Open(path)) return false;
+
+  // trailer, then the index it points at
+  wxFileOffset size = file.Length();
+  char tail[12];
+  if (size < 16 || file.Seek(size - 12) == wxInvalidOffset ||
+      file.Read(tail, 12) != 12 || memcmp(tail + 8, "LBZX", 4) != 0)
+    return false;
+  const char* p = tail;
+  wxUint64 idxOffset;
+  getInt(p, tail + 8, idxOffset, 8);
+  if ((wxFileOffset)idxOffset >= size - 12) return false;
+
+  string meta((size_t)(size - 12 - idxOffset), '\0');
+  if (file.Seek(idxOffset) == wxInvalidOffset ||
+      file.Read(&meta[0], meta.size()) != (ssize_t)meta.size())
+    return false;
+  p = meta.data();
+  const char* end = p + meta.size();
+
+  wxUint64 count, v;
+  if (!getInt(p, end, count, 4)) return false;
+  for (wxUint64 b = 0; b < count; b++) {
+    block k;
+    if (!getInt(p, end, v, 8)) return false;
+    k.offset = (wxFileOffset)v;
+    if (!getInt(p, end, v, 4)) return false;
+    k.packed = (wxUint32)v;
+    if (!getInt(p, end, v, 4)) return false;
+    k.size = (wxUint32)v;
+    if (!getInt(p, end, v, 4)) return false;
+    k.rows = (wxUint32)v;
+    if (!getString(p, end, k.start) || !getString(p, end, k.end) ||
+        !getInt(p, end, v, 4))
+      return false;
+    for (wxUint64 r = 0; r < v; r++) {
+      wxString route;
+      if (!getString(p, end, route)) return false;
+      k.routes.Add(route);
+    }
+    k.firstRow = total;
+    total += k.rows;
+    index.push_back(k);
+  }
+
+  // the header line right after the magic
+  char magic[8];
+  if (file.Seek(0) == wxInvalidOffset || file.Read(magic, 8) != 8 ||
+      memcmp(magic, "LBZ1", 4) != 0)
+    return false;
+  p = magic + 4;
+  getInt(p, magic + 8, v, 4);
+  string h((size_t)v, '\0');
+  if (v > 0 && file.Read(&h[0], h.size()) != (ssize_t)h.size()) return false;
+  head = wxString::FromUTF8(h.data(), h.size());
+  return true;
+}
+
+int SealedLogbook::findBlock(long row) const {
+  if (row < 0 || row >= total) return -1;
+  int lo = 0, hi = (int)index.size() - 1;
+  while (lo < hi) {
+    int mid = (lo + hi + 1) / 2;
+    if (index[mid].firstRow <= row)
+      lo = mid;
+    else
+      hi = mid - 1;
+  }
+  return lo;
+}
+
+bool SealedLogbook::readBlock(int b) {
+  if (b == cached) return true;
+
+  const block& k = index[b];
+  string packed(k.packed, '\0');
+  if (file.Seek(k.offset) == wxInvalidOffset ||
+      file.Read(&packed[0], packed.size()) != (ssize_t)packed.size())
+    return false;
+
+  wxMemoryInputStream mem(packed.data(), packed.size());
+  wxZlibInputStream zlib(mem, wxZLIB_ZLIB);
+  string raw(k.size, '\0');
+  zlib.Read(&raw[0], raw.size());
+  if (zlib.LastRead() != raw.size()) return false;
+
+  lines.clear();
+  size_t from = 0, nl;
+  while ((nl = raw.find('\n', from)) != string::npos) {
+    lines.push_back(raw.substr(from, nl - from));
+    from = nl + 1;
+  }
+  cached = b;
+  return true;
+}
+
+wxString SealedLogbook::line(long row) {
+  int b = findBlock(row);
+  if (b < 0 || !readBlock(b)) return wxEmptyString;
+
+  size_t local = (size_t)(row - index[b].firstRow);
+  if (local >= lines.size()) return wxEmptyString;
+  return wxString::FromUTF8(lines[local].data(), lines[local].size());
+}
@@ -0,0 +1,92 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#ifndef _SEALEDLOGBOOK_H_
+#define _SEALEDLOGBOOK_H_
+
+#ifndef  WX_PRECOMP
+#include "wx/wx.h"
+#endif //precompiled headers
+
+#include <wx/arrstr.h>
+#include <wx/file.h>
+
+#include <string>
+#include <vector>
+
+/**
+ * A closed logbook stored as until_*_logbook.lbz instead of .txt.
+ *
+ * The lines of the text file are deflated in blocks of BLOCKROWS rows. An
+ * index at the end of the file gives per block its offset, row count,
+ * first/last ISO timestamp and the routes it holds, so a reader inflates
+ * only the blocks it needs. The #1.2# header line is kept uncompressed.
+ *
+ * Sealed logbooks are read only. Anything that edits an archive calls
+ * unseal() first, which gives back the .txt file.
+ *
+ * seal() is pack(), which writes and checks the sealed file aside, and
+ * commit(), which puts it in place of the text file. They may run apart,
+ * pack() on a thread and commit() where no reader has the files open.
+ */
+class SealedLogbook
+{
+public:
+    enum { BLOCKROWS = 256 };
+
+    struct block
+    {
+        wxFileOffset  offset;
+        wxUint32      packed, size, rows;
+        long          firstRow;
+        wxString      start, end;
+        wxArrayString routes;
+    };
+
+    SealedLogbook();
+
+    static bool     isSealed( const wxString& path );
+    static wxString sealedPath( const wxString& textPath );
+    static wxString textPath( const wxString& sealedPath );
+    static bool     seal( const wxString& textPath );
+    static bool     pack( const wxString& textPath );
+    static bool     commit( const wxString& textPath );
+    static bool     unseal( const wxString& sealedPath );
+
+    bool      open( const wxString& path );
+    long      rows() const { return total; }
+    wxString  header() const { return head; }
+    wxString  line( long row );
+    const std::vector<block>& blocks() const { return index; }
+    int       findBlock( long row ) const;
+
+private:
+    bool      readBlock( int b );
+
+    wxFile    file;
+    wxString  head;
+    std::vector<block> index;
+    long      total;
+
+    // the last block inflated, rows are mostly read in order
+    int       cached;
+    std::vector<std::string> lines;
+};
+#endif
@@ -0,0 +1,113 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef WX_PRECOMP
+#include <wx/wx.h>
+#endif
+
+#include <stack>
+
+#include "LogbookDialog.h"
+#include "TextBlocks.h"
+
+using namespace std;
+
+void TextBlocks::add(column& c, const block& b) {
+  if (c.trie.empty()) {
+    node root;
+    root.first = -1;
+    c.trie.push_back(root);
+  }
+  int index = c.blocks.size();
+  c.blocks.push_back(b);
+
+  wxString text = b.text.Lower();
+  int n = 0;
+  for (wxString::const_iterator it = text.begin(); it != text.end(); ++it) {
+    map<wxUniChar, int>::const_iterator next = c.trie[n].next.find(*it);
+    if (next != c.trie[n].next.end())
+      n = next->second;
+    else {
+      node child;
+      child.first = index;
+      c.trie.push_back(child);
+      c.trie[n].next[*it] = c.trie.size() - 1;
+      n = c.trie.size() - 1;
+    }
+  }
+}
+
+// the children of every menu node, found the way FindMenuItem did
+void TextBlocks::rebuild(wxTreeCtrl* tree) {
+  columns.clear();
+
+  wxTreeItemId root = tree->GetRootItem();
+  stack<wxTreeItemId> items;
+  if (root.IsOk()) items.push(root);
+
+  while (!items.empty()) {
+    wxTreeItemId next = items.top();
+    items.pop();
+
+    myTreeItem* data = (myTreeItem*)tree->GetItemData(next);
+    if (next != root && data->type == ColdFinger::NODE && data->menu &&
+        data->grid >= 0) {
+      pair<int, int> key(data->grid, data->gridcol);
+      if (columns.find(key) == columns.end()) {
+        column& c = columns[key];
+        wxTreeItemIdValue cookie;
+        for (wxTreeItemId child = tree->GetFirstChild(next, cookie);
+             child.IsOk(); child = tree->GetNextSibling(child)) {
+          block b;
+          b.name = tree->GetItemText(child);
+          b.text = ((myTreeItem*)tree->GetItemData(child))->text;
+          add(c, b);
+        }
+      }
+    }
+
+    wxTreeItemIdValue cookie;
+    for (wxTreeItemId child = tree->GetFirstChild(next, cookie); child.IsOk();
+         child = tree->GetNextSibling(child))
+      items.push(child);
+  }
+}
+
+const vector<TextBlocks::block>& TextBlocks::blocks(int grid, int col) const {
+  map<pair<int, int>, column>::const_iterator it =
+      columns.find(make_pair(grid, col));
+  return it == columns.end() ? none : it->second.blocks;
+}
+
+const TextBlocks::block* TextBlocks::complete(int grid, int col,
+                                              const wxString& prefix) const {
+  map<pair<int, int>, column>::const_iterator c =
+      columns.find(make_pair(grid, col));
+  if (c == columns.end() || prefix.IsEmpty()) return NULL;
+
+  wxString lower = prefix.Lower();
+  int n = 0;
+  for (wxString::const_iterator it = lower.begin(); it != lower.end(); ++it) {
+    map<wxUniChar, int>::const_iterator next = c->second.trie[n].next.find(*it);
+    if (next == c->second.trie[n].next.end()) return NULL;
+    n = next->second;
+  }
+  return &c->second.blocks[c->second.trie[n].first];
+}
@@ -0,0 +1,75 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#ifndef _TEXTBLOCKS_H_
+#define _TEXTBLOCKS_H_
+
+#ifndef  WX_PRECOMP
+#include "wx/wx.h"
+#endif //precompiled headers
+
+#include <wx/treectrl.h>
+
+#include <map>
+#include <utility>
+#include <vector>
+
+/**
+ * The text blocks of the ColdFinger tree that belong in the right-click
+ * menu, indexed by grid and column. The tree stays the editor and what is
+ * written to Textblocks.xml; rebuild() reads it once whenever the dialog
+ * may have changed it, so a right-click does not walk the tree.
+ *
+ * For completion in the cell editor every column keeps a trie over the
+ * lower case texts of its blocks; each trie node knows the first block,
+ * in menu order, whose text starts with the path to the node.
+ */
+class TextBlocks
+{
+public:
+    struct block
+    {
+        wxString       name;
+        wxString       text;
+    };
+
+    void      rebuild( wxTreeCtrl* tree );
+    const std::vector<block>& blocks( int grid, int col ) const;
+    const block* complete( int grid, int col, const wxString& prefix ) const;
+
+private:
+    struct node
+    {
+        std::map<wxUniChar, int> next;
+        int            first;
+    };
+
+    struct column
+    {
+        std::vector<block> blocks;
+        std::vector<node>  trie;
+    };
+
+    void      add( column& c, const block& b );
+
+    std::map<std::pair<int, int>, column> columns;
+    std::vector<block> none;
+};
+#endif
@@ -0,0 +1,248 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef WX_PRECOMP
+#include <wx/wx.h>
+#endif
+
+#include <wx/filename.h>
+#include <wx/textfile.h>
+
+#include <vector>
+
+#include "LogbookArchive.h"
+#include "SealedLogbook.h"
+#include "UnitConverter.h"
+
+using namespace std;
+
+// names in a --units spec ("distance=km,windspeed=m/s")
+static const char* quantities[UnitConverter::QUANTITIES] = {
+    "distance", "boatspeed", "windspeed", "depth",
+    "wave",     "temperature", "volume"};
+
+// the logbook columns that carry a unit
+static const struct {
+  const char* column;
+  int quantity;
+} columns[] = {{"Distance", UnitConverter::DISTANCE},
+               {"DistanceTotal", UnitConverter::DISTANCE},
+               {"SOG", UnitConverter::BOATSPEED},
+               {"STW", UnitConverter::BOATSPEED},
+               {"Depth", UnitConverter::DEPTH},
+               {"AirTemperature", UnitConverter::TEMPERATURE},
+               {"WaterTemperature", UnitConverter::TEMPERATURE},
+               {"WindSpeed", UnitConverter::WINDSPEED},
+               {"WindSpeedApparent", UnitConverter::WINDSPEED},
+               {"Wave", UnitConverter::WAVE},
+               {"Swell", UnitConverter::WAVE},
+               {"Fuel", UnitConverter::VOLUME},
+               {"FuelTotal", UnitConverter::VOLUME},
+               {"Water", UnitConverter::VOLUME},
+               {"WaterTotal", UnitConverter::VOLUME}};
+
+UnitConverter::UnitConverter() {
+  for (int q = 0; q < QUANTITIES; q++) {
+    target[q] = -1;
+    for (int u = 0; u < Units::MAXUNITS; u++)
+      if (Units::table[kindOf(q)][u].label)
+        labels[q][u] = Units::table[kindOf(q)][u].label;
+  }
+
+  for (int f = 0; f < LogbookFile::FILEFIELDS; f++) {
+    fieldQuantity[f] = -1;
+    int col = LogbookFile::fieldColumn(f);
+    for (size_t i = 0; col >= 0 && i < WXSIZEOF(columns); i++)
+      if (LogbookFile::column(columns[i].column) == col)
+        fieldQuantity[f] = columns[i].quantity;
+  }
+}
+
+int UnitConverter::kindOf(int q) {
+  switch (q) {
+    case DISTANCE:
+      return Units::DISTANCE;
+    case BOATSPEED:
+    case WINDSPEED:
+      return Units::SPEED;
+    case DEPTH:
+    case WAVE:
+      return Units::DEPTH;
+    case TEMPERATURE:
+      return Units::TEMPERATURE;
+  }
+  return Units::VOLUME;
+}
+
+// -1 leaves the quantity as it was logged
+void UnitConverter::setTarget(int q, int unit) {
+  if (q < 0 || q >= QUANTITIES || unit >= Units::MAXUNITS) return;
+  target[q] = (unit >= 0 && Units::table[kindOf(q)][unit].label) ? unit : -1;
+}
+
+// the label the options give a unit, read besides the one in the table
+void UnitConverter::setLabel(int q, int unit, const wxString& label) {
+  if (q >= 0 && q < QUANTITIES && unit >= 0 && unit < Units::MAXUNITS &&
+      !label.IsEmpty())
+    labels[q][unit] = label;
+}
+
+bool UnitConverter::parseTarget(const wxString& spec) {
+  wxArrayString parts = wxSplit(spec, ',', '\0');
+  for (unsigned int i = 0; i < parts.Count(); i++) {
+    wxString name = parts[i].BeforeFirst('=').Trim().Trim(false).Lower();
+    wxString unit = parts[i].AfterFirst('=').Trim().Trim(false);
+    int q = 0;
+    while (q < QUANTITIES && name != quantities[q]) q++;
+    if (q == QUANTITIES) return false;
+    int u = unitOf(q, unit);
+    if (u < 0) return false;
+    target[q] = u;
+  }
+  return true;
+}
+
+bool UnitConverter::hasTarget() const {
+  for (int q = 0; q < QUANTITIES; q++)
+    if (target[q] >= 0) return true;
+  return false;
+}
+
+int UnitConverter::unitOf(int q, const wxString& label) const {
+  for (int u = 0; u < Units::MAXUNITS; u++)
+    if (!labels[q][u].IsEmpty() && label == labels[q][u]) return u;
+  return Units::find(kindOf(q), label);
+}
+
+// "  5.20 kts", "+12.00 gal", "20,10° C": number, what follows, the unit
+bool UnitConverter::parse(int q, const wxString& s, double& value, int& unit,
+                          cell& c) const {
+  size_t i = 0, n = s.Length();
+  while (i < n && s[i] == ' ') i++;
+  size_t start = i;
+  if (i < n && (s[i] == '+' || s[i] == '-')) i++;
+
+  size_t digits = 0, point = wxString::npos;
+  for (; i < n; i++)
+    if (s[i] >= '0' && s[i] <= '9')
+      digits++;
+    else if ((s[i] == '.' || s[i] == ',') && point == wxString::npos)
+      point = i;
+    else
+      break;
+  if (!digits) return false;
+
+  wxString number = s.Mid(start, i - start);
+  c.plus = number.StartsWith("+");
+  c.comma = point != wxString::npos && s[point] == ',';
+  c.decimals = point == wxString::npos ? 0 : (int)(i - point - 1);
+  number.Replace(",", ".");
+  if (!number.ToCDouble(&value)) return false;
+
+  wxString rest = s.Mid(i);
+  wxString label = rest.AfterLast(' ');
+  c.middle = rest.Left(rest.Length() - label.Length());
+  c.label = label;
+  unit = unitOf(q, label);
+  return unit >= 0;
+}
+
+bool UnitConverter::convertFile(const wxString& path, long* cells) const {
+  bool sealed = SealedLogbook::isSealed(path);
+  wxString text = sealed ? SealedLogbook::textPath(path) : path;
+  if (sealed && !SealedLogbook::unseal(path)) return false;
+
+  wxTextFile file(text);
+  if (!file.Open(wxConvUTF8)) return false;
+
+  // parse every number once
+  vector<wxArrayString> lines(file.GetLineCount());
+  vector<cell> refs;
+  vector<double> values, scale, shift;
+  for (size_t l = 0; l < file.GetLineCount(); l++) {
+    if (file[l].IsEmpty() || file[l].StartsWith("#1.2#")) continue;
+    lines[l] = wxSplit(file[l], '\t', '\0');
+    for (size_t f = 0; f < lines[l].Count() && f < LogbookFile::FILEFIELDS;
+         f++) {
+      int q = fieldQuantity[f];
+      if (q < 0 || target[q] < 0) continue;
+
+      cell c;
+      double v;
+      int from;
+      if (!parse(q, LogbookFile::restore(lines[l][f]), v, from, c) ||
+          (from == target[q] && c.label == labels[q][from]))
+        continue;
+
+      // value in target = value * scale + shift
+      const Units::unit& a = Units::table[kindOf(q)][from];
+      const Units::unit& b = Units::table[kindOf(q)][target[q]];
+      c.line = l;
+      c.field = (int)f;
+      refs.push_back(c);
+      values.push_back(v);
+      scale.push_back(b.factor / a.factor);
+      shift.push_back(b.offset - a.offset * b.factor / a.factor);
+    }
+  }
+
+  // one pass over contiguous arrays, left to the compiler to vectorise
+  size_t count = values.size();
+  double* v = values.data();
+  const double* m = scale.data();
+  const double* o = shift.data();
+  for (size_t i = 0; i < count; i++) v[i] = v[i] * m[i] + o[i];
+
+  for (size_t i = 0; i < count; i++) {
+    const cell& c = refs[i];
+    int q = fieldQuantity[c.field];
+    wxString s = wxString::Format(c.plus ? "%+.*f" : "%.*f", c.decimals,
+                                  values[i]);
+    if (c.comma) s.Replace(".", ",");
+    lines[c.line][c.field] = s + c.middle + labels[q][target[q]] + " ";
+  }
+
+  bool ok = true;
+  if (count) {
+    size_t last = wxString::npos;
+    for (size_t i = 0; i < count; i++)
+      if (refs[i].line != last) {
+        last = refs[i].line;
+        file[last] = wxJoin(lines[last], '\t', '\0');
+      }
+    ok = file.Write(wxTextFileType_None, wxConvUTF8);
+  }
+  file.Close();
+
+  if (sealed) ok = SealedLogbook::seal(text) && ok;
+  if (count && LogbookFile::isArchive(path)) LogbookArchive::build(path);
+  if (cells) *cells += count;
+  return ok;
+}
+
+bool UnitConverter::convertDir(const wxString& dataDir, long* cells) const {
+  wxArrayString files = LogbookFile::archives(dataDir);
+  files.Add(wxFileName(dataDir, "logbook.txt").GetFullPath());
+
+  bool ok = true;
+  for (unsigned int i = 0; i < files.Count(); i++)
+    if (wxFileExists(files[i])) ok = convertFile(files[i], cells) && ok;
+  return ok;
+}
@@ -0,0 +1,85 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+#ifndef _UNITCONVERTER_H_
+#define _UNITCONVERTER_H_
+
+#ifndef  WX_PRECOMP
+#include "wx/wx.h"
+#endif //precompiled headers
+
+#include <wx/arrstr.h>
+
+#include "LogbookFile.h"
+#include "Units.h"
+
+/**
+ * Rewrites logbook files from the units they were logged in to others,
+ * e.g. when a boat is handed over to a crew used to other units.
+ *
+ * A cell keeps the unit it was logged in ("5.20 kts", "20.10° C"), so
+ * the source unit is read per cell and files logged in mixed units come
+ * out in one. The numbers of a file are parsed once into one array with
+ * their scale and shift, converted in a single pass over the arrays and
+ * written back with the decimals and decimal point they had. Cells
+ * without a number or with a unit not known are left as they are.
+ *
+ * Sealed archives are unsealed for this and sealed again, archive
+ * summaries are built anew. The converter holds no state while it works,
+ * so one may serve several threads.
+ */
+class UnitConverter
+{
+public:
+    enum quantity { DISTANCE, BOATSPEED, WINDSPEED, DEPTH, WAVE, TEMPERATURE,
+                    VOLUME, QUANTITIES };
+
+    UnitConverter();
+
+    void      setTarget( int q, int unit );
+    void      setLabel( int q, int unit, const wxString& label );
+    bool      parseTarget( const wxString& spec );
+    bool      hasTarget() const;
+
+    bool      convertFile( const wxString& path, long* cells = NULL ) const;
+    bool      convertDir( const wxString& dataDir, long* cells = NULL ) const;
+
+    static int kindOf( int q );
+
+private:
+    struct cell
+    {
+        size_t    line;
+        int       field;
+        int       decimals;
+        bool      comma, plus;
+        wxString  middle, label;
+    };
+
+    int       unitOf( int q, const wxString& label ) const;
+    bool      parse( int q, const wxString& s, double& value, int& unit,
+                     cell& c ) const;
+
+    int       target[QUANTITIES];
+    wxString  labels[QUANTITIES][Units::MAXUNITS];
+    int       fieldQuantity[LogbookFile::FILEFIELDS];
+};
+#endif
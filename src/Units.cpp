@@ -0,0 +1,54 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef WX_PRECOMP
+#include <wx/wx.h>
+#endif
+
+#include "Units.h"
+
+constexpr Units::unit Units::table[Units::KINDS][Units::MAXUNITS];
+
+int Units::temperature(const wxString& label) {
+  return label.Upper().StartsWith("F") ? 1 : 0;
+}
+
+int Units::volume(const wxString& label) {
+  return label.Upper().StartsWith("G") ? 1 : 0;
+}
+
+int Units::speed(char nmeaUnit) {
+  switch (nmeaUnit) {
+    case 'M':
+      return 1;
+    case 'K':
+      return 2;
+  }
+  return 0;
+}
+
+int Units::find(int k, const wxString& label) {
+  for (int u = 0; u < MAXUNITS && table[k][u].label; u++)
+    if (label.CmpNoCase(table[k][u].label) == 0) return u;
+  if (label.IsEmpty()) return -1;
+  if (k == TEMPERATURE) return temperature(label);
+  if (k == VOLUME) return volume(label);
+  return -1;
+}
@@ -0,0 +1,75 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+#ifndef _UNITS_H_
+#define _UNITS_H_
+
+#ifndef  WX_PRECOMP
+#include "wx/wx.h"
+#endif //precompiled headers
+
+/**
+ * The units the logbook is kept in, one table for every place that
+ * converts. The unit of a kind is the index the option choice boxes use
+ * (showDistanceChoice, showBoatSpeedchoice, showWindSpeedchoice, showDepth,
+ * showWaveSwell). A value in a unit is the value in the base unit times
+ * factor plus offset; the base units are NM, knots, metres, Celsius and
+ * litres, as the NMEA sentences deliver them.
+ */
+class Units
+{
+public:
+    enum kind { DISTANCE, SPEED, DEPTH, TEMPERATURE, VOLUME, KINDS };
+    enum { MAXUNITS = 3 };
+
+    struct unit
+    {
+        const char* label;
+        double      factor, offset;
+    };
+
+    static constexpr unit table[KINDS][MAXUNITS] = {
+        { { "NM", 1, 0 },  { "m", 1852, 0 },       { "km", 1.852, 0 } },
+        { { "kts", 1, 0 }, { "m/s", 0.514444, 0 }, { "kmh", 1.852, 0 } },
+        { { "m", 1, 0 },   { "ft", 3.28084, 0 },   { "fth", 0.546807, 0 } },
+        { { "C", 1, 0 },   { "F", 1.8, 32 },       { NULL, 0, 0 } },
+        { { "l", 1, 0 },   { "gal", 0.264172, 0 }, { NULL, 0, 0 } } };
+
+    static constexpr double fromBase( int k, int u, double v )
+    {
+        return v * table[k][u].factor + table[k][u].offset;
+    }
+    static constexpr double toBase( int k, int u, double v )
+    {
+        return ( v - table[k][u].offset ) / table[k][u].factor;
+    }
+    static constexpr double convert( int k, int from, int to, double v )
+    {
+        return fromBase( k, to, toBase( k, from, v ) );
+    }
+
+    // the unit behind a free text option or an NMEA unit letter
+    static int      temperature( const wxString& label );
+    static int      volume( const wxString& label );
+    static int      speed( char nmeaUnit );
+    static int      find( int k, const wxString& label );
+};
+#endif
@@ -0,0 +1,207 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef WX_PRECOMP
+#include <wx/wx.h>
+#endif
+
+#include <wx/filename.h>
+
+#ifdef __WXMSW__
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <string.h>
+#include <algorithm>
+
+#include "LogbookArchive.h"
+#include "LogbookFile.h"
+#include "SealedLogbook.h"
+#include "VoyageView.h"
+
+using namespace std;
+
+VoyageView::VoyageView() {
+  total = 0;
+  LogbookArchive::beginRead();
+}
+
+VoyageView::~VoyageView() {
+  clear();
+  LogbookArchive::endRead();
+}
+
+void VoyageView::clear() {
+  for (unsigned int i = 0; i < segs.size(); i++) {
+    unmap(segs[i]);
+    delete segs[i]->sealed;
+    delete segs[i];
+  }
+  segs.clear();
+  firstRow.clear();
+  total = 0;
+}
+
+bool VoyageView::map(Segment* s) {
+  s->data = NULL;
+  s->size = 0;
+#ifdef __WXMSW__
+  s->file = s->mapping = NULL;
+  HANDLE f = CreateFileW(s->path.wc_str(), GENERIC_READ, FILE_SHARE_READ, NULL,
+                         OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (f == INVALID_HANDLE_VALUE) return false;
+  LARGE_INTEGER size;
+  bool ok = GetFileSizeEx(f, &size) != 0;
+  if (!ok || size.QuadPart == 0) {  // an empty file has no rows
+    CloseHandle(f);
+    return ok;
+  }
+  HANDLE m = CreateFileMapping(f, NULL, PAGE_READONLY, 0, 0, NULL);
+  if (!m) {
+    CloseHandle(f);
+    return false;
+  }
+  s->data = (const char*)MapViewOfFile(m, FILE_MAP_READ, 0, 0, 0);
+  if (!s->data) {
+    CloseHandle(m);
+    CloseHandle(f);
+    return false;
+  }
+  s->file = f;
+  s->mapping = m;
+  s->size = (size_t)size.QuadPart;
+#else
+  int fd = open(s->path.fn_str(), O_RDONLY);
+  if (fd < 0) return false;
+  struct stat st;
+  bool ok = fstat(fd, &st) == 0;
+  if (!ok || st.st_size == 0) {  // an empty file has no rows
+    close(fd);
+    return ok;
+  }
+  void* p = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);  // the mapping keeps the file
+  if (p == MAP_FAILED) return false;
+  s->data = (const char*)p;
+  s->size = (size_t)st.st_size;
+#endif
+  return true;
+}
+
+void VoyageView::unmap(Segment* s) {
+  if (!s->data) return;
+#ifdef __WXMSW__
+  UnmapViewOfFile(s->data);
+  CloseHandle(s->mapping);
+  CloseHandle(s->file);
+#else
+  munmap((void*)s->data, s->size);
+#endif
+  s->data = NULL;
+}
+
+bool VoyageView::add(const wxString& path) {
+  if (!wxFileExists(path)) return false;
+
+  Segment* s = new Segment;
+  s->path = path;
+  s->sealed = NULL;
+  s->data = NULL;
+  if (SealedLogbook::isSealed(path)) {
+    s->sealed = new SealedLogbook;
+    if (!s->sealed->open(path)) {
+      delete s->sealed;
+      delete s;
+      return false;
+    }
+    firstRow.push_back(total);
+    total += s->sealed->rows();
+    segs.push_back(s);
+    return true;
+  }
+
+  if (!map(s)) {
+    delete s;
+    return false;
+  }
+
+  // only the line starts; the #1.2# header and empty lines are no rows
+  const char* p = s->data;
+  const char* end = s->data + s->size;
+  while (p < end) {
+    const char* nl = (const char*)memchr(p, '\n', end - p);
+    if (!nl) nl = end;
+    if (nl > p && *p != '\r' && (nl - p < 5 || strncmp(p, "#1.2#", 5)))
+      s->offsets.push_back(p - s->data);
+    p = nl + 1;
+  }
+
+  firstRow.push_back(total);
+  total += (long)s->offsets.size();
+  segs.push_back(s);
+  return true;
+}
+
+wxString VoyageView::segmentPath(int segment) const {
+  return (segment >= 0 && segment < segments()) ? segs[segment]->path
+                                                : wxString();
+}
+
+wxString VoyageView::segmentName(int segment) const {
+  return wxFileName(segmentPath(segment)).GetName();
+}
+
+long VoyageView::segmentFirstRow(int segment) const {
+  return (segment >= 0 && segment < segments()) ? firstRow[segment] : -1;
+}
+
+int VoyageView::locate(long row, long* local) const {
+  if (row < 0 || row >= total) return -1;
+
+  // the last segment starting at or before row; empty ones share the start
+  int s = (int)(upper_bound(firstRow.begin(), firstRow.end(), row) -
+                firstRow.begin()) - 1;
+  if (local) *local = row - firstRow[s];
+  return s;
+}
+
+wxString VoyageView::line(long row) const {
+  long local;
+  int s = locate(row, &local);
+  if (s < 0) return wxEmptyString;
+
+  const Segment* seg = segs[s];
+  if (seg->sealed) return seg->sealed->line(local);
+
+  const char* p = seg->data + seg->offsets[local];
+  const char* end = seg->data + seg->size;
+  const char* nl = (const char*)memchr(p, '\n', end - p);
+  if (!nl) nl = end;
+  if (nl > p && nl[-1] == '\r') nl--;
+  return wxString::FromUTF8(p, nl - p);
+}
+
+bool VoyageView::record(long row, wxArrayString& record) const {
+  return LogbookFile::parse(line(row), record);
+}
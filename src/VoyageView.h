@@ -0,0 +1,87 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#ifndef _VOYAGEVIEW_H_
+#define _VOYAGEVIEW_H_
+
+#ifndef  WX_PRECOMP
+#include "wx/wx.h"
+#endif //precompiled headers
+
+#include <wx/arrstr.h>
+
+#include <vector>
+
+class SealedLogbook;
+
+/**
+ * Read-only view of several logbook files as one sequence of rows, e.g.
+ * the until_*_logbook.txt archives of a passage followed by the active
+ * logbook.
+ *
+ * Every file (segment) is memory mapped and only the start offsets of its
+ * lines are indexed when it is added. A row is decoded and parsed when it
+ * is asked for, so walking a range of a long voyage touches just that
+ * range. Sealed archives (.lbz) are read block by block instead. The files
+ * must not be written while the view is open; take it after
+ * Logbook::update(). LogbookArchive does not swap sealed archives in while
+ * any view is open.
+ */
+class VoyageView
+{
+public:
+    VoyageView();
+    ~VoyageView();
+
+    bool      add( const wxString& path );
+    void      clear();
+
+    long      rows() const { return total; }
+    int       segments() const { return (int)segs.size(); }
+    wxString  segmentPath( int segment ) const;
+    wxString  segmentName( int segment ) const;
+    long      segmentFirstRow( int segment ) const;
+
+    int       locate( long row, long* local ) const;
+    wxString  line( long row ) const;
+    bool      record( long row, wxArrayString& record ) const;
+
+private:
+    struct Segment
+    {
+        wxString    path;
+        const char* data;
+        size_t      size;
+        std::vector<size_t> offsets;   // start of every logbook line
+        SealedLogbook* sealed;
+#ifdef __WXMSW__
+        void*       file;
+        void*       mapping;
+#endif
+    };
+
+    bool      map( Segment* s );
+    void      unmap( Segment* s );
+
+    std::vector<Segment*> segs;
+    std::vector<long> firstRow;
+    long      total;
+};
+#endif
@@ -0,0 +1,138 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef WX_PRECOMP
+#include <wx/wx.h>
+#endif
+
+#include <wx/tokenzr.h>
+
+#include "InstrumentRecorder.h"
+#include "XDRChannels.h"
+
+using namespace std;
+
+XDRChannels::XDRChannels() : recorder(NULL) { configure(wxEmptyString); }
+
+// FNV-1a over the three fields, each closed by a separator
+wxUint64 XDRChannels::key(const wxString& type, const wxString& name,
+                          const wxString& unit) {
+  wxUint64 h = wxULL(14695981039346656037);
+  const wxString* fields[] = {&type, &name, &unit};
+  for (int f = 0; f < 3; f++) {
+    for (wxString::const_iterator it = fields[f]->begin();
+         it != fields[f]->end(); ++it)
+      h = (h ^ (wxUint64)(*it).GetValue()) * wxULL(1099511628211);
+    h = (h ^ 0x1f) * wxULL(1099511628211);
+  }
+  return h;
+}
+
+void XDRChannels::add(const wxString& type, const wxString& name,
+                      const wxString& unit, int slot, double scale,
+                      bool convert) {
+  target t = {slot, scale, convert, -1};
+  targets[key(type, name, unit)] = t;
+}
+
+void XDRChannels::configure(const wxString& list, InstrumentRecorder* r) {
+  targets.clear();
+  seen.clear();
+  channels.clear();
+  recorder = r;
+
+  add("C", wxEmptyString, wxEmptyString, AIRTEMP, 1);
+  add("P", wxEmptyString, wxEmptyString, PRESSURE, 1);
+  add("P", wxEmptyString, "B", PRESSURE, 1000);
+  add("H", wxEmptyString, wxEmptyString, HUMIDITY, 1);
+  add("V", wxEmptyString, wxEmptyString, VOLUME, 1, false);
+  add("V", wxEmptyString, "M", VOLUME, 1000);
+  add("V", wxEmptyString, "L", VOLUME, 1);
+  add("V", wxEmptyString, "G", VOLUME, 3.7854);
+
+  // Label=Type,Name[,Unit]
+  wxStringTokenizer entries(list, ";");
+  while (entries.HasMoreTokens()) {
+    wxString entry = entries.GetNextToken();
+    wxString label = entry.BeforeFirst('=').Trim().Trim(false);
+    wxArrayString f = wxSplit(entry.AfterFirst('='), ',', '\0');
+    if (label.IsEmpty() || f.Count() < 2) continue;
+    for (unsigned int i = 0; i < f.Count(); i++) f[i].Trim().Trim(false);
+    if (f[0].IsEmpty() || f[1].IsEmpty()) continue;
+
+    channel c;
+    c.label = label;
+    c.unit = f.Count() > 2 ? f[2] : wxString();
+    c.value = 0;
+    add(f[0], f[1], c.unit, CUSTOM + channels.size(), 1);
+    channels.push_back(c);
+  }
+}
+
+bool XDRChannels::find(const wxString& type, const wxString& name,
+                       const wxString& unit, target& t) const {
+  const wxString none;
+  const wxString* names[] = {&name, &name, &none, &none};
+  const wxString* units[] = {&unit, &none, &unit, &none};
+  for (int i = 0; i < 4; i++) {
+    unordered_map<wxUint64, target>::const_iterator it =
+        targets.find(key(type, *names[i], *units[i]));
+    if (it != targets.end()) {
+      t = it->second;
+      return true;
+    }
+  }
+  return false;
+}
+
+// the first sample of a transducer finds its slot and registers it with
+// the recorder, the later ones take both from the cache
+const XDRChannels::target& XDRChannels::resolve(const wxString& type,
+                                                const wxString& name,
+                                                const wxString& unit) {
+  wxUint64 k = key(type, name, unit);
+  unordered_map<wxUint64, target>::const_iterator it = seen.find(k);
+  if (it != seen.end()) return it->second;
+
+  target t = {NONE, 1, false, -1};
+  find(type, name, unit, t);
+  if (recorder) t.recorded = recorder->xdrChannel(name);
+  return seen[k] = t;
+}
+
+void XDRChannels::add(int slot, double value) {
+  channel& c = channels[slot - CUSTOM];
+  c.value = value;
+  c.stats.add(value);
+}
+
+void XDRChannels::toJSON(wxJSONValue& v) {
+  for (size_t i = 0; i < channels.size(); i++) {
+    if (!channels[i].stats.valid()) continue;
+    wxJSONValue c = channels[i].stats.toJSON();
+    c["Value"] = channels[i].value;
+    if (!channels[i].unit.IsEmpty()) c["Unit"] = channels[i].unit;
+    v[channels[i].label] = c;
+  }
+}
+
+void XDRChannels::reset() {
+  for (size_t i = 0; i < channels.size(); i++) channels[i].stats.reset();
+}
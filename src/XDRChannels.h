@@ -0,0 +1,104 @@
+/**
+ * Copyright (c) 2011-2013 Konnibe
+ * Copyright (c) 2013-2015 Del Edson
+ * Copyright (c) 2015-2021 Peter Tulp
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#ifndef _XDRCHANNELS_H_
+#define _XDRCHANNELS_H_
+
+#ifndef  WX_PRECOMP
+#include "wx/wx.h"
+#endif //precompiled headers
+
+#include <wx/jsonval.h>
+
+#include <unordered_map>
+#include <vector>
+
+#include "InstrumentStats.h"
+
+class InstrumentRecorder;
+
+/**
+ * Maps the transducers of XDR sentences to the values the logbook keeps.
+ *
+ * A transducer is looked up by type, name and unit, then without the unit,
+ * then by type and unit, then by type alone, each a single hash lookup.
+ * The built in slots catch any temperature, pressure, humidity and volume
+ * transducer as before; the scale brings bar to mbar and tank volumes to
+ * litres. Only volumes in M, L or G are converted to the volume unit of the
+ * options, a tank reported in another unit (P for percent) passes as is.
+ * Channels registered with the XDRChannels option take their transducers
+ * away from the built in slots and get statistics of their own, so an
+ * exhaust temperature is no longer taken for the air:
+ *
+ *     "Exhaust=C,ENGT1;Port tank=V,FUEL0,L;House battery=U,BATT1,V"
+ *
+ * resolve() looks a transducer up once, with its channel in the
+ * instrument recorder, and answers its later samples from a cache.
+ */
+class XDRChannels
+{
+public:
+    enum slots {NONE = -1,AIRTEMP,PRESSURE,HUMIDITY,VOLUME,CUSTOM};
+
+    struct target
+    {
+        int            slot;    // a slot, CUSTOM + channel or NONE
+        double         scale;
+        bool           convert; // in the base unit of the slot
+        int            recorded;// channel of the recorder, -1 for none
+    };
+
+    struct channel
+    {
+        wxString       label;
+        wxString       unit;
+        double         value;
+        InstrumentStats stats;
+    };
+
+    XDRChannels();
+
+    void      configure( const wxString& list,
+                         InstrumentRecorder* recorder = NULL );
+    bool      find( const wxString& type, const wxString& name,
+                    const wxString& unit, target& t ) const;
+    const target& resolve( const wxString& type, const wxString& name,
+                           const wxString& unit );
+    void      add( int slot, double value );
+
+    size_t    count() const { return channels.size(); }
+    const channel& operator[]( size_t i ) const { return channels[i]; }
+
+    void      toJSON( wxJSONValue& v );
+    void      reset();
+
+private:
+    static wxUint64 key( const wxString& type, const wxString& name,
+                         const wxString& unit );
+    void      add( const wxString& type, const wxString& name,
+                   const wxString& unit, int slot, double scale,
+                   bool convert = true );
+
+    std::unordered_map<wxUint64, target> targets;
+    std::unordered_map<wxUint64, target> seen;
+    std::vector<channel> channels;
+    InstrumentRecorder* recorder;
+};
+#endif
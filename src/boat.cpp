@@ -30,6 +30,7 @@
 #include <wx/filename.h>
 #include <wx/object.h>
 #include <wx/textctrl.h>
+#include <wx/textfile.h>
 #include <wx/tokenzr.h>
 #include <wx/txtstrm.h>
 #include <wx/wfstream.h>
@@ -39,6 +40,7 @@
 #include "Export.h"
 #include "LogbookDialog.h"
 #include "logbook_pi.h"
+#include "ODSWriter.h"
 #include "Options.h"
 
 using namespace std;
@@ -896,25 +898,13 @@ void Boat::deleteRow(int row) {
 }
 
 void Boat::toCSV(wxString savePath) {
-  wxString line;
-  wxString s;
-
   saveData();
 
-  wxTextFile* csvFile = new wxTextFile(savePath);
-  wxString path = savePath;
-  path.Replace("Boat", "Equipment");
-  wxTextFile* csvEquipFile = new wxTextFile(path);
-
-  if (csvFile->Exists()) {
-    ::wxRemoveFile(savePath);
-    ::wxRemoveFile(path);
-    csvFile->Create();
-    equipFile->Create();
-  }
+  if (::wxFileExists(savePath)) ::wxRemoveFile(savePath);
+  wxTextFile csvFile(savePath);
+  csvFile.Create();
 
-  saveCSV(csvFile, true);
-  saveCSV(csvEquipFile, false);
+  saveCSV(&csvFile, true);
 }
 
 void Boat::saveCSV(wxTextFile* file, bool mode) {
@@ -955,24 +945,13 @@ void Boat::saveCSV(wxTextFile* file, bool mode) {
 }
 
 void Boat::toXML(wxString savePath) {
-  wxString line;
-  wxString s;
-
-  wxTextFile* xmlFile = new wxTextFile(savePath);
-  wxString path = savePath;
-  path.Replace("Boat", "Equipment");
-  wxTextFile* xmlEquipFile = new wxTextFile(path);
+  saveData();
 
-  if (xmlFile->Exists()) {
-    ::wxRemoveFile(savePath);
-    ::wxRemoveFile(path);
-    xmlFile->Create();
-    xmlEquipFile->Create();
-  }
+  if (::wxFileExists(savePath)) ::wxRemoveFile(savePath);
+  wxTextFile xmlFile(savePath);
+  xmlFile.Create();
 
-  saveData();
-  saveXML(xmlFile, true);
-  saveXML(xmlEquipFile, false);
+  saveXML(&xmlFile, true);
 }
 
 void Boat::saveXML(wxTextFile* xmlFile, bool mode) {
@@ -1036,158 +1015,41 @@ void Boat::backup(wxString path) {
 }
 
 void Boat::toODS(wxString path) {
-  wxString s = "";
-  wxString line;
-  wxString temp;
-
   saveData();
 
-  saveODS(path, false);
-
-  wxFileName fn(path);
-  wxString sf = fn.GetName();
-  path.Replace(sf, "equipment");
-
-  saveODS(path, true);
-}
-
-void Boat::saveODS(wxString path, bool mode) {
-  wxString temp, col, tableName;
-  int x = 0;
-
-  if (mode) {
-    temp = equip_locn;
-    col = "table:number-columns-repeated=\"4\"";
-    tableName = "Equipment";
-    x = parent->m_gridEquipment->GetNumberCols();
-  } else {
-    temp = data_locn;
-    col = "table:number-columns-repeated=\"31\"";
-    tableName = "Boat";
-    x = ctrlStaticText.GetCount();
-  }
-
-  wxFileInputStream input(temp);
-  wxTextInputStream* stream = new wxTextInputStream(input);
-
-  wxFFileOutputStream out(path);
-  wxZipOutputStream zip(out);
-  wxTextOutputStream txt(zip);
-  wxString sep(wxFileName::GetPathSeparator());
-
-  temp = parent->content;
-  temp.Replace("table:number-columns-repeated=\"33\"", col);
-  temp.Replace("Logbook", tableName);
-  zip.PutNextEntry("content.xml");
-  txt << temp;
-
-  txt << "<table:table-row table:style-name=\"ro2\">";
-  for (int i = 0; i < x; i++) {
-    txt << "<table:table-cell office:value-type=\"string\">";
-    txt << "<text:p>";
-    if (!mode) {
-      if (i == 27) {
-        txt << parent->UserLabel1->GetValue();
-        txt << "</text:p>";
-        txt << "</table:table-cell>";
-
-        txt << "<table:table-cell office:value-type=\"string\">";
-        txt << "<text:p>";
-        txt << parent->UserLabel2->GetValue();
-        txt << "</text:p>";
-        txt << "</table:table-cell>";
-
-        txt << "<table:table-cell office:value-type=\"string\">";
-        txt << "<text:p>";
-        txt << parent->UserLabel3->GetValue();
-        txt << "</text:p>";
-        txt << "</table:table-cell>";
-
-        txt << "<table:table-cell office:value-type=\"string\">";
-        txt << "<text:p>";
-        wxStaticText* t = wxDynamicCast(ctrlStaticText[i], wxStaticText);
-        txt << t->GetLabel();
-      } else {
-        wxStaticText* t = wxDynamicCast(ctrlStaticText[i], wxStaticText);
-        txt << t->GetLabel();
-      }
-    } else
-      txt << parent->m_gridEquipment->GetColLabelValue(i);
-    txt << "</text:p>";
-    txt << "</table:table-cell>";
+  wxArrayString labels;
+  for (unsigned int i = 0; i < ctrlStaticText.GetCount(); i++) {
+    if (i == 27) {
+      labels.Add(parent->UserLabel1->GetValue());
+      labels.Add(parent->UserLabel2->GetValue());
+      labels.Add(parent->UserLabel3->GetValue());
+    }
+    labels.Add(wxDynamicCast(ctrlStaticText[i], wxStaticText)->GetLabel());
   }
-  txt << "</table:table-row>";
-
-  //	bool empty = false;
-  long emptyCol = 0;
-
-  wxString line;
-  while (!input.Eof()) {
-    line = stream->ReadLine();  // for #1.2#
-    int col = 0;
-    if (input.Eof()) break;
-    txt << "<table:table-row table:style-name=\"ro2\">";
-    wxStringTokenizer tkz(line, "\t", wxTOKEN_RET_EMPTY);
-
-    while (tkz.HasMoreTokens()) {
-      wxString s = parent->restoreDangerChar(tkz.GetNextToken().RemoveLast());
-      if (s == "") {
-        txt << "<table:table-cell />";
-        // empty = true;
-        emptyCol++;
-        col++;
-        continue;
-      }
-
-      if (col != 27 && col != 29 && col != 31)
-        txt << "<table:table-cell office:value-type=\"string\">";
-      else {
-        col++;
-        continue;
-      }
 
-      wxStringTokenizer str(s, "\n");
-      while (str.HasMoreTokens()) {
-        wxString e = str.GetNextToken();
-        e.Replace("&", "&amp;");
-        e.Replace("\"", "&quot;");
-        e.Replace("<", "&lt;");
-        e.Replace(">", "&gt;");
-        e.Replace("'", "&apos;");
-        txt << "<text:p>";
-        txt << e;
-        txt << "</text:p>";
+  ODSWriter ods(LogbookDialog::datePattern);
+  if (!ods.open(path, "Boat", labels.Count())) return;
+  ods.header(labels);
+
+  wxTextFile file(data_locn);
+  if (file.Open())
+    for (size_t l = 0; l < file.GetLineCount(); l++) {
+      if (file[l].IsEmpty() || file[l].Contains("#1.2#")) continue;
+
+      // the file columns 27, 29 and 31 are not exported
+      wxArrayString cells;
+      wxStringTokenizer tkz(file[l], "\t", wxTOKEN_RET_EMPTY);
+      for (int col = 0; tkz.HasMoreTokens(); col++) {
+        wxString s = parent->restoreDangerChar(tkz.GetNextToken().RemoveLast());
+        if (col != 27 && col != 29 && col != 31) cells.Add(s);
       }
-      txt << "</table:table-cell>";
-      col++;
+      ods.row(cells);
     }
-    txt << "</table:table-row>";
-    ;
-  }
-  txt << parent->contentEnd;
-
-  zip.PutNextEntry("mimetype");
-  txt << "application/vnd.oasis.opendocument.spreadsheet";
-
-  zip.PutNextEntry("styles.xml");
-  txt << parent->styles;
-
-  zip.PutNextEntry("meta.xml");
-  txt << parent->meta;
-
-  zip.PutNextEntry("META-INF" + sep + "manifest.xml");
-  txt << parent->manifest;
-
-  zip.PutNextEntry("Thumbnails" + sep);
-
-  zip.PutNextEntry("Configurations2" + sep + "floater");
-  zip.PutNextEntry("Configurations2" + sep + "menubar");
-  zip.PutNextEntry("Configurations2" + sep + "popupmenu");
-  zip.PutNextEntry("Configurations2" + sep + "progressbar");
-  zip.PutNextEntry("Configurations2" + sep + "statusbar");
-  zip.PutNextEntry("Configurations2" + sep + "toolbar");
-  zip.PutNextEntry("Configurations2" + sep + "images" + sep + "Bitmaps");
+  ods.close();
+}
 
-  zip.Close();
-  out.Close();
+wxString Boat::equipmentPath(wxString path) {
+  wxFileName fn(path);
+  fn.SetName("equipment");
+  return fn.GetFullPath();
 }
@@ -42,6 +42,7 @@ public:
     void toCSV( wxString path );
     void toXML( wxString path );
     void toODS( wxString path );
+    wxString equipmentPath( wxString path );
     void backup( wxString path );
     void viewHTML( wxString path,wxString layout,bool mode );
     void viewODT( wxString path,wxString layout,bool mode );
@@ -77,7 +78,6 @@ private:
     void createStaticTextList();
     void saveCSV( wxTextFile* file, bool mode );
     void saveXML( wxTextFile* file, bool mode );
-    void saveODS( wxString path, bool mode );
     wxString repeatArea( wxString html );
     wxString repeatAreaODT( wxString odt );
 
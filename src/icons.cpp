@@ -32,10 +32,198 @@
 #include "icons.h"
 
 wxBitmap *_img_logbook_pi;
-wxBitmap *_img_logbook;
-const wxBitmap *_img_Bullet_green;
-const wxBitmap *_img_Bullet_red;
-const wxBitmap *_img_Bullet_yellow;
+
+// the toolbar icon is decoded by initialize_images(), these when first drawn
+/* logbook.png - 1023 bytes */
+static const unsigned char logbook_png[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d,
+    0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20,
+    0x08, 0x06, 0x00, 0x00, 0x00, 0x73, 0x7a, 0x7a, 0xf4, 0x00, 0x00, 0x00,
+    0x01, 0x73, 0x52, 0x47, 0x42, 0x00, 0xae, 0xce, 0x1c, 0xe9, 0x00, 0x00,
+    0x00, 0x06, 0x62, 0x4b, 0x47, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf9, 0x43, 0xbb, 0x7f, 0x00, 0x00, 0x00, 0x09, 0x70, 0x48, 0x59, 0x73,
+    0x00, 0x00, 0x0d, 0xd7, 0x00, 0x00, 0x0d, 0xd7, 0x01, 0x42, 0x28, 0x9b,
+    0x78, 0x00, 0x00, 0x00, 0x07, 0x74, 0x49, 0x4d, 0x45, 0x07, 0xdb, 0x0c,
+    0x0b, 0x11, 0x24, 0x26, 0x98, 0xdd, 0x81, 0x50, 0x00, 0x00, 0x03, 0x7f,
+    0x49, 0x44, 0x41, 0x54, 0x58, 0xc3, 0xb5, 0x97, 0x3d, 0x8f, 0xdc, 0x44,
+    0x18, 0xc7, 0x7f, 0xcf, 0x78, 0xf6, 0xe5, 0xf6, 0x72, 0x9b, 0x40, 0x14,
+    0x88, 0xa0, 0x08, 0x81, 0xa4, 0xa0, 0x89, 0x04, 0x48, 0x04, 0x85, 0x86,
+    0x82, 0x8a, 0x8a, 0x0f, 0x42, 0x4b, 0x03, 0xdc, 0x27, 0xa0, 0xe5, 0x03,
+    0xd0, 0x42, 0x43, 0x47, 0x45, 0x81, 0x44, 0x93, 0x06, 0xa4, 0x88, 0x12,
+    0x42, 0x2a, 0xc4, 0x41, 0xee, 0x8e, 0xe3, 0xf6, 0xf6, 0xcd, 0xeb, 0x99,
+    0x87, 0xc2, 0xe3, 0x59, 0x7b, 0x6d, 0x6f, 0x36, 0x9b, 0xec, 0x48, 0xab,
+    0x5d, 0xdb, 0x2b, 0xff, 0x7f, 0xfe, 0x3f, 0x6f, 0x63, 0x51, 0x55, 0x44,
+    0xa4, 0x0b, 0xdc, 0x01, 0x5e, 0x02, 0xfa, 0xec, 0x76, 0xcd, 0x80, 0xc7,
+    0xc0, 0x03, 0x55, 0x4d, 0x05, 0xe8, 0x01, 0x1f, 0x86, 0x93, 0x7f, 0x00,
+    0xe7, 0x3b, 0x06, 0x18, 0x02, 0xaf, 0x03, 0xd7, 0x80, 0x1f, 0x04, 0xb8,
+    0x4b, 0x07, 0x61, 0xc1, 0xcf, 0xe1, 0x0f, 0x57, 0x80, 0xaf, 0x81, 0xa3,
+    0x70, 0x2c, 0xec, 0xbf, 0x7c, 0xc4, 0x2b, 0xf7, 0x2c, 0x24, 0x42, 0x92,
+    0x08, 0xbe, 0xb8, 0x97, 0x11, 0x8c, 0x15, 0x8c, 0x18, 0x44, 0x14, 0x6f,
+    0x04, 0x11, 0x21, 0x41, 0x40, 0x04, 0xc5, 0xa0, 0x80, 0xd0, 0xe5, 0x85,
+    0xd7, 0xfe, 0xe5, 0xa7, 0xc3, 0xcf, 0x23, 0x46, 0x87, 0x77, 0x58, 0xa0,
+    0x96, 0x84, 0xeb, 0x2c, 0xb8, 0x0f, 0x98, 0x70, 0xe9, 0x2e, 0x70, 0x01,
+    0x7c, 0x03, 0x38, 0xc0, 0x33, 0xfe, 0xdb, 0xf3, 0xdb, 0x77, 0x0a, 0xf8,
+    0xd2, 0x47, 0x57, 0x7e, 0xaf, 0x7e, 0x4a, 0xe7, 0xbb, 0xf0, 0xfe, 0xe1,
+    0xb7, 0xc0, 0x61, 0x04, 0x58, 0xf0, 0x88, 0x84, 0xf7, 0x2c, 0x8e, 0x7d,
+    0x60, 0x5c, 0x02, 0x78, 0x15, 0xf8, 0x18, 0x78, 0x37, 0x1c, 0xf7, 0xe9,
+    0x5f, 0x1d, 0x7d, 0xf1, 0xf6, 0xc9, 0xed, 0x6d, 0x3d, 0x57, 0x52, 0xd2,
+    0xf9, 0xe1, 0xfc, 0xcb, 0x8f, 0xbe, 0xba, 0xce, 0xf7, 0x9f, 0xfc, 0x13,
+    0x4e, 0x8f, 0x71, 0xec, 0x5b, 0xc0, 0xf0, 0x22, 0x86, 0x53, 0x34, 0x5c,
+    0xf0, 0x40, 0x47, 0x55, 0x6f, 0x3e, 0xcf, 0xc0, 0x7f, 0x76, 0x4f, 0x3c,
+    0xbd, 0x5b, 0x6f, 0x02, 0xc7, 0x00, 0x41, 0xd3, 0xe4, 0x00, 0x1e, 0x13,
+    0xec, 0xa2, 0x64, 0xdd, 0x73, 0x5d, 0x46, 0x10, 0x74, 0xe1, 0xa3, 0xd3,
+    0xb9, 0xa6, 0xb1, 0x24, 0x35, 0x00, 0x2d, 0x03, 0x88, 0xc8, 0xd6, 0x30,
+    0xaa, 0x2a, 0xf1, 0x3e, 0x00, 0x6e, 0x91, 0x55, 0x00, 0x92, 0xc2, 0x01,
+    0x2d, 0x01, 0x24, 0x28, 0x6e, 0x09, 0xa0, 0xaa, 0x22, 0x22, 0xa2, 0xaa,
+    0x35, 0x90, 0xf2, 0x79, 0x11, 0x91, 0x15, 0xf1, 0x3a, 0x78, 0x96, 0xb9,
+    0x08, 0xa0, 0x85, 0x03, 0x05, 0xc0, 0x41, 0x10, 0x9d, 0xc4, 0x0c, 0x5e,
+    0x7b, 0xb3, 0x42, 0xb0, 0x80, 0xd0, 0x40, 0xba, 0xde, 0x92, 0x99, 0xe3,
+    0x60, 0x15, 0x40, 0x57, 0x1c, 0xa0, 0x0a, 0xb0, 0x49, 0x08, 0x9a, 0x74,
+    0x45, 0xa4, 0x12, 0x82, 0xbc, 0xf4, 0x26, 0x2e, 0x68, 0x51, 0xe8, 0xd6,
+    0x43, 0xe0, 0xaa, 0x00, 0xb5, 0x9b, 0xb4, 0x43, 0x3c, 0x39, 0x04, 0xe9,
+    0x0a, 0x00, 0x18, 0x03, 0x18, 0xfa, 0x01, 0x42, 0x31, 0x24, 0xb1, 0xb9,
+    0x6c, 0x9b, 0x78, 0xda, 0x28, 0x0e, 0xd0, 0x9d, 0x6b, 0xd4, 0xe9, 0xaf,
+    0xe6, 0x80, 0xc6, 0x10, 0x48, 0xe8, 0x80, 0x5b, 0x55, 0x41, 0xd9, 0x88,
+    0x9a, 0x7b, 0xe3, 0xd3, 0x9a, 0x03, 0x79, 0x19, 0x56, 0x73, 0x80, 0x6d,
+    0x42, 0xb0, 0x2e, 0x1c, 0xcb, 0x39, 0x78, 0xe6, 0x2b, 0x55, 0x50, 0x29,
+    0xc3, 0x5e, 0x00, 0x48, 0x51, 0x20, 0x5b, 0x57, 0x72, 0x5b, 0xaf, 0xec,
+    0xd4, 0xd3, 0xab, 0x97, 0xa1, 0x00, 0xc2, 0x2c, 0xef, 0x15, 0x38, 0x7c,
+    0x5b, 0x08, 0x9e, 0x54, 0x65, 0x4d, 0x66, 0x54, 0x8e, 0xdc, 0xcc, 0x47,
+    0x9d, 0x5e, 0xae, 0x6b, 0xc3, 0x16, 0x41, 0xd9, 0x8b, 0x53, 0x0a, 0xdc,
+    0x12, 0xa0, 0x08, 0x41, 0xe1, 0x40, 0xf9, 0xbb, 0x9c, 0xed, 0x4d, 0xb6,
+    0xd7, 0x5c, 0xcb, 0x46, 0x2e, 0x6e, 0x77, 0xa6, 0xb9, 0xe3, 0x16, 0x87,
+    0x32, 0x08, 0x10, 0xcb, 0xf8, 0xbb, 0xa6, 0xec, 0x6e, 0xfa, 0x6e, 0xab,
+    0x84, 0xc6, 0x3c, 0x38, 0xfb, 0x73, 0x11, 0x75, 0xfa, 0xc0, 0x08, 0xb5,
+    0x80, 0x32, 0x47, 0x23, 0xd9, 0xe2, 0xe9, 0x1b, 0x51, 0x5b, 0x25, 0xd4,
+    0x12, 0x78, 0x74, 0x92, 0x45, 0x9d, 0x1c, 0x24, 0x00, 0x80, 0x22, 0xcd,
+    0x0e, 0x14, 0xb3, 0x60, 0x6d, 0x83, 0xd9, 0x34, 0x49, 0xf7, 0xce, 0x7c,
+    0x65, 0x9b, 0x10, 0x01, 0xfa, 0x28, 0xb3, 0xf8, 0xd4, 0x1b, 0xcd, 0x82,
+    0xb6, 0x10, 0x35, 0x95, 0x63, 0xbc, 0x36, 0x2b, 0xdd, 0xb7, 0x8f, 0x90,
+    0xe6, 0x5b, 0x32, 0x65, 0x8e, 0x67, 0x10, 0x5b, 0xb1, 0xc7, 0x2d, 0xcb,
+    0xf0, 0x59, 0xc6, 0x71, 0x69, 0x97, 0x95, 0xaf, 0x41, 0xa9, 0xd7, 0x4c,
+    0xf0, 0x24, 0xa8, 0xc5, 0xe1, 0x39, 0x40, 0x99, 0x06, 0xba, 0xbc, 0x02,
+    0xb2, 0x4d, 0x1a, 0x51, 0x5b, 0xc3, 0x69, 0x4d, 0xc2, 0x69, 0xc9, 0x81,
+    0x3d, 0x84, 0x33, 0xbc, 0x05, 0x3c, 0x33, 0x3c, 0xcb, 0xbd, 0x6e, 0xeb,
+    0x2c, 0x58, 0x37, 0x6e, 0x37, 0x1a, 0xc7, 0xa5, 0xfd, 0x74, 0xe8, 0x07,
+    0x01, 0x60, 0x82, 0xe3, 0x52, 0x05, 0xe0, 0xa9, 0x67, 0x41, 0x59, 0xbb,
+    0xb5, 0x0a, 0xca, 0x00, 0xf9, 0x36, 0xd8, 0x5b, 0x24, 0x88, 0x57, 0x1d,
+    0xd0, 0x67, 0x99, 0x05, 0x4d, 0xcb, 0xfb, 0x8a, 0x06, 0x5c, 0x02, 0xa6,
+    0xb8, 0xdc, 0x01, 0xc1, 0x93, 0x84, 0xa7, 0x16, 0xc6, 0xbb, 0x78, 0x3d,
+    0xf3, 0x8a, 0x8b, 0x1a, 0x44, 0x8f, 0xbd, 0xc1, 0x71, 0x41, 0xc6, 0x00,
+    0x8b, 0x23, 0x7f, 0x4b, 0xf8, 0x75, 0x17, 0x00, 0x99, 0x23, 0x8d, 0x1a,
+    0x16, 0x47, 0xc6, 0x00, 0xc7, 0x85, 0xc5, 0x72, 0xcc, 0x94, 0x1b, 0x5c,
+    0xe1, 0x24, 0xbc, 0x32, 0x39, 0xfe, 0xe3, 0x91, 0x88, 0x1c, 0x01, 0x5d,
+    0xc0, 0x70, 0xf9, 0xd6, 0x5f, 0x9f, 0xde, 0xfe, 0xfd, 0xa6, 0xed, 0xd0,
+    0x35, 0xc2, 0xc6, 0x23, 0xc9, 0x2b, 0xea, 0x15, 0x9f, 0x79, 0xd2, 0x4c,
+    0x39, 0xa7, 0x53, 0x72, 0x60, 0xca, 0x0d, 0x2c, 0xc7, 0x02, 0x0c, 0x49,
+    0xf8, 0x00, 0xe1, 0x31, 0x19, 0x0f, 0x81, 0xd1, 0x8e, 0x5f, 0x4e, 0x0f,
+    0xb0, 0xbc, 0x81, 0x72, 0x0d, 0xc7, 0x8f, 0xa2, 0xaa, 0xc8, 0x55, 0x19,
+    0x32, 0xe1, 0x2d, 0x66, 0x0c, 0xc3, 0x53, 0xef, 0x72, 0xa5, 0x58, 0x46,
+    0x0c, 0xf9, 0x45, 0x4f, 0xf4, 0xfc, 0x7f, 0x56, 0x29, 0xf1, 0xee, 0xd8,
+    0xf8, 0x3c, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae,
+    0x42, 0x60, 0x82};
+
+static const unsigned char Bullet_green[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d,
+    0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0a,
+    0x08, 0x06, 0x00, 0x00, 0x00, 0x8d, 0x32, 0xcf, 0xbd, 0x00, 0x00, 0x00,
+    0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0b, 0x12, 0x00, 0x00, 0x0b,
+    0x12, 0x01, 0xd2, 0xdd, 0x7e, 0xfc, 0x00, 0x00, 0x01, 0x1f, 0x49, 0x44,
+    0x41, 0x54, 0x78, 0x9c, 0x65, 0xd0, 0xbf, 0x4b, 0x02, 0x01, 0x18, 0xc6,
+    0xf1, 0xf7, 0x4f, 0xba, 0x45, 0x04, 0xa7, 0x13, 0x6e, 0x53, 0x04, 0xd1,
+    0xe5, 0xe4, 0x14, 0xe1, 0xe0, 0xce, 0x93, 0x3b, 0x3c, 0x75, 0x90, 0x14,
+    0x17, 0x91, 0x86, 0x96, 0xc0, 0x2d, 0x08, 0x21, 0x68, 0x88, 0xa4, 0x9a,
+    0x43, 0x9d, 0x84, 0x08, 0x21, 0x84, 0x44, 0x70, 0x88, 0x82, 0x70, 0x28,
+    0x10, 0x02, 0xa1, 0x1f, 0x74, 0xc5, 0xb7, 0xc1, 0x0c, 0x42, 0x1e, 0xde,
+    0xe9, 0xf9, 0xf0, 0x0e, 0x8f, 0x00, 0x02, 0x48, 0x40, 0xc0, 0x94, 0x29,
+    0x83, 0xaf, 0x01, 0xa3, 0xb7, 0x11, 0xcb, 0xcf, 0x25, 0x9b, 0x0e, 0x10,
+    0x01, 0x64, 0xc6, 0x8c, 0x06, 0x0d, 0x5c, 0x5c, 0x6c, 0x6c, 0xf2, 0x2f,
+    0x79, 0xd2, 0x37, 0x69, 0x3a, 0x93, 0x0e, 0xc1, 0x77, 0x00, 0x20, 0x32,
+    0x67, 0x4e, 0xf9, 0x37, 0x25, 0x4a, 0xd8, 0x81, 0x8d, 0xb1, 0x30, 0x48,
+    0x4d, 0x52, 0x44, 0x8f, 0xa3, 0xd4, 0x2f, 0xea, 0x6b, 0xd8, 0xa2, 0x85,
+    0x8f, 0x4f, 0x95, 0x2a, 0x3e, 0x3e, 0x56, 0x60, 0xa1, 0xdf, 0xeb, 0xc4,
+    0x2e, 0x63, 0xa8, 0x5d, 0x15, 0xa5, 0xa6, 0x30, 0xbe, 0x1b, 0x23, 0x0e,
+    0x0e, 0x1e, 0x1e, 0x65, 0xca, 0x54, 0xa8, 0x50, 0x78, 0x2d, 0x90, 0xbc,
+    0x4e, 0xa2, 0x1e, 0xa9, 0x84, 0xda, 0x21, 0x94, 0x9a, 0x42, 0xfb, 0xbc,
+    0x8d, 0x98, 0x1f, 0x26, 0x56, 0x60, 0x51, 0xa4, 0x88, 0x87, 0x87, 0xf5,
+    0x64, 0x11, 0xda, 0x5d, 0x83, 0xcd, 0xb9, 0x5d, 0x17, 0xd1, 0x1f, 0x74,
+    0x32, 0x8f, 0x19, 0xb2, 0xcf, 0x59, 0x8c, 0x85, 0xb1, 0x85, 0x94, 0x9a,
+    0x42, 0xf3, 0xb4, 0x89, 0xe4, 0xae, 0x72, 0x24, 0x46, 0x09, 0xe2, 0xc3,
+    0x38, 0xda, 0x99, 0x46, 0x78, 0x2f, 0xbc, 0x05, 0xfb, 0xb7, 0x7d, 0x64,
+    0xb8, 0x18, 0xa2, 0x9d, 0x68, 0x44, 0xf6, 0x23, 0xeb, 0x62, 0xe7, 0x3f,
+    0x32, 0x0f, 0x4c, 0xfe, 0x76, 0xec, 0x4d, 0x7a, 0x84, 0x1b, 0xdb, 0x9f,
+    0x9c, 0x43, 0x87, 0xd5, 0xfb, 0x0a, 0x40, 0x7e, 0x00, 0x57, 0x28, 0x02,
+    0x1e, 0xf4, 0x28, 0xf9, 0x10, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e,
+    0x44, 0xae, 0x42, 0x60, 0x82,
+};
+
+static const unsigned char Bullet_red[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d,
+    0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0a,
+    0x08, 0x06, 0x00, 0x00, 0x00, 0x8d, 0x32, 0xcf, 0xbd, 0x00, 0x00, 0x00,
+    0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0b, 0x12, 0x00, 0x00, 0x0b,
+    0x12, 0x01, 0xd2, 0xdd, 0x7e, 0xfc, 0x00, 0x00, 0x00, 0xe1, 0x49, 0x44,
+    0x41, 0x54, 0x78, 0x9c, 0x6d, 0xd0, 0xbf, 0x4a, 0x42, 0x71, 0x14, 0xc0,
+    0xf1, 0x2f, 0xe8, 0xe2, 0x23, 0xdc, 0x07, 0xf0, 0x3d, 0xdc, 0x04, 0x9f,
+    0xc0, 0xd1, 0x51, 0x7c, 0x01, 0x89, 0xd6, 0x68, 0x68, 0x09, 0xc1, 0x25,
+    0x08, 0x31, 0x6c, 0x90, 0xb0, 0x5a, 0x74, 0x08, 0xcc, 0x25, 0x88, 0x96,
+    0xb8, 0xd0, 0x1c, 0x05, 0xe9, 0x50, 0x53, 0x2e, 0x95, 0xde, 0x8a, 0x6f,
+    0xc3, 0xfd, 0xdd, 0x4b, 0x58, 0xc3, 0x81, 0xf3, 0xe7, 0xc3, 0xe1, 0x70,
+    0x50, 0x51, 0x71, 0xbd, 0xd6, 0xf1, 0xd8, 0xaf, 0x4e, 0xc7, 0xf7, 0x7e,
+    0xdf, 0x64, 0x3e, 0x37, 0x9f, 0x29, 0x69, 0x32, 0x99, 0x68, 0x14, 0xa5,
+    0x25, 0xf8, 0x0a, 0xde, 0x16, 0x0a, 0xc6, 0xad, 0x96, 0xdf, 0x49, 0x62,
+    0x0a, 0xa7, 0x53, 0x2d, 0x16, 0x73, 0xf4, 0x09, 0x2e, 0xc0, 0x18, 0x3c,
+    0x06, 0xcf, 0xeb, 0xf5, 0x00, 0xcb, 0xe5, 0x1c, 0x65, 0xf0, 0x01, 0xbc,
+    0x00, 0x7b, 0x60, 0x1b, 0xbc, 0x9f, 0xcd, 0xe4, 0x37, 0x12, 0x7c, 0x03,
+    0x6f, 0xc0, 0x23, 0x70, 0x27, 0xc0, 0xb3, 0x66, 0x53, 0x56, 0x61, 0x4b,
+    0x06, 0x9f, 0xc1, 0xdd, 0x00, 0xb2, 0xe8, 0xd5, 0x6a, 0xf2, 0x08, 0x3e,
+    0x81, 0x2f, 0xe1, 0xb6, 0x4d, 0xd4, 0x06, 0x4f, 0x1a, 0x0d, 0xb9, 0x8e,
+    0x22, 0xaf, 0xc0, 0x4b, 0xf0, 0x14, 0xdc, 0xfb, 0x07, 0xde, 0x8d, 0x46,
+    0xb2, 0x18, 0x0c, 0x1c, 0x82, 0xfb, 0xa1, 0xb9, 0xb5, 0x81, 0x0e, 0x2a,
+    0x15, 0xf3, 0x3f, 0xc6, 0xdd, 0xae, 0xdb, 0xa5, 0xd2, 0x9f, 0x4d, 0x87,
+    0xd5, 0xaa, 0x1f, 0xcb, 0xa5, 0x2a, 0x3f, 0x8b, 0xc0, 0xd5, 0x5b, 0x5f,
+    0xfb, 0xcc, 0xea, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae,
+    0x42, 0x60, 0x82,
+};
+
+static const unsigned char Bullet_yellow[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d,
+    0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0a,
+    0x08, 0x06, 0x00, 0x00, 0x00, 0x8d, 0x32, 0xcf, 0xbd, 0x00, 0x00, 0x00,
+    0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0b, 0x12, 0x00, 0x00, 0x0b,
+    0x12, 0x01, 0xd2, 0xdd, 0x7e, 0xfc, 0x00, 0x00, 0x01, 0x20, 0x49, 0x44,
+    0x41, 0x54, 0x78, 0x9c, 0x65, 0xd0, 0xb1, 0x4b, 0x02, 0x71, 0x18, 0xc6,
+    0xf1, 0xdf, 0x9f, 0x74, 0x4b, 0x04, 0x4d, 0x06, 0x6e, 0x45, 0x10, 0xb5,
+    0x18, 0x16, 0x81, 0x70, 0x66, 0x28, 0x59, 0x5d, 0x5c, 0x25, 0x41, 0x94,
+    0x38, 0x44, 0x10, 0x34, 0x04, 0x89, 0x48, 0x81, 0x83, 0x54, 0xd6, 0xd2,
+    0x50, 0x94, 0x04, 0x09, 0x21, 0x92, 0x1c, 0x15, 0x41, 0x52, 0x29, 0xd8,
+    0x41, 0x09, 0x41, 0x20, 0x6a, 0xa7, 0x67, 0x7c, 0x1b, 0x3c, 0x0b, 0x71,
+    0x78, 0xe0, 0x81, 0xf7, 0xc3, 0x33, 0xbc, 0x02, 0x10, 0xad, 0x98, 0xc0,
+    0x03, 0xcd, 0xc6, 0x25, 0xb5, 0x4a, 0x8a, 0x46, 0xfd, 0x93, 0xff, 0x1b,
+    0xc2, 0x2a, 0x8f, 0x40, 0x00, 0xf0, 0x42, 0xdd, 0xcd, 0x57, 0x69, 0x92,
+    0x6c, 0x7a, 0x14, 0xed, 0x76, 0x9b, 0x9f, 0xa6, 0x89, 0x05, 0x9f, 0x80,
+    0x59, 0x2b, 0x33, 0x98, 0x86, 0x1b, 0xbd, 0xe0, 0x44, 0xcb, 0x8c, 0x10,
+    0xdb, 0xeb, 0xe7, 0x24, 0xb1, 0xdc, 0x86, 0x6b, 0x80, 0x1f, 0x98, 0x07,
+    0xfc, 0x98, 0x86, 0x4c, 0x3e, 0xe7, 0xe0, 0xfc, 0x74, 0x80, 0x68, 0xd8,
+    0x86, 0xaa, 0x48, 0xbc, 0x3c, 0x67, 0x10, 0xe0, 0x01, 0x7c, 0xd6, 0xe2,
+    0x1c, 0xd5, 0xca, 0x14, 0xe9, 0xd4, 0x30, 0xfb, 0x51, 0x1b, 0xc1, 0xd5,
+    0x1e, 0x54, 0x45, 0xe2, 0xf8, 0x28, 0x88, 0x30, 0xca, 0x2e, 0xcc, 0xaa,
+    0x0c, 0xe6, 0x34, 0xe0, 0xe3, 0xe3, 0x5d, 0x26, 0xb4, 0xde, 0x02, 0xed,
+    0x44, 0x23, 0x5e, 0x44, 0x21, 0xe7, 0xa0, 0xf8, 0x3a, 0x46, 0xe9, 0x6d,
+    0x1c, 0x3d, 0xef, 0x24, 0x14, 0xec, 0x44, 0xaa, 0x22, 0x71, 0x10, 0x5f,
+    0x41, 0xdc, 0x5c, 0x4f, 0x90, 0xba, 0x1a, 0x22, 0x79, 0x36, 0x48, 0x22,
+    0x6e, 0x67, 0x23, 0xd4, 0xdb, 0x05, 0xef, 0xef, 0x2e, 0x10, 0x7a, 0x31,
+    0x49, 0x3c, 0x66, 0x67, 0x6b, 0xb3, 0x0f, 0x55, 0x91, 0x58, 0x5a, 0xe8,
+    0x44, 0xbb, 0x3b, 0x2e, 0xfe, 0xfe, 0xa8, 0x65, 0x0f, 0x09, 0x2c, 0x76,
+    0x2f, 0x45, 0xc2, 0x1e, 0xbe, 0x6b, 0x65, 0x00, 0xf1, 0x0b, 0xfb, 0x12,
+    0x21, 0x2e, 0x20, 0xdf, 0x1c, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45,
+    0x4e, 0x44, 0xae, 0x42, 0x60, 0x82,
+};
+
+LazyBitmap _img_logbook(logbook_png, sizeof(logbook_png));
+LazyBitmap _img_Bullet_green(Bullet_green, sizeof(Bullet_green));
+LazyBitmap _img_Bullet_red(Bullet_red, sizeof(Bullet_red));
+LazyBitmap _img_Bullet_yellow(Bullet_yellow, sizeof(Bullet_yellow));
 
 #ifdef PLUGIN_USE_SVG
 wxString _svg_logbookkonni;
@@ -43,6 +231,14 @@ wxString _svg_logbookkonni_rollover;
 wxString _svg_logbookkonni_toggled;
 #endif
 
+const wxBitmap& LazyBitmap::operator*() {
+  if (!bitmap) {
+    wxMemoryInputStream sm(png, size);
+    bitmap = new wxBitmap(wxImage(sm));
+  }
+  return *bitmap;
+}
+
 void initialize_images(void) {
   /* logbook_pi.png - 3327 bytes */
   static const unsigned char logbook_pi_png[] = {
@@ -325,215 +521,10 @@ void initialize_images(void) {
       0x89, 0x43, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae,
       0x42, 0x60, 0x82};
 
-  /* logbook.png - 1023 bytes */
-  static const unsigned char logbook_png[] = {
-      0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d,
-      0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20,
-      0x08, 0x06, 0x00, 0x00, 0x00, 0x73, 0x7a, 0x7a, 0xf4, 0x00, 0x00, 0x00,
-      0x01, 0x73, 0x52, 0x47, 0x42, 0x00, 0xae, 0xce, 0x1c, 0xe9, 0x00, 0x00,
-      0x00, 0x06, 0x62, 0x4b, 0x47, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0xf9, 0x43, 0xbb, 0x7f, 0x00, 0x00, 0x00, 0x09, 0x70, 0x48, 0x59, 0x73,
-      0x00, 0x00, 0x0d, 0xd7, 0x00, 0x00, 0x0d, 0xd7, 0x01, 0x42, 0x28, 0x9b,
-      0x78, 0x00, 0x00, 0x00, 0x07, 0x74, 0x49, 0x4d, 0x45, 0x07, 0xdb, 0x0c,
-      0x0b, 0x11, 0x24, 0x26, 0x98, 0xdd, 0x81, 0x50, 0x00, 0x00, 0x03, 0x7f,
-      0x49, 0x44, 0x41, 0x54, 0x58, 0xc3, 0xb5, 0x97, 0x3d, 0x8f, 0xdc, 0x44,
-      0x18, 0xc7, 0x7f, 0xcf, 0x78, 0xf6, 0xe5, 0xf6, 0x72, 0x9b, 0x40, 0x14,
-      0x88, 0xa0, 0x08, 0x81, 0xa4, 0xa0, 0x89, 0x04, 0x48, 0x04, 0x85, 0x86,
-      0x82, 0x8a, 0x8a, 0x0f, 0x42, 0x4b, 0x03, 0xdc, 0x27, 0xa0, 0xe5, 0x03,
-      0xd0, 0x42, 0x43, 0x47, 0x45, 0x81, 0x44, 0x93, 0x06, 0xa4, 0x88, 0x12,
-      0x42, 0x2a, 0xc4, 0x41, 0xee, 0x8e, 0xe3, 0xf6, 0xf6, 0xcd, 0xeb, 0x99,
-      0x87, 0xc2, 0xe3, 0x59, 0x7b, 0x6d, 0x6f, 0x36, 0x9b, 0xec, 0x48, 0xab,
-      0x5d, 0xdb, 0x2b, 0xff, 0x7f, 0xfe, 0x3f, 0x6f, 0x63, 0x51, 0x55, 0x44,
-      0xa4, 0x0b, 0xdc, 0x01, 0x5e, 0x02, 0xfa, 0xec, 0x76, 0xcd, 0x80, 0xc7,
-      0xc0, 0x03, 0x55, 0x4d, 0x05, 0xe8, 0x01, 0x1f, 0x86, 0x93, 0x7f, 0x00,
-      0xe7, 0x3b, 0x06, 0x18, 0x02, 0xaf, 0x03, 0xd7, 0x80, 0x1f, 0x04, 0xb8,
-      0x4b, 0x07, 0x61, 0xc1, 0xcf, 0xe1, 0x0f, 0x57, 0x80, 0xaf, 0x81, 0xa3,
-      0x70, 0x2c, 0xec, 0xbf, 0x7c, 0xc4, 0x2b, 0xf7, 0x2c, 0x24, 0x42, 0x92,
-      0x08, 0xbe, 0xb8, 0x97, 0x11, 0x8c, 0x15, 0x8c, 0x18, 0x44, 0x14, 0x6f,
-      0x04, 0x11, 0x21, 0x41, 0x40, 0x04, 0xc5, 0xa0, 0x80, 0xd0, 0xe5, 0x85,
-      0xd7, 0xfe, 0xe5, 0xa7, 0xc3, 0xcf, 0x23, 0x46, 0x87, 0x77, 0x58, 0xa0,
-      0x96, 0x84, 0xeb, 0x2c, 0xb8, 0x0f, 0x98, 0x70, 0xe9, 0x2e, 0x70, 0x01,
-      0x7c, 0x03, 0x38, 0xc0, 0x33, 0xfe, 0xdb, 0xf3, 0xdb, 0x77, 0x0a, 0xf8,
-      0xd2, 0x47, 0x57, 0x7e, 0xaf, 0x7e, 0x4a, 0xe7, 0xbb, 0xf0, 0xfe, 0xe1,
-      0xb7, 0xc0, 0x61, 0x04, 0x58, 0xf0, 0x88, 0x84, 0xf7, 0x2c, 0x8e, 0x7d,
-      0x60, 0x5c, 0x02, 0x78, 0x15, 0xf8, 0x18, 0x78, 0x37, 0x1c, 0xf7, 0xe9,
-      0x5f, 0x1d, 0x7d, 0xf1, 0xf6, 0xc9, 0xed, 0x6d, 0x3d, 0x57, 0x52, 0xd2,
-      0xf9, 0xe1, 0xfc, 0xcb, 0x8f, 0xbe, 0xba, 0xce, 0xf7, 0x9f, 0xfc, 0x13,
-      0x4e, 0x8f, 0x71, 0xec, 0x5b, 0xc0, 0xf0, 0x22, 0x86, 0x53, 0x34, 0x5c,
-      0xf0, 0x40, 0x47, 0x55, 0x6f, 0x3e, 0xcf, 0xc0, 0x7f, 0x76, 0x4f, 0x3c,
-      0xbd, 0x5b, 0x6f, 0x02, 0xc7, 0x00, 0x41, 0xd3, 0xe4, 0x00, 0x1e, 0x13,
-      0xec, 0xa2, 0x64, 0xdd, 0x73, 0x5d, 0x46, 0x10, 0x74, 0xe1, 0xa3, 0xd3,
-      0xb9, 0xa6, 0xb1, 0x24, 0x35, 0x00, 0x2d, 0x03, 0x88, 0xc8, 0xd6, 0x30,
-      0xaa, 0x2a, 0xf1, 0x3e, 0x00, 0x6e, 0x91, 0x55, 0x00, 0x92, 0xc2, 0x01,
-      0x2d, 0x01, 0x24, 0x28, 0x6e, 0x09, 0xa0, 0xaa, 0x22, 0x22, 0xa2, 0xaa,
-      0x35, 0x90, 0xf2, 0x79, 0x11, 0x91, 0x15, 0xf1, 0x3a, 0x78, 0x96, 0xb9,
-      0x08, 0xa0, 0x85, 0x03, 0x05, 0xc0, 0x41, 0x10, 0x9d, 0xc4, 0x0c, 0x5e,
-      0x7b, 0xb3, 0x42, 0xb0, 0x80, 0xd0, 0x40, 0xba, 0xde, 0x92, 0x99, 0xe3,
-      0x60, 0x15, 0x40, 0x57, 0x1c, 0xa0, 0x0a, 0xb0, 0x49, 0x08, 0x9a, 0x74,
-      0x45, 0xa4, 0x12, 0x82, 0xbc, 0xf4, 0x26, 0x2e, 0x68, 0x51, 0xe8, 0xd6,
-      0x43, 0xe0, 0xaa, 0x00, 0xb5, 0x9b, 0xb4, 0x43, 0x3c, 0x39, 0x04, 0xe9,
-      0x0a, 0x00, 0x18, 0x03, 0x18, 0xfa, 0x01, 0x42, 0x31, 0x24, 0xb1, 0xb9,
-      0x6c, 0x9b, 0x78, 0xda, 0x28, 0x0e, 0xd0, 0x9d, 0x6b, 0xd4, 0xe9, 0xaf,
-      0xe6, 0x80, 0xc6, 0x10, 0x48, 0xe8, 0x80, 0x5b, 0x55, 0x41, 0xd9, 0x88,
-      0x9a, 0x7b, 0xe3, 0xd3, 0x9a, 0x03, 0x79, 0x19, 0x56, 0x73, 0x80, 0x6d,
-      0x42, 0xb0, 0x2e, 0x1c, 0xcb, 0x39, 0x78, 0xe6, 0x2b, 0x55, 0x50, 0x29,
-      0xc3, 0x5e, 0x00, 0x48, 0x51, 0x20, 0x5b, 0x57, 0x72, 0x5b, 0xaf, 0xec,
-      0xd4, 0xd3, 0xab, 0x97, 0xa1, 0x00, 0xc2, 0x2c, 0xef, 0x15, 0x38, 0x7c,
-      0x5b, 0x08, 0x9e, 0x54, 0x65, 0x4d, 0x66, 0x54, 0x8e, 0xdc, 0xcc, 0x47,
-      0x9d, 0x5e, 0xae, 0x6b, 0xc3, 0x16, 0x41, 0xd9, 0x8b, 0x53, 0x0a, 0xdc,
-      0x12, 0xa0, 0x08, 0x41, 0xe1, 0x40, 0xf9, 0xbb, 0x9c, 0xed, 0x4d, 0xb6,
-      0xd7, 0x5c, 0xcb, 0x46, 0x2e, 0x6e, 0x77, 0xa6, 0xb9, 0xe3, 0x16, 0x87,
-      0x32, 0x08, 0x10, 0xcb, 0xf8, 0xbb, 0xa6, 0xec, 0x6e, 0xfa, 0x6e, 0xab,
-      0x84, 0xc6, 0x3c, 0x38, 0xfb, 0x73, 0x11, 0x75, 0xfa, 0xc0, 0x08, 0xb5,
-      0x80, 0x32, 0x47, 0x23, 0xd9, 0xe2, 0xe9, 0x1b, 0x51, 0x5b, 0x25, 0xd4,
-      0x12, 0x78, 0x74, 0x92, 0x45, 0x9d, 0x1c, 0x24, 0x00, 0x80, 0x22, 0xcd,
-      0x0e, 0x14, 0xb3, 0x60, 0x6d, 0x83, 0xd9, 0x34, 0x49, 0xf7, 0xce, 0x7c,
-      0x65, 0x9b, 0x10, 0x01, 0xfa, 0x28, 0xb3, 0xf8, 0xd4, 0x1b, 0xcd, 0x82,
-      0xb6, 0x10, 0x35, 0x95, 0x63, 0xbc, 0x36, 0x2b, 0xdd, 0xb7, 0x8f, 0x90,
-      0xe6, 0x5b, 0x32, 0x65, 0x8e, 0x67, 0x10, 0x5b, 0xb1, 0xc7, 0x2d, 0xcb,
-      0xf0, 0x59, 0xc6, 0x71, 0x69, 0x97, 0x95, 0xaf, 0x41, 0xa9, 0xd7, 0x4c,
-      0xf0, 0x24, 0xa8, 0xc5, 0xe1, 0x39, 0x40, 0x99, 0x06, 0xba, 0xbc, 0x02,
-      0xb2, 0x4d, 0x1a, 0x51, 0x5b, 0xc3, 0x69, 0x4d, 0xc2, 0x69, 0xc9, 0x81,
-      0x3d, 0x84, 0x33, 0xbc, 0x05, 0x3c, 0x33, 0x3c, 0xcb, 0xbd, 0x6e, 0xeb,
-      0x2c, 0x58, 0x37, 0x6e, 0x37, 0x1a, 0xc7, 0xa5, 0xfd, 0x74, 0xe8, 0x07,
-      0x01, 0x60, 0x82, 0xe3, 0x52, 0x05, 0xe0, 0xa9, 0x67, 0x41, 0x59, 0xbb,
-      0xb5, 0x0a, 0xca, 0x00, 0xf9, 0x36, 0xd8, 0x5b, 0x24, 0x88, 0x57, 0x1d,
-      0xd0, 0x67, 0x99, 0x05, 0x4d, 0xcb, 0xfb, 0x8a, 0x06, 0x5c, 0x02, 0xa6,
-      0xb8, 0xdc, 0x01, 0xc1, 0x93, 0x84, 0xa7, 0x16, 0xc6, 0xbb, 0x78, 0x3d,
-      0xf3, 0x8a, 0x8b, 0x1a, 0x44, 0x8f, 0xbd, 0xc1, 0x71, 0x41, 0xc6, 0x00,
-      0x8b, 0x23, 0x7f, 0x4b, 0xf8, 0x75, 0x17, 0x00, 0x99, 0x23, 0x8d, 0x1a,
-      0x16, 0x47, 0xc6, 0x00, 0xc7, 0x85, 0xc5, 0x72, 0xcc, 0x94, 0x1b, 0x5c,
-      0xe1, 0x24, 0xbc, 0x32, 0x39, 0xfe, 0xe3, 0x91, 0x88, 0x1c, 0x01, 0x5d,
-      0xc0, 0x70, 0xf9, 0xd6, 0x5f, 0x9f, 0xde, 0xfe, 0xfd, 0xa6, 0xed, 0xd0,
-      0x35, 0xc2, 0xc6, 0x23, 0xc9, 0x2b, 0xea, 0x15, 0x9f, 0x79, 0xd2, 0x4c,
-      0x39, 0xa7, 0x53, 0x72, 0x60, 0xca, 0x0d, 0x2c, 0xc7, 0x02, 0x0c, 0x49,
-      0xf8, 0x00, 0xe1, 0x31, 0x19, 0x0f, 0x81, 0xd1, 0x8e, 0x5f, 0x4e, 0x0f,
-      0xb0, 0xbc, 0x81, 0x72, 0x0d, 0xc7, 0x8f, 0xa2, 0xaa, 0xc8, 0x55, 0x19,
-      0x32, 0xe1, 0x2d, 0x66, 0x0c, 0xc3, 0x53, 0xef, 0x72, 0xa5, 0x58, 0x46,
-      0x0c, 0xf9, 0x45, 0x4f, 0xf4, 0xfc, 0x7f, 0x56, 0x29, 0xf1, 0xee, 0xd8,
-      0xf8, 0x3c, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae,
-      0x42, 0x60, 0x82};
-
   {
     wxMemoryInputStream sm(logbook_pi_png, sizeof(logbook_pi_png));
     _img_logbook_pi = new wxBitmap(wxImage(sm));
   }
-  {
-    wxMemoryInputStream sm(logbook_png, sizeof(logbook_png));
-    _img_logbook = new wxBitmap(wxImage(sm));
-  }
-
-  static unsigned char Bullet_green[] = {
-      0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d,
-      0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0a,
-      0x08, 0x06, 0x00, 0x00, 0x00, 0x8d, 0x32, 0xcf, 0xbd, 0x00, 0x00, 0x00,
-      0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0b, 0x12, 0x00, 0x00, 0x0b,
-      0x12, 0x01, 0xd2, 0xdd, 0x7e, 0xfc, 0x00, 0x00, 0x01, 0x1f, 0x49, 0x44,
-      0x41, 0x54, 0x78, 0x9c, 0x65, 0xd0, 0xbf, 0x4b, 0x02, 0x01, 0x18, 0xc6,
-      0xf1, 0xf7, 0x4f, 0xba, 0x45, 0x04, 0xa7, 0x13, 0x6e, 0x53, 0x04, 0xd1,
-      0xe5, 0xe4, 0x14, 0xe1, 0xe0, 0xce, 0x93, 0x3b, 0x3c, 0x75, 0x90, 0x14,
-      0x17, 0x91, 0x86, 0x96, 0xc0, 0x2d, 0x08, 0x21, 0x68, 0x88, 0xa4, 0x9a,
-      0x43, 0x9d, 0x84, 0x08, 0x21, 0x84, 0x44, 0x70, 0x88, 0x82, 0x70, 0x28,
-      0x10, 0x02, 0xa1, 0x1f, 0x74, 0xc5, 0xb7, 0xc1, 0x0c, 0x42, 0x1e, 0xde,
-      0xe9, 0xf9, 0xf0, 0x0e, 0x8f, 0x00, 0x02, 0x48, 0x40, 0xc0, 0x94, 0x29,
-      0x83, 0xaf, 0x01, 0xa3, 0xb7, 0x11, 0xcb, 0xcf, 0x25, 0x9b, 0x0e, 0x10,
-      0x01, 0x64, 0xc6, 0x8c, 0x06, 0x0d, 0x5c, 0x5c, 0x6c, 0x6c, 0xf2, 0x2f,
-      0x79, 0xd2, 0x37, 0x69, 0x3a, 0x93, 0x0e, 0xc1, 0x77, 0x00, 0x20, 0x32,
-      0x67, 0x4e, 0xf9, 0x37, 0x25, 0x4a, 0xd8, 0x81, 0x8d, 0xb1, 0x30, 0x48,
-      0x4d, 0x52, 0x44, 0x8f, 0xa3, 0xd4, 0x2f, 0xea, 0x6b, 0xd8, 0xa2, 0x85,
-      0x8f, 0x4f, 0x95, 0x2a, 0x3e, 0x3e, 0x56, 0x60, 0xa1, 0xdf, 0xeb, 0xc4,
-      0x2e, 0x63, 0xa8, 0x5d, 0x15, 0xa5, 0xa6, 0x30, 0xbe, 0x1b, 0x23, 0x0e,
-      0x0e, 0x1e, 0x1e, 0x65, 0xca, 0x54, 0xa8, 0x50, 0x78, 0x2d, 0x90, 0xbc,
-      0x4e, 0xa2, 0x1e, 0xa9, 0x84, 0xda, 0x21, 0x94, 0x9a, 0x42, 0xfb, 0xbc,
-      0x8d, 0x98, 0x1f, 0x26, 0x56, 0x60, 0x51, 0xa4, 0x88, 0x87, 0x87, 0xf5,
-      0x64, 0x11, 0xda, 0x5d, 0x83, 0xcd, 0xb9, 0x5d, 0x17, 0xd1, 0x1f, 0x74,
-      0x32, 0x8f, 0x19, 0xb2, 0xcf, 0x59, 0x8c, 0x85, 0xb1, 0x85, 0x94, 0x9a,
-      0x42, 0xf3, 0xb4, 0x89, 0xe4, 0xae, 0x72, 0x24, 0x46, 0x09, 0xe2, 0xc3,
-      0x38, 0xda, 0x99, 0x46, 0x78, 0x2f, 0xbc, 0x05, 0xfb, 0xb7, 0x7d, 0x64,
-      0xb8, 0x18, 0xa2, 0x9d, 0x68, 0x44, 0xf6, 0x23, 0xeb, 0x62, 0xe7, 0x3f,
-      0x32, 0x0f, 0x4c, 0xfe, 0x76, 0xec, 0x4d, 0x7a, 0x84, 0x1b, 0xdb, 0x9f,
-      0x9c, 0x43, 0x87, 0xd5, 0xfb, 0x0a, 0x40, 0x7e, 0x00, 0x57, 0x28, 0x02,
-      0x1e, 0xf4, 0x28, 0xf9, 0x10, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e,
-      0x44, 0xae, 0x42, 0x60, 0x82,
-  };
-
-  {
-    wxMemoryInputStream sm(Bullet_green, sizeof(Bullet_green));
-    _img_Bullet_green = new wxBitmap(wxImage(sm));
-  }
-
-  static unsigned char Bullet_red[] = {
-      0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d,
-      0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0a,
-      0x08, 0x06, 0x00, 0x00, 0x00, 0x8d, 0x32, 0xcf, 0xbd, 0x00, 0x00, 0x00,
-      0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0b, 0x12, 0x00, 0x00, 0x0b,
-      0x12, 0x01, 0xd2, 0xdd, 0x7e, 0xfc, 0x00, 0x00, 0x00, 0xe1, 0x49, 0x44,
-      0x41, 0x54, 0x78, 0x9c, 0x6d, 0xd0, 0xbf, 0x4a, 0x42, 0x71, 0x14, 0xc0,
-      0xf1, 0x2f, 0xe8, 0xe2, 0x23, 0xdc, 0x07, 0xf0, 0x3d, 0xdc, 0x04, 0x9f,
-      0xc0, 0xd1, 0x51, 0x7c, 0x01, 0x89, 0xd6, 0x68, 0x68, 0x09, 0xc1, 0x25,
-      0x08, 0x31, 0x6c, 0x90, 0xb0, 0x5a, 0x74, 0x08, 0xcc, 0x25, 0x88, 0x96,
-      0xb8, 0xd0, 0x1c, 0x05, 0xe9, 0x50, 0x53, 0x2e, 0x95, 0xde, 0x8a, 0x6f,
-      0xc3, 0xfd, 0xdd, 0x4b, 0x58, 0xc3, 0x81, 0xf3, 0xe7, 0xc3, 0xe1, 0x70,
-      0x50, 0x51, 0x71, 0xbd, 0xd6, 0xf1, 0xd8, 0xaf, 0x4e, 0xc7, 0xf7, 0x7e,
-      0xdf, 0x64, 0x3e, 0x37, 0x9f, 0x29, 0x69, 0x32, 0x99, 0x68, 0x14, 0xa5,
-      0x25, 0xf8, 0x0a, 0xde, 0x16, 0x0a, 0xc6, 0xad, 0x96, 0xdf, 0x49, 0x62,
-      0x0a, 0xa7, 0x53, 0x2d, 0x16, 0x73, 0xf4, 0x09, 0x2e, 0xc0, 0x18, 0x3c,
-      0x06, 0xcf, 0xeb, 0xf5, 0x00, 0xcb, 0xe5, 0x1c, 0x65, 0xf0, 0x01, 0xbc,
-      0x00, 0x7b, 0x60, 0x1b, 0xbc, 0x9f, 0xcd, 0xe4, 0x37, 0x12, 0x7c, 0x03,
-      0x6f, 0xc0, 0x23, 0x70, 0x27, 0xc0, 0xb3, 0x66, 0x53, 0x56, 0x61, 0x4b,
-      0x06, 0x9f, 0xc1, 0xdd, 0x00, 0xb2, 0xe8, 0xd5, 0x6a, 0xf2, 0x08, 0x3e,
-      0x81, 0x2f, 0xe1, 0xb6, 0x4d, 0xd4, 0x06, 0x4f, 0x1a, 0x0d, 0xb9, 0x8e,
-      0x22, 0xaf, 0xc0, 0x4b, 0xf0, 0x14, 0xdc, 0xfb, 0x07, 0xde, 0x8d, 0x46,
-      0xb2, 0x18, 0x0c, 0x1c, 0x82, 0xfb, 0xa1, 0xb9, 0xb5, 0x81, 0x0e, 0x2a,
-      0x15, 0xf3, 0x3f, 0xc6, 0xdd, 0xae, 0xdb, 0xa5, 0xd2, 0x9f, 0x4d, 0x87,
-      0xd5, 0xaa, 0x1f, 0xcb, 0xa5, 0x2a, 0x3f, 0x8b, 0xc0, 0xd5, 0x5b, 0x5f,
-      0xfb, 0xcc, 0xea, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae,
-      0x42, 0x60, 0x82,
-  };
-
-  {
-    wxMemoryInputStream sm(Bullet_red, sizeof(Bullet_red));
-    _img_Bullet_red = new wxBitmap(wxImage(sm));
-  }
-
-  static unsigned char Bullet_yellow[] = {
-      0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d,
-      0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0a,
-      0x08, 0x06, 0x00, 0x00, 0x00, 0x8d, 0x32, 0xcf, 0xbd, 0x00, 0x00, 0x00,
-      0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0b, 0x12, 0x00, 0x00, 0x0b,
-      0x12, 0x01, 0xd2, 0xdd, 0x7e, 0xfc, 0x00, 0x00, 0x01, 0x20, 0x49, 0x44,
-      0x41, 0x54, 0x78, 0x9c, 0x65, 0xd0, 0xb1, 0x4b, 0x02, 0x71, 0x18, 0xc6,
-      0xf1, 0xdf, 0x9f, 0x74, 0x4b, 0x04, 0x4d, 0x06, 0x6e, 0x45, 0x10, 0xb5,
-      0x18, 0x16, 0x81, 0x70, 0x66, 0x28, 0x59, 0x5d, 0x5c, 0x25, 0x41, 0x94,
-      0x38, 0x44, 0x10, 0x34, 0x04, 0x89, 0x48, 0x81, 0x83, 0x54, 0xd6, 0xd2,
-      0x50, 0x94, 0x04, 0x09, 0x21, 0x92, 0x1c, 0x15, 0x41, 0x52, 0x29, 0xd8,
-      0x41, 0x09, 0x41, 0x20, 0x6a, 0xa7, 0x67, 0x7c, 0x1b, 0x3c, 0x0b, 0x71,
-      0x78, 0xe0, 0x81, 0xf7, 0xc3, 0x33, 0xbc, 0x02, 0x10, 0xad, 0x98, 0xc0,
-      0x03, 0xcd, 0xc6, 0x25, 0xb5, 0x4a, 0x8a, 0x46, 0xfd, 0x93, 0xff, 0x1b,
-      0xc2, 0x2a, 0x8f, 0x40, 0x00, 0xf0, 0x42, 0xdd, 0xcd, 0x57, 0x69, 0x92,
-      0x6c, 0x7a, 0x14, 0xed, 0x76, 0x9b, 0x9f, 0xa6, 0x89, 0x05, 0x9f, 0x80,
-      0x59, 0x2b, 0x33, 0x98, 0x86, 0x1b, 0xbd, 0xe0, 0x44, 0xcb, 0x8c, 0x10,
-      0xdb, 0xeb, 0xe7, 0x24, 0xb1, 0xdc, 0x86, 0x6b, 0x80, 0x1f, 0x98, 0x07,
-      0xfc, 0x98, 0x86, 0x4c, 0x3e, 0xe7, 0xe0, 0xfc, 0x74, 0x80, 0x68, 0xd8,
-      0x86, 0xaa, 0x48, 0xbc, 0x3c, 0x67, 0x10, 0xe0, 0x01, 0x7c, 0xd6, 0xe2,
-      0x1c, 0xd5, 0xca, 0x14, 0xe9, 0xd4, 0x30, 0xfb, 0x51, 0x1b, 0xc1, 0xd5,
-      0x1e, 0x54, 0x45, 0xe2, 0xf8, 0x28, 0x88, 0x30, 0xca, 0x2e, 0xcc, 0xaa,
-      0x0c, 0xe6, 0x34, 0xe0, 0xe3, 0xe3, 0x5d, 0x26, 0xb4, 0xde, 0x02, 0xed,
-      0x44, 0x23, 0x5e, 0x44, 0x21, 0xe7, 0xa0, 0xf8, 0x3a, 0x46, 0xe9, 0x6d,
-      0x1c, 0x3d, 0xef, 0x24, 0x14, 0xec, 0x44, 0xaa, 0x22, 0x71, 0x10, 0x5f,
-      0x41, 0xdc, 0x5c, 0x4f, 0x90, 0xba, 0x1a, 0x22, 0x79, 0x36, 0x48, 0x22,
-      0x6e, 0x67, 0x23, 0xd4, 0xdb, 0x05, 0xef, 0xef, 0x2e, 0x10, 0x7a, 0x31,
-      0x49, 0x3c, 0x66, 0x67, 0x6b, 0xb3, 0x0f, 0x55, 0x91, 0x58, 0x5a, 0xe8,
-      0x44, 0xbb, 0x3b, 0x2e, 0xfe, 0xfe, 0xa8, 0x65, 0x0f, 0x09, 0x2c, 0x76,
-      0x2f, 0x45, 0xc2, 0x1e, 0xbe, 0x6b, 0x65, 0x00, 0xf1, 0x0b, 0xfb, 0x12,
-      0x21, 0x2e, 0x20, 0xdf, 0x1c, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45,
-      0x4e, 0x44, 0xae, 0x42, 0x60, 0x82,
-  };
-
-  {
-    wxMemoryInputStream sm(Bullet_yellow, sizeof(Bullet_yellow));
-    _img_Bullet_yellow = new wxBitmap(wxImage(sm));
-  }
 
 #ifdef PLUGIN_USE_SVG
   wxFileName fn;
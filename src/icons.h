@@ -31,11 +31,30 @@
 
 extern void initialize_images( void );
 
+/**
+ * A bitmap kept as its PNG data and decoded the first time it is used,
+ * so the images of a dialog never opened are never decoded.
+ */
+class LazyBitmap
+{
+public:
+    LazyBitmap( const unsigned char* data, size_t length )
+        : png( data ), size( length ), bitmap( NULL ) {}
+
+    const wxBitmap& operator*();
+    const wxBitmap* operator->() { return &**this; }
+
+private:
+    const unsigned char* png;
+    size_t    size;
+    wxBitmap* bitmap;
+};
+
 extern wxBitmap *_img_logbook_pi;
-extern wxBitmap *_img_logbook;
-extern const wxBitmap *_img_Bullet_green;
-extern const wxBitmap *_img_Bullet_red;
-extern const wxBitmap *_img_Bullet_yellow;
+extern LazyBitmap _img_logbook;
+extern LazyBitmap _img_Bullet_green;
+extern LazyBitmap _img_Bullet_red;
+extern LazyBitmap _img_Bullet_yellow;
 
 #ifdef PLUGIN_USE_SVG
 extern wxString _svg_logbookkonni;
@@ -32,6 +32,7 @@
 #include <wx/event.h>
 #include <wx/filefn.h>
 #include <wx/jsonreader.h>
+#include <wx/jsonsax.h>
 #include <wx/msgdlg.h>
 #include <wx/stdpaths.h>
 #include <wx/stdpaths.h>
@@ -39,9 +40,16 @@
 #include <wx/timer.h>
 #include <wx/wxprec.h>
 
+#include "Benchmark.h"
+#include "ConfigStore.h"
+#include "FleetOverview.h"
 #include "Logbook.h"
+#include "LogbookArchive.h"
 #include "LogbookDialog.h"
 #include "LogbookOptions.h"
+#include "LogbookQuery.h"
+#include "RequestRunner.h"
+#include "MessageRouter.h"
 #include "Options.h"
 #include "config.h"
 #include "icons.h"
@@ -75,15 +83,14 @@ logbookkonni_pi::logbookkonni_pi(void* ppimgr) : opencpn_plugin_116(ppimgr) {
   // Create the PlugIn icons
   initialize_images();
   opt = new Options();
-  m_timer = NULL;
+  timer = NULL;
+  router = NULL;
+  requests = NULL;
+  config = NULL;
   state = 0;
 }
 
 logbookkonni_pi::~logbookkonni_pi() {
-  if (m_timer != NULL && m_timer->IsRunning()) {
-    m_timer->Stop();
-    m_timer = NULL;
-  }
   if (opt != NULL) delete opt;
 }
 
@@ -103,8 +110,11 @@ int logbookkonni_pi::Init(void) {
   m_parent_window = GetOCPNCanvasWindow();
 
   m_pconfig = GetOCPNConfigObject();
+  config = new ConfigStore(m_pconfig, "/PlugIns/Logbook",
+                           [this]() { SaveConfig(); });
 
   LoadConfig();
+  config->load();
   if (m_bLOGShowIcon)
 
   // FOR SVG ICONS  - CMakeLists.txt line 72  PLUGIN_USE_SVG=ON
@@ -136,8 +146,11 @@ int logbookkonni_pi::Init(void) {
   wxMenu dummy_menu;
 
   timer = new LogbookTimer(this);
-  m_timer = new wxTimer(timer, ID_LOGTIMER);
-  timer->Connect(wxEVT_TIMER, wxObjectEventFunction(&LogbookTimer::OnTimer));
+
+  router = new MessageRouter();
+  requests = new RequestRunner();
+  registerMessages();
+  router->start();
 
   SendPluginMessage("LOGBOOK_READY_FOR_REQUESTS", "TRUE");
 
@@ -147,23 +160,31 @@ int logbookkonni_pi::Init(void) {
 }
 
 bool logbookkonni_pi::DeInit(void) {
+  // queued messages would start the logbook again, drop them first
+  if (router) {
+    router->stop();
+    delete router;
+    router = NULL;
+  }
+  // queries still reading the logbooks end, their replies are dropped
+  delete requests;
+  requests = NULL;
+  // the archive pass must not write into the data dir after unloading
+  LogbookArchive::stop();
   shutdown(false);
+  if (config) {
+    if (config->IsRunning()) config->commit();
+    delete config;
+    config = NULL;
+  }
   return true;
 }
 
 void logbookkonni_pi::shutdown(bool menu) {
   SendPluginMessage("LOGBOOK_READY_FOR_REQUESTS", "FALSE");
 
-  if (m_timer)
-    if (m_timer->IsRunning()) m_timer->Stop();
-  if (timer) {
-    timer->Disconnect(wxEVT_TIMER,
-                      wxObjectEventFunction(&LogbookTimer::OnTimer));
-    delete timer;
-  }
-
+  if (timer) delete timer;
   timer = NULL;
-  m_timer = NULL;
 
   if (m_plogbook_window != NULL) {
     if (m_plogbook_window->IsIconized()) m_plogbook_window->Iconize(false);
@@ -186,273 +207,403 @@ void logbookkonni_pi::shutdown(bool menu) {
   }
 }
 
+void logbookkonni_pi::registerMessages() {
+  using namespace std::placeholders;
+  typedef MessageRouter R;
+
+  router->add("OCPN_MAN_OVERBOARD", R::ASYNC,
+              bind(&logbookkonni_pi::onManOverboard, this, _1, _2), R::Filter(),
+              [](wxJSONValue& d) { return d.HasMember("GUID"); });
+  router->add("POLAR_SAVE_LOGBOOK", R::SYNC,
+              bind(&logbookkonni_pi::onPolarSave, this, _1, _2));
+  router->add("LOGBOOK_LOG_LASTLINE_REQUEST", R::SYNC,
+              bind(&logbookkonni_pi::onLastLineRequest, this, _1, _2));
+  router->add("LOGBOOK_LOG_RANGE_REQUEST", R::JSON,
+              bind(&logbookkonni_pi::onRangeRequest, this, _1, _2));
+  router->add("LOGBOOK_LOG_QUERY_REQUEST", R::JSON,
+              bind(&logbookkonni_pi::onQueryRequest, this, _1, _2));
+  router->add("LOGBOOK_INSTRUMENTS_RANGE_REQUEST", R::JSON,
+              bind(&logbookkonni_pi::onInstrumentsRangeRequest, this, _1, _2));
+  router->add("LOGBOOK_FLEET_REQUEST", R::JSON,
+              bind(&logbookkonni_pi::onFleetRequest, this, _1, _2));
+  router->add("LOGBOOK_IS_READY_FOR_REQUEST", R::SYNC,
+              bind(&logbookkonni_pi::onIsReadyRequest, this, _1, _2));
+  router->add("LOGBOOK_BUYPARTS_ADDLINE_REQUEST", R::ASYNC,
+              bind(&logbookkonni_pi::onBuyPartsAddLine, this, _1, _2),
+              R::Filter(), [](wxJSONValue& d) {
+                for (int i = 0; i < d.Size(); i++) {
+                  int p = d[i].Item("Priority").AsInt();
+                  if (p < 0 || p > 5) return false;
+                }
+                return true;
+              });
+  router->add("LOGBOOK_LOG_ADDLINE_REQUEST", R::ASYNC,
+              bind(&logbookkonni_pi::onLogAddLine, this, _1, _2));
+  router->add("OCPN_WPT_ARRIVED", R::ASYNC,
+              bind(&logbookkonni_pi::onWaypointArrived, this, _1, _2),
+              [this]() { return opt->waypointArrived && !eventsEnabled; });
+  router->add("OCPN_RTE_ENDED", R::ASYNC,
+              bind(&logbookkonni_pi::onRouteEnded, this, _1, _2),
+              [this]() { return opt->waypointArrived; });
+  router->add("OCPN_RTE_DEACTIVATED", R::ASYNC,
+              bind(&logbookkonni_pi::onRouteDeactivated, this, _1, _2));
+  router->add("OCPN_RTE_ACTIVATED", R::ASYNC,
+              bind(&logbookkonni_pi::onRouteActivated, this, _1, _2));
+  router->add("OCPN_TRK_ACTIVATED", R::ASYNC,
+              bind(&logbookkonni_pi::onTrackActivated, this, _1, _2));
+  router->add("OCPN_TRK_DEACTIVATED", R::ASYNC,
+              bind(&logbookkonni_pi::onTrackDeactivated, this, _1, _2));
+  router->add("OCPN_TRACKS_MERGED", R::ASYNC,
+              bind(&logbookkonni_pi::onTracksMerged, this, _1, _2));
+  // answers to our own requests while exporting, the exporter waits for them
+  router->add("OCPN_TRACKPOINTS_COORDS", R::SYNC,
+              bind(&logbookkonni_pi::onTrackPoint, this, _1, _2));
+  router->add("OCPN_ROUTE_RESPONSE", R::JSON,
+              bind(&logbookkonni_pi::onRouteResponse, this, _1, _2));
+  router->add("OCPN_ROUTELIST_RESPONSE", R::JSON,
+              bind(&logbookkonni_pi::onRouteListResponse, this, _1, _2));
+#ifdef PLUGIN_BENCHMARK
+  router->add("LOGBOOK_BENCHMARK_REQUEST", R::SYNC,
+              bind(&logbookkonni_pi::onBenchmarkRequest, this, _1, _2));
+#endif
+}
+
 void logbookkonni_pi::SetPluginMessage(wxString& message_id,
                                        wxString& message_body) {
-  if (message_id == "OCPN_MAN_OVERBOARD") {
-    wxJSONReader reader;
-    wxJSONValue data;
-    int numErrors = reader.Parse(message_body, &data);
-    if (numErrors != 0) return;
-
-    if (!m_plogbook_window) startLogbook();
-
-    m_plogbook_window->logbook->MOB_GUID = data.Item("GUID").AsString();
-    m_plogbook_window->logbook->MOBIsActive = true;
-
-    m_plogbook_window->logbook->appendRow(true, false);
-  } else if (message_id == "POLAR_SAVE_LOGBOOK") {
-    if (m_plogbook_window) m_plogbook_window->logbook->update();
-  } else if (message_id == "LOGBOOK_LOG_LASTLINE_REQUEST") {
-    if (!m_plogbook_window) startLogbook();
-
-    wxJSONValue key;
-    int tcol = 0;
-    int lastRow = m_plogbook_window->logGrids[0]->GetNumberRows() - 1;
-    for (unsigned int g = 0; g < LOGGRIDS; g++)
-      for (int col = 0; col < m_plogbook_window->logGrids[g]->GetNumberCols();
-           col++)
-        key[tcol++] =
-            m_plogbook_window->logGrids[g]->GetCellValue(lastRow, col);
-    wxJSONWriter w;
-    wxString out;
-    w.Write(key, out);
-    wxString id = "LOGBOOK_LOG_LASTLINE_RESPONSE";
-    SetPluginMessage(id, out);
-    return;
-  } else if (message_id == "LOGBOOK_IS_READY_FOR_REQUEST") {
-    SendPluginMessage("LOGBOOK_READY_FOR_REQUESTS", "TRUE");
-  } else if (message_id == "LOGBOOK_BUYPARTS_ADDLINE_REQUEST") {
-    wxJSONReader reader;
-    wxJSONValue data;
-    int priority, amount;
-    wxString category, title, unit, text, plugin;
-    wxString prText[6];
+  if (router) router->dispatch(message_id, message_body);
+}
 
-    int numErrors = reader.Parse(message_body, &data);
-    if (numErrors != 0) return;
+void logbookkonni_pi::onManOverboard(wxJSONValue& data, wxString& body) {
+  if (!m_plogbook_window) startLogbook();
 
-    if (!m_plogbook_window) startLogbook();
+  m_plogbook_window->logbook->MOB_GUID = data.Item("GUID").AsString();
+  m_plogbook_window->logbook->MOBIsActive = true;
 
-    m_plogbook_window->Show();
-    m_plogbook_window->m_logbook->SetSelection(4);    // Maintenance
-    m_plogbook_window->m_notebook6->SetSelection(2);  // BuyParts
-
-    for (int i = 0; i < data.Size(); i++) {
-      priority = data[i].Item("Priority").AsInt();
-      category = data[i].Item("Category").AsString();
-      title = _("from ");
-      plugin = data[i].Item("PluginName").AsString();
-      title += plugin + _("-Plugin");
-      amount = data[i].Item("Amount").AsInt();
-      unit = data[i].Item("Unit").AsString();
-      text = data[i].Item("Text").AsString();
-
-      prText[priority] += wxString::Format("%4i  %-15s %-30s\n", amount,
-                                           unit.c_str(), text.c_str());
-    }
+  m_plogbook_window->logbook->appendRow(true, false);
+}
 
-    if (plugin == "FindIt")
-      m_plogbook_window->maintenance->deleteFindItRow(category, plugin);
-
-    for (int i = 0; i < 6; i++) {
-      if (prText[i] != wxEmptyString) {
-        m_plogbook_window->maintenance->addLineBuyParts();
-
-        int lastRow =
-            m_plogbook_window->m_gridMaintenanceBuyParts->GetNumberRows() - 1;
-
-        m_plogbook_window->m_gridMaintenanceBuyParts->SetCellValue(
-            lastRow, 0, wxString::Format("%i", i));
-        m_plogbook_window->m_gridMaintenanceBuyParts->SetCellValue(lastRow, 1,
-                                                                   category);
-        m_plogbook_window->m_gridMaintenanceBuyParts->SetCellValue(lastRow, 2,
-                                                                   title);
-        m_plogbook_window->m_gridMaintenanceBuyParts->SetCellValue(
-            lastRow, 3, prText[i].RemoveLast());
-        m_plogbook_window->m_gridMaintenanceBuyParts->AutoSizeRow(lastRow,
-                                                                  false);
-      }
-    }
+void logbookkonni_pi::onPolarSave(wxJSONValue& data, wxString& body) {
+  if (m_plogbook_window) m_plogbook_window->logbook->update();
+}
 
-    m_plogbook_window->maintenance->checkBuyParts();
+void logbookkonni_pi::onLastLineRequest(wxJSONValue& data, wxString& body) {
+  if (!m_plogbook_window) startLogbook();
+
+  wxJSONValue key;
+  int tcol = 0;
+  int lastRow = m_plogbook_window->logGrids[0]->GetNumberRows() - 1;
+  for (unsigned int g = 0; g < LOGGRIDS; g++)
+    for (int col = 0; col < m_plogbook_window->logGrids[g]->GetNumberCols();
+         col++)
+      key[tcol++] = m_plogbook_window->logGrids[g]->GetCellValue(lastRow, col);
+  wxJSONWriter w;
+  wxString out;
+  w.Write(key, out);
+  wxString id = "LOGBOOK_LOG_LASTLINE_RESPONSE";
+  SetPluginMessage(id, out);
+}
 
-    return;
-  } else if (message_id == "LOGBOOK_LOG_ADDLINE_REQUEST") {
-    wxJSONReader reader;
-    wxJSONValue data;
-    int numErrors = reader.Parse(message_body, &data);
-    if (numErrors != 0) return;
+void logbookkonni_pi::onRangeRequest(wxJSONValue& data, wxString& body) {
+  if (!m_plogbook_window) startLogbook();
 
-    if (!m_plogbook_window) startLogbook();
+  LogbookQuery::range(requests, m_plogbook_window, data);
+}
 
-    m_plogbook_window->logbook->appendRow(true, true);
-    int lastRow = m_plogbook_window->m_gridGlobal->GetNumberRows() - 1;
+void logbookkonni_pi::onQueryRequest(wxJSONValue& data, wxString& body) {
+  if (!m_plogbook_window) startLogbook();
 
-    m_plogbook_window->m_gridGlobal->SetCellValue(
-        lastRow, 13, data.Item("Remarks").AsString());
-    m_plogbook_window->m_gridMotorSails->SetCellValue(
-        lastRow, 8, data.Item("MotorRemarks").AsString());
-    return;
-  } else if (message_id == "OCPN_WPT_ARRIVED") {
-    if (!opt->waypointArrived || eventsEnabled) return;
-
-    wxJSONReader reader;
-    wxJSONValue data;
-    int numErrors = reader.Parse(message_body, &data);
-    if (numErrors != 0) return;
-
-    if (!m_plogbook_window) startLogbook();
-
-    RMB rmb;
-    rmb.From = data.Item("WP_arrived").AsString();
-    rmb.To = lastWaypointInRoute = data.Item("Next_WP").AsString();
-    m_plogbook_window->logbook->WP_skipped = data.Item("isSkipped").AsBool();
-    m_plogbook_window->logbook->OCPN_Message = true;
-
-    m_plogbook_window->logbook->checkWayPoint(rmb);
-
-    m_plogbook_window->logbook->OCPN_Message = false;
-    m_plogbook_window->logbook->WP_skipped = false;
-  } else if (message_id == "OCPN_RTE_ENDED") {
-    if (!opt->waypointArrived) return;
-
-    wxJSONReader reader;
-    wxJSONValue data;
-    int numErrors = reader.Parse(message_body, &data);
-    if (numErrors != 0) return;
-
-    if (!m_plogbook_window) startLogbook();
-
-    RMB rmb;
-    rmb.From = lastWaypointInRoute;
-    rmb.To = "-1";
-    m_plogbook_window->logbook->WP_skipped = false;
-    m_plogbook_window->logbook->OCPN_Message = true;
-
-    m_plogbook_window->logbook->checkWayPoint(rmb);
-    m_plogbook_window->logbook->OCPN_Message = false;
-    lastWaypointInRoute = "-1";
-    m_plogbook_window->logbook->lastWayPoint = wxEmptyString;
-    m_plogbook_window->logbook->routeIsActive = false;
-  } else if (message_id == "OCPN_RTE_DEACTIVATED") {
-    wxJSONReader reader;
-    wxJSONValue data;
-    int numErrors = reader.Parse(message_body, &data);
-    if (numErrors != 0) return;
-
-    if (!m_plogbook_window) startLogbook();
-
-    m_plogbook_window->logbook->activeRoute = wxEmptyString;
-    m_plogbook_window->logbook->activeRouteGUID = wxEmptyString;
-    m_plogbook_window->logbook->routeIsActive = false;
-    if (!m_plogbook_window->logbook->activeMOB.IsEmpty())
-      m_plogbook_window->logbook->MOBIsActive = false;
-
-  } else if (message_id == "OCPN_RTE_ACTIVATED") {
-    wxJSONReader reader;
-    wxJSONValue data;
-    int numErrors = reader.Parse(message_body, &data);
-    if (numErrors != 0) return;
-
-    if (!m_plogbook_window) startLogbook();
-
-    m_plogbook_window->logbook->activeRoute =
-        data.Item("Route_activated").AsString();
-    m_plogbook_window->logbook->activeRouteGUID = data.Item("GUID").AsString();
-    m_plogbook_window->logbook->routeIsActive = true;
-  } else if (message_id == "OCPN_TRK_ACTIVATED") {
-    if (!m_plogbook_window) startLogbook();
-
-    wxJSONReader reader;
-    wxJSONValue data;
-    int numErrors = reader.Parse(message_body, &data);
-    if (numErrors != 0) return;
-
-    m_plogbook_window->logbook->activeTrack = data.Item("Name").AsString();
-    m_plogbook_window->logbook->activeTrackGUID = data.Item("GUID").AsString();
-    m_plogbook_window->logbook->trackIsActive = true;
-  } else if (message_id == "OCPN_TRK_DEACTIVATED") {
-    wxJSONReader reader;
-    wxJSONValue data;
-    int numErrors = reader.Parse(message_body, &data);
-    if (numErrors != 0) return;
-
-    if (!m_plogbook_window) startLogbook();
+  LogbookQuery::query(requests, m_plogbook_window, data);
+}
 
-    if (m_plogbook_window) {
-      m_plogbook_window->logbook->activeTrack = wxEmptyString;
-      m_plogbook_window->logbook->activeTrackGUID = wxEmptyString;
-      m_plogbook_window->logbook->trackIsActive = false;
-    }
+void logbookkonni_pi::onInstrumentsRangeRequest(wxJSONValue& data,
+                                                wxString& body) {
+  if (!m_plogbook_window) startLogbook();
 
-  } else if (message_id == "OCPN_TRACKPOINTS_COORDS") {
-    wxJSONReader reader;
-    wxJSONValue data;
-    int numErrors = reader.Parse(message_body, &data);
-    if (numErrors != 0) return;
-
-    bool error = data["error"].AsBool();
-
-    if (!error) {
-      double lat = data["lat"].AsDouble();
-      double lon = data["lon"].AsDouble();
-      int total = data["TotalNodes"].AsInt();
-      int i = data["NodeNr"].AsInt();
-      if (i == 1) {
-        wxString ph = m_plogbook_window->kmlPathHeader;
-        ph.Replace("#NAME#", "Trackline");
-        ph.Replace("#LINE#", "#LineTrack");
-        *m_plogbook_window->logbook->kmlFile << ph;
-      }
-      if (i <= total)
-        *m_plogbook_window->logbook->kmlFile
-            << wxString::Format("%f,%f\n", lon, lat);
-      if (i == total)
-        *m_plogbook_window->logbook->kmlFile
-            << m_plogbook_window->kmlPathFooter;
+  InstrumentRecorder* recorder =
+      m_plogbook_window->logbook->instrumentRecorder();
+  if (recorder) recorder->range(data);
+}
+
+void logbookkonni_pi::onFleetRequest(wxJSONValue& data, wxString& body) {
+  if (!m_plogbook_window) startLogbook();
+
+  // the boats asked for, else those configured, else this one
+  wxArrayString dirs;
+  if (data.HasMember("DataDirs"))
+    for (int i = 0; i < data["DataDirs"].Size(); i++)
+      dirs.Add(data["DataDirs"][i].AsString());
+  else
+    dirs = wxSplit(opt->fleetDirs, ';', '\0');
+  for (int i = (int)dirs.Count() - 1; i >= 0; i--)
+    if (dirs[i].Trim().Trim(false).IsEmpty()) dirs.RemoveAt(i);
+  if (dirs.IsEmpty()) dirs.Add(m_plogbook_window->data);
+
+  int drillDown = FleetOverview::NONE;
+  if (data.HasMember("Boat"))
+    drillDown = data["Boat"].IsString() && data["Boat"].AsString() == "All"
+                    ? (int)FleetOverview::ALL
+                    : data["Boat"].AsInt();
+
+  // this boat's logbook is read from the file, summaries of the other
+  // plugins' directories are kept in our own
+  Logbook* logbook = m_plogbook_window->logbook;
+  if (logbook->modified) logbook->update();
+  shared_ptr<wxJSONValue> id;
+  if (data.HasMember("Id"))
+    id.reset(new wxJSONValue(RequestRunner::unshared(data["Id"])));
+  wxString cache = StandardPath() + wxFileName::GetPathSeparator() + "fleet";
+
+  requests->run([dirs, drillDown, id, cache](RequestRunner::Send send,
+                                             RequestRunner::Stopping) {
+    wxJSONValue out = FleetOverview::fleet(dirs, drillDown, 0, cache);
+    if (id) out["Id"] = *id;
+
+    wxJSONWriter w(wxJSONWRITER_NONE);
+    wxString reply;
+    w.Write(out, reply);
+    send("LOGBOOK_FLEET_RESPONSE", reply);
+  });
+}
+
+void logbookkonni_pi::onIsReadyRequest(wxJSONValue& data, wxString& body) {
+  SendPluginMessage("LOGBOOK_READY_FOR_REQUESTS", "TRUE");
+}
+
+void logbookkonni_pi::onBuyPartsAddLine(wxJSONValue& data, wxString& body) {
+  int priority, amount;
+  wxString category, title, unit, text, plugin;
+  wxString prText[6];
+
+  if (!m_plogbook_window) startLogbook();
+
+  m_plogbook_window->Show();
+  m_plogbook_window->m_logbook->SetSelection(4);    // Maintenance
+  m_plogbook_window->m_notebook6->SetSelection(2);  // BuyParts
+
+  for (int i = 0; i < data.Size(); i++) {
+    priority = data[i].Item("Priority").AsInt();
+    category = data[i].Item("Category").AsString();
+    title = _("from ");
+    plugin = data[i].Item("PluginName").AsString();
+    title += plugin + _("-Plugin");
+    amount = data[i].Item("Amount").AsInt();
+    unit = data[i].Item("Unit").AsString();
+    text = data[i].Item("Text").AsString();
+
+    prText[priority] += wxString::Format("%4i  %-15s %-30s\n", amount,
+                                         unit.c_str(), text.c_str());
+  }
+
+  if (plugin == "FindIt")
+    m_plogbook_window->maintenance->deleteFindItRow(category, plugin);
+
+  for (int i = 0; i < 6; i++) {
+    if (prText[i] != wxEmptyString) {
+      m_plogbook_window->maintenance->addLineBuyParts();
+
+      int lastRow =
+          m_plogbook_window->m_gridMaintenanceBuyParts->GetNumberRows() - 1;
+
+      m_plogbook_window->m_gridMaintenanceBuyParts->SetCellValue(
+          lastRow, 0, wxString::Format("%i", i));
+      m_plogbook_window->m_gridMaintenanceBuyParts->SetCellValue(lastRow, 1,
+                                                                 category);
+      m_plogbook_window->m_gridMaintenanceBuyParts->SetCellValue(lastRow, 2,
+                                                                 title);
+      m_plogbook_window->m_gridMaintenanceBuyParts->SetCellValue(
+          lastRow, 3, prText[i].RemoveLast());
+      m_plogbook_window->m_gridMaintenanceBuyParts->AutoSizeRow(lastRow,
+                                                                false);
     }
-    //		m_plogbook_window->logbook->writeTrackToKML(data);
-  } else if (message_id == "OCPN_TRACKS_MERGED") {
-    if (!m_plogbook_window) startLogbook();
-
-    wxJSONReader reader;
-    wxJSONValue data;
-    int numErrors = reader.Parse(message_body, &data);
-    if (numErrors != 0) return;
-
-    unsigned int i = 1;
-    wxString target = data["targetTrack"].AsString();
-    while (true) {
-      if (data.HasMember("mergeTrack" + wxString::Format("%d", i)))
-        m_plogbook_window->logbook->mergeList.Add(
-            data["mergeTrack" + wxString::Format("%d", i++)].AsString());
-      else
-        break;
+  }
+
+  m_plogbook_window->maintenance->checkBuyParts();
+}
+
+void logbookkonni_pi::onLogAddLine(wxJSONValue& data, wxString& body) {
+  if (!m_plogbook_window) startLogbook();
+
+  m_plogbook_window->logbook->appendRow(true, true);
+  int lastRow = m_plogbook_window->m_gridGlobal->GetNumberRows() - 1;
+
+  m_plogbook_window->m_gridGlobal->SetCellValue(
+      lastRow, 13, data.Item("Remarks").AsString());
+  m_plogbook_window->m_gridMotorSails->SetCellValue(
+      lastRow, 8, data.Item("MotorRemarks").AsString());
+}
+
+void logbookkonni_pi::onWaypointArrived(wxJSONValue& data, wxString& body) {
+  if (!m_plogbook_window) startLogbook();
+
+  RMB rmb;
+  rmb.From = data.Item("WP_arrived").AsString();
+  rmb.To = lastWaypointInRoute = data.Item("Next_WP").AsString();
+  m_plogbook_window->logbook->WP_skipped = data.Item("isSkipped").AsBool();
+  m_plogbook_window->logbook->OCPN_Message = true;
+
+  m_plogbook_window->logbook->checkWayPoint(rmb);
+
+  m_plogbook_window->logbook->OCPN_Message = false;
+  m_plogbook_window->logbook->WP_skipped = false;
+}
+
+void logbookkonni_pi::onRouteEnded(wxJSONValue& data, wxString& body) {
+  if (!m_plogbook_window) startLogbook();
+
+  RMB rmb;
+  rmb.From = lastWaypointInRoute;
+  rmb.To = "-1";
+  m_plogbook_window->logbook->WP_skipped = false;
+  m_plogbook_window->logbook->OCPN_Message = true;
+
+  m_plogbook_window->logbook->checkWayPoint(rmb);
+  m_plogbook_window->logbook->OCPN_Message = false;
+  lastWaypointInRoute = "-1";
+  m_plogbook_window->logbook->lastWayPoint = wxEmptyString;
+  m_plogbook_window->logbook->routeIsActive = false;
+  m_plogbook_window->logbook->voyageEnded = true;
+}
+
+void logbookkonni_pi::onRouteDeactivated(wxJSONValue& data, wxString& body) {
+  if (!m_plogbook_window) startLogbook();
+
+  m_plogbook_window->logbook->activeRoute = wxEmptyString;
+  m_plogbook_window->logbook->activeRouteGUID = wxEmptyString;
+  m_plogbook_window->logbook->routeIsActive = false;
+  if (!m_plogbook_window->logbook->activeMOB.IsEmpty())
+    m_plogbook_window->logbook->MOBIsActive = false;
+}
+
+void logbookkonni_pi::onRouteActivated(wxJSONValue& data, wxString& body) {
+  if (!m_plogbook_window) startLogbook();
+
+  m_plogbook_window->logbook->activeRoute =
+      data.Item("Route_activated").AsString();
+  m_plogbook_window->logbook->activeRouteGUID = data.Item("GUID").AsString();
+  m_plogbook_window->logbook->routeIsActive = true;
+}
+
+void logbookkonni_pi::onTrackActivated(wxJSONValue& data, wxString& body) {
+  if (!m_plogbook_window) startLogbook();
+
+  m_plogbook_window->logbook->activeTrack = data.Item("Name").AsString();
+  m_plogbook_window->logbook->activeTrackGUID = data.Item("GUID").AsString();
+  m_plogbook_window->logbook->trackIsActive = true;
+}
+
+void logbookkonni_pi::onTrackDeactivated(wxJSONValue& data, wxString& body) {
+  if (!m_plogbook_window) startLogbook();
+
+  m_plogbook_window->logbook->activeTrack = wxEmptyString;
+  m_plogbook_window->logbook->activeTrackGUID = wxEmptyString;
+  m_plogbook_window->logbook->trackIsActive = false;
+}
+
+// One message per track point arrives while exporting KML, so the few
+// members are read straight from the body without building a wxJSONValue.
+class TrackPointReader : public wxJSONSaxHandler {
+ public:
+  TrackPointReader()
+      : lat(0), lon(0), total(0), nr(0), error(true), key(0), isError(false) {}
+
+  bool Key(const char* str, size_t len) {
+    wxString k = wxString::FromUTF8(str, len);
+    key = (k == "lat")          ? &lat
+          : (k == "lon")        ? &lon
+          : (k == "TotalNodes") ? &total
+          : (k == "NodeNr")     ? &nr
+                                : 0;
+    isError = (k == "error");
+    return true;
+  }
+  bool Double(double d) {
+    if (key) *key = d;
+    return true;
+  }
+  bool Bool(bool b) {
+    if (isError) error = b;
+    return true;
+  }
+
+  double lat, lon, total, nr;
+  bool error;
+
+ private:
+  double* key;
+  bool isError;
+};
+
+void logbookkonni_pi::onTrackPoint(wxJSONValue& data, wxString& body) {
+  TrackPointReader point;
+  wxJSONSaxReader reader;
+  if (!reader.Parse(body, point)) return;
+
+  if (!point.error) {
+    double lat = point.lat;
+    double lon = point.lon;
+    int total = (int)point.total;
+    int i = (int)point.nr;
+    if (i == 1) {
+      wxString ph = m_plogbook_window->kmlPathHeader;
+      ph.Replace("#NAME#", "Trackline");
+      ph.Replace("#LINE#", "#LineTrack");
+      *m_plogbook_window->logbook->kmlFile << ph;
     }
-    m_plogbook_window->logbook->setTrackToNewID(target);
-  } else if (message_id == "OCPN_ROUTE_RESPONSE") {
-    wxJSONReader reader;
-    wxJSONValue data;
-    int numErrors = reader.Parse(message_body, &data);
-    if (numErrors != 0) return;
-
-    bool error = data[0]["error"].AsBool();
-
-    if (!error) m_plogbook_window->logbook->writeRouteToKML(data);
-  } else if (message_id == "OCPN_ROUTELIST_RESPONSE") {
-    wxJSONReader reader;
-    wxJSONValue data;
-    int numErrors = reader.Parse(message_body, &data);
-    if (numErrors != 0) return;
-
-    m_plogbook_window->writeToRouteDlg(data);
+    if (i <= total)
+      *m_plogbook_window->logbook->kmlFile
+          << wxString::Format("%f,%f\n", lon, lat);
+    if (i == total)
+      *m_plogbook_window->logbook->kmlFile << m_plogbook_window->kmlPathFooter;
   }
 }
 
+void logbookkonni_pi::onTracksMerged(wxJSONValue& data, wxString& body) {
+  if (!m_plogbook_window) startLogbook();
+
+  unsigned int i = 1;
+  wxString target = data["targetTrack"].AsString();
+  while (true) {
+    if (data.HasMember("mergeTrack" + wxString::Format("%d", i)))
+      m_plogbook_window->logbook->mergeList.Add(
+          data["mergeTrack" + wxString::Format("%d", i++)].AsString());
+    else
+      break;
+  }
+  m_plogbook_window->logbook->setTrackToNewID(target);
+}
+
+void logbookkonni_pi::onRouteResponse(wxJSONValue& data, wxString& body) {
+  bool error = data[0]["error"].AsBool();
+
+  if (!error) m_plogbook_window->logbook->writeRouteToKML(data);
+}
+
+void logbookkonni_pi::onRouteListResponse(wxJSONValue& data, wxString& body) {
+  m_plogbook_window->writeToRouteDlg(data);
+}
+
+#ifdef PLUGIN_BENCHMARK
+void logbookkonni_pi::onBenchmarkRequest(wxJSONValue& data, wxString& body) {
+  wxJSONReader reader;
+  wxJSONValue request;
+  if (!body.IsEmpty() && reader.Parse(body, &request) != 0) return;
+
+  if (!m_plogbook_window) startLogbook();
+
+  LogbookBenchmark bench(m_plogbook_window);
+  wxJSONValue result = bench.run(request);
+
+  wxJSONWriter w;
+  wxString out;
+  w.Write(result, out);
+  SendPluginMessage("LOGBOOK_BENCHMARK_RESPONSE", out);
+}
+#endif
+
 void logbookkonni_pi::startLogbook() {
   if (!m_plogbook_window) {
     m_plogbook_window = new LogbookDialog(
-        this, m_timer, timer, m_parent_window, wxID_ANY, _("Active Logbook"),
+        this, timer, m_parent_window, wxID_ANY, _("Active Logbook"),
         wxDefaultPosition, wxSize(opt->dlgWidth, opt->dlgHeight),
         wxDEFAULT_DIALOG_STYLE | wxMAXIMIZE_BOX | wxMINIMIZE_BOX |
             wxRESIZE_BORDER);
@@ -737,7 +888,7 @@ void logbookkonni_pi::ShowPreferencesDialog(wxWindow* parent) {
       else
         RemovePlugInTool(m_leftclick_tool_id);
     }
-    SaveConfig();
+    config->schedule();
   }
 }
 
@@ -751,14 +902,9 @@ void logbookkonni_pi::OnToolbarToolCallback(int id) {
   dlgShow = !dlgShow;
   // show the Logbook dialog
   if (NULL == m_plogbook_window) {
-    if (m_timer == NULL) {
-      if (timer == NULL) timer = new LogbookTimer(this);
-      m_timer = new wxTimer(timer, ID_LOGTIMER);
-      timer->Connect(wxEVT_TIMER,
-                     wxObjectEventFunction(&LogbookTimer::OnTimer));
-    }
+    if (timer == NULL) timer = new LogbookTimer(this);
     m_plogbook_window = new LogbookDialog(
-        this, m_timer, timer, m_parent_window, wxID_ANY, _("Active Logbook"),
+        this, timer, m_parent_window, wxID_ANY, _("Active Logbook"),
         wxDefaultPosition, wxSize(opt->dlgWidth, opt->dlgHeight),
         wxDEFAULT_DIALOG_STYLE | wxMAXIMIZE_BOX | wxMINIMIZE_BOX |
             wxRESIZE_BORDER);
@@ -772,6 +918,7 @@ void logbookkonni_pi::OnToolbarToolCallback(int id) {
       m_plogbook_window->Show(true);
       dlgShow = true;
     } else {
+      if (!dlgShow) m_plogbook_window->logbook->trimWindow();
       m_plogbook_window->Show(dlgShow);
     }
   }
@@ -795,176 +942,200 @@ void logbookkonni_pi::OnToolbarToolCallback(int id) {
   // SetToolbarItemState( m_leftclick_tool_id, dlgShow );
 }
 
-void logbookkonni_pi::SaveConfig() {
-  wxFileConfig* pConf = (wxFileConfig*)m_pconfig;
+// the grids whose column widths are kept, by their name in the config
+static const struct {
+  const char* name;
+  ArrayOfGridColWidth Options::*cols;
+} colRecords[] = {{"Nav", &Options::NavColWidth},
+                  {"Weather", &Options::WeatherColWidth},
+                  {"Motor", &Options::MotorColWidth},
+                  {"Crew", &Options::CrewColWidth},
+                  {"Wake", &Options::WakeColWidth},
+                  {"Equip", &Options::EquipColWidth},
+                  {"Overview", &Options::OverviewColWidth},
+                  {"Service", &Options::ServiceColWidth},
+                  {"Repairs", &Options::RepairsColWidth},
+                  {"BuyParts", &Options::BuyPartsColWidth}};
 
-  if (pConf) {
-    pConf->SetPath(_T ( "/PlugIns/Logbook" ));
-    pConf->Write("ShowLOGIcon", m_bLOGShowIcon);
-    pConf->Write("Traditional", opt->traditional);
-    pConf->Write("ToolTips", opt->showToolTips);
+void logbookkonni_pi::SaveConfig() {
+  // only the keys that changed reach the config
+  if (config) {
+    config->write("ShowLOGIcon", m_bLOGShowIcon);
+    config->write("Traditional", opt->traditional);
+    config->write("ToolTips", opt->showToolTips);
 
-    pConf->Write(_T ( "FirstTime" ), opt->firstTime);
+    config->write(_T ( "FirstTime" ), opt->firstTime);
     if (m_plogbook_window) {
-      pConf->Write("DlgWidth", m_plogbook_window->GetSize().GetX());
-      pConf->Write("DlgHeight", m_plogbook_window->GetSize().GetY());
+      config->write("DlgWidth", m_plogbook_window->GetSize().GetX());
+      config->write("DlgHeight", m_plogbook_window->GetSize().GetY());
     }
 
-    pConf->Write(_T ( "Popup" ), opt->popup);
-    pConf->Write(_T ( "AutoStartTimer" ), opt->autostarttimer);
-    pConf->Write(_T ( "DateFormat" ), opt->dateformat);
-    pConf->Write(_T ( "DateSepIndiv" ), opt->dateseparatorindiv);
-    pConf->Write(_T ( "DateSepLocale" ), opt->dateseparatorlocale);
-    pConf->Write(_T ( "Date1" ), opt->date1);
-    pConf->Write(_T ( "Date2" ), opt->date2);
-    pConf->Write(_T ( "Date3" ), opt->date3);
-    pConf->Write(_T ( "NoEngines" ), opt->engines);
-
-    pConf->Write(_T ( "TimeFormat" ), opt->timeformat);
-    pConf->Write(_T ( "NoSeconds" ), opt->noseconds);
-
-    pConf->Write(_T ( "GuardChange" ), opt->guardChange);
-    pConf->Write(_T ( "GuardChangeText" ), opt->guardChangeText);
-    pConf->Write(_T ( "WaypointArrived" ), opt->waypointArrived);
-    pConf->Write(_T ( "WayPointText" ), opt->waypointText);
-    pConf->Write(_T ( "CourseChange" ), opt->courseChange);
-    pConf->Write(_T ( "CouseChangeDegrees" ), opt->courseChangeDegrees);
-    pConf->Write(_T ( "CouseChangeAfter" ), opt->courseTextAfterMinutes);
-    pConf->Write(_T ( "CourseChangeText" ), opt->courseChangeText);
-    pConf->Write(_T ( "EverySM" ), opt->everySM);
-    pConf->Write(_T ( "EverySMAmount" ), opt->everySMAmount);
-    pConf->Write(_T ( "everySMText" ), opt->everySMText);
-
-    pConf->Write(_T ( "Timer" ), opt->timer);
-    pConf->Write(_T ( "TimerType" ), opt->timerType);
-    pConf->Write(_T ( "Local" ), opt->local);
-    pConf->Write(_T ( "UTC" ), opt->UTC);
-    pConf->Write(_T ( "GPSAuto" ), opt->gpsAuto);
-    pConf->Write(_T ( "TzIndicator" ), opt->tzIndicator);
-    pConf->Write(_T ( "TzHours" ), opt->tzHour);
-    pConf->Write(_T ( "TimerHours" ), opt->thour);
-    pConf->Write(_T ( "TimerMin" ), opt->tmin);
-    pConf->Write(_T ( "TimerSec" ), opt->tsec);
-    pConf->Write(_T ( "TimerText" ), opt->ttext);
-
-    pConf->Write(_T ( "NavDegrees" ), opt->Deg);
-    pConf->Write(_T ( "NavMin" ), opt->Min);
-    pConf->Write(_T ( "NavSec" ), opt->Sec);
-    pConf->Write(_T ( "ShowDistance" ), opt->showDistance);
-    pConf->Write(_T ("ShowDistanceInd"), opt->showDistanceChoice);
-    pConf->Write(_T ("ShowBoatSpeedInd"), opt->showBoatSpeedchoice);
-    pConf->Write(_T ( "showBoatSpeed" ), opt->showBoatSpeed);
-    pConf->Write(_T ( "NavMeter" ), opt->meter);
-    pConf->Write(_T ( "NavFeet" ), opt->feet);
-    pConf->Write(_T ( "NavFathom" ), opt->fathom);
-
-    pConf->Write(_T ( "Baro" ), opt->baro);
-    pConf->Write(_T ( "Temperature" ), opt->temperature);
-
-    pConf->Write(_T ( "Vol" ), opt->vol);
-    pConf->Write(_T ( "Motorhours" ), opt->motorh);
-    pConf->Write(_T ( "Engine" ), opt->engine);
-    pConf->Write(_T ( "Shaft" ), opt->shaft);
-    pConf->Write(_T ( "RPM" ), opt->rpm);
-
-    pConf->Write(_T ( "Days" ), opt->days);
-    pConf->Write(_T ( "Weeks" ), opt->weeks);
-    pConf->Write(_T ( "Month" ), opt->month);
-
-    pConf->Write(_T ( "Watermaker" ), opt->watermaker);
-    pConf->Write(_T ( "FuelTank" ), opt->fuelTank);
-    pConf->Write(_T ( "WaterTank" ), opt->waterTank);
-    pConf->Write(_T ( "Ampere" ), opt->ampere);
-    pConf->Write(_T ( "Bank1" ), opt->bank1);
-    pConf->Write(_T ( "Bank2" ), opt->bank2);
-
-    pConf->Write(_T ( "ShowDepth" ), opt->showDepth);
-    pConf->Write(_T ( "ShowWaveSwell" ), opt->showWaveSwell);
-    pConf->Write(_T ( "ShowWindSpeedInd" ), opt->showWindSpeedchoice);
-    pConf->Write(_T ( "ShowWindSpeed" ), opt->showWindSpeed);
-    pConf->Write(_T ( "ShowWindDir" ), opt->showWindDir);
-    pConf->Write(_T ( "ShowHeading" ), opt->showHeading);
-    pConf->Write(_T ( "ShowWindHeading" ), opt->showWindHeading);
-
-    pConf->Write(_T ( "NavHTML" ), opt->navHTML);
-    pConf->Write(_T ( "CrewHTML" ), opt->crewHTML);
-    pConf->Write(_T ( "BoatHTML" ), opt->boatHTML);
-    pConf->Write(_T ( "overviewHTML" ), opt->overviewHTML);
-    pConf->Write(_T ( "serviceHTML" ), opt->serviceHTML);
-    pConf->Write(_T ( "repairsHTML" ), opt->repairsHTML);
-    pConf->Write(_T ( "buypartsHTML" ), opt->buypartsHTML);
-    pConf->Write(_T ( "OverViewAll" ), opt->overviewAll);
-
-    pConf->Write(_T ( "NavGridLayout" ), opt->navGridLayoutChoice);
-    pConf->Write(_T ( "CrewGridLayout" ), opt->crewGridLayoutChoice);
-    pConf->Write(_T ( "BoatGridLayout" ), opt->boatGridLayoutChoice);
-    pConf->Write(_T ( "overviewGridLayout" ), opt->overviewGridLayoutChoice);
-    pConf->Write(_T ( "serviceGridLayout" ), opt->serviceGridLayoutChoice);
-    pConf->Write(_T ( "repairsGridLayout" ), opt->repairsGridLayoutChoice);
-    pConf->Write(_T ( "buypartsGridLayout" ), opt->buypartsGridLayoutChoice);
-
-    pConf->Write(_T ( "NavGridLayoutODT" ), opt->navGridLayoutChoiceODT);
-    pConf->Write(_T ( "CrewGridLayoutODT" ), opt->crewGridLayoutChoiceODT);
-    pConf->Write(_T ( "BoatGridLayoutODT" ), opt->boatGridLayoutChoiceODT);
-    pConf->Write(_T ( "overviewGridLayoutODT" ),
+    config->write(_T ( "Popup" ), opt->popup);
+    config->write(_T ( "InstrumentRecorder" ), opt->instrumentRecorder);
+    config->write(_T ( "Rollover" ), opt->rollover);
+    config->write(_T ( "RolloverRows" ), opt->rolloverRows);
+    config->write(_T ( "RolloverSize" ), opt->rolloverSize);
+    config->write(_T ( "SealArchives" ), opt->sealArchives);
+    config->write(_T ( "LowMemory" ), opt->lowMemory);
+    config->write(_T ( "MemoryBudget" ), opt->memoryBudget);
+    config->write(_T ( "FleetDirs" ), opt->fleetDirs);
+    config->write(_T ( "NMEAPriority" ), opt->nmeaPriority);
+    config->write(_T ( "NMEAFailover" ), opt->nmeaFailover);
+    config->write(_T ( "XDRChannels" ), opt->xdrChannels);
+    config->write(_T ( "AutoStartTimer" ), opt->autostarttimer);
+    config->write(_T ( "DateFormat" ), opt->dateformat);
+    config->write(_T ( "DateSepIndiv" ), opt->dateseparatorindiv);
+    config->write(_T ( "DateSepLocale" ), opt->dateseparatorlocale);
+    config->write(_T ( "Date1" ), opt->date1);
+    config->write(_T ( "Date2" ), opt->date2);
+    config->write(_T ( "Date3" ), opt->date3);
+    config->write(_T ( "NoEngines" ), opt->engines);
+
+    config->write(_T ( "TimeFormat" ), opt->timeformat);
+    config->write(_T ( "NoSeconds" ), opt->noseconds);
+
+    config->write(_T ( "GuardChange" ), opt->guardChange);
+    config->write(_T ( "GuardChangeText" ), opt->guardChangeText);
+    config->write(_T ( "WaypointArrived" ), opt->waypointArrived);
+    config->write(_T ( "WayPointText" ), opt->waypointText);
+    config->write(_T ( "CourseChange" ), opt->courseChange);
+    config->write(_T ( "CouseChangeDegrees" ), opt->courseChangeDegrees);
+    config->write(_T ( "CouseChangeAfter" ), opt->courseTextAfterMinutes);
+    config->write(_T ( "CourseChangeText" ), opt->courseChangeText);
+    config->write(_T ( "EverySM" ), opt->everySM);
+    config->write(_T ( "EverySMAmount" ), opt->everySMAmount);
+    config->write(_T ( "everySMText" ), opt->everySMText);
+
+    config->write(_T ( "Timer" ), opt->timer);
+    config->write(_T ( "TimerType" ), opt->timerType);
+    config->write(_T ( "Local" ), opt->local);
+    config->write(_T ( "UTC" ), opt->UTC);
+    config->write(_T ( "GPSAuto" ), opt->gpsAuto);
+    config->write(_T ( "TzIndicator" ), opt->tzIndicator);
+    config->write(_T ( "TzHours" ), opt->tzHour);
+    config->write(_T ( "TimerHours" ), opt->thour);
+    config->write(_T ( "TimerMin" ), opt->tmin);
+    config->write(_T ( "TimerSec" ), opt->tsec);
+    config->write(_T ( "TimerText" ), opt->ttext);
+
+    config->write(_T ( "NavDegrees" ), opt->Deg);
+    config->write(_T ( "NavMin" ), opt->Min);
+    config->write(_T ( "NavSec" ), opt->Sec);
+    config->write(_T ( "ShowDistance" ), opt->showDistance);
+    config->write(_T ("ShowDistanceInd"), opt->showDistanceChoice);
+    config->write(_T ("ShowBoatSpeedInd"), opt->showBoatSpeedchoice);
+    config->write(_T ( "showBoatSpeed" ), opt->showBoatSpeed);
+    config->write(_T ( "NavMeter" ), opt->meter);
+    config->write(_T ( "NavFeet" ), opt->feet);
+    config->write(_T ( "NavFathom" ), opt->fathom);
+
+    config->write(_T ( "Baro" ), opt->baro);
+    config->write(_T ( "Temperature" ), opt->temperature);
+
+    config->write(_T ( "Vol" ), opt->vol);
+    config->write(_T ( "Motorhours" ), opt->motorh);
+    config->write(_T ( "Engine" ), opt->engine);
+    config->write(_T ( "Shaft" ), opt->shaft);
+    config->write(_T ( "RPM" ), opt->rpm);
+
+    config->write(_T ( "Days" ), opt->days);
+    config->write(_T ( "Weeks" ), opt->weeks);
+    config->write(_T ( "Month" ), opt->month);
+
+    config->write(_T ( "Watermaker" ), opt->watermaker);
+    config->write(_T ( "FuelTank" ), opt->fuelTank);
+    config->write(_T ( "WaterTank" ), opt->waterTank);
+    config->write(_T ( "Ampere" ), opt->ampere);
+    config->write(_T ( "Bank1" ), opt->bank1);
+    config->write(_T ( "Bank2" ), opt->bank2);
+
+    config->write(_T ( "ShowDepth" ), opt->showDepth);
+    config->write(_T ( "ShowWaveSwell" ), opt->showWaveSwell);
+    config->write(_T ( "ShowWindSpeedInd" ), opt->showWindSpeedchoice);
+    config->write(_T ( "ShowWindSpeed" ), opt->showWindSpeed);
+    config->write(_T ( "ShowWindDir" ), opt->showWindDir);
+    config->write(_T ( "ShowHeading" ), opt->showHeading);
+    config->write(_T ( "ShowWindHeading" ), opt->showWindHeading);
+
+    config->write(_T ( "NavHTML" ), opt->navHTML);
+    config->write(_T ( "CrewHTML" ), opt->crewHTML);
+    config->write(_T ( "BoatHTML" ), opt->boatHTML);
+    config->write(_T ( "overviewHTML" ), opt->overviewHTML);
+    config->write(_T ( "serviceHTML" ), opt->serviceHTML);
+    config->write(_T ( "repairsHTML" ), opt->repairsHTML);
+    config->write(_T ( "buypartsHTML" ), opt->buypartsHTML);
+    config->write(_T ( "OverViewAll" ), opt->overviewAll);
+
+    config->write(_T ( "NavGridLayout" ), opt->navGridLayoutChoice);
+    config->write(_T ( "CrewGridLayout" ), opt->crewGridLayoutChoice);
+    config->write(_T ( "BoatGridLayout" ), opt->boatGridLayoutChoice);
+    config->write(_T ( "overviewGridLayout" ), opt->overviewGridLayoutChoice);
+    config->write(_T ( "serviceGridLayout" ), opt->serviceGridLayoutChoice);
+    config->write(_T ( "repairsGridLayout" ), opt->repairsGridLayoutChoice);
+    config->write(_T ( "buypartsGridLayout" ), opt->buypartsGridLayoutChoice);
+
+    config->write(_T ( "NavGridLayoutODT" ), opt->navGridLayoutChoiceODT);
+    config->write(_T ( "CrewGridLayoutODT" ), opt->crewGridLayoutChoiceODT);
+    config->write(_T ( "BoatGridLayoutODT" ), opt->boatGridLayoutChoiceODT);
+    config->write(_T ( "overviewGridLayoutODT" ),
                  opt->overviewGridLayoutChoiceODT);
-    pConf->Write(_T ( "serviceGridLayoutODT" ),
+    config->write(_T ( "serviceGridLayoutODT" ),
                  opt->serviceGridLayoutChoiceODT);
-    pConf->Write(_T ( "repairsGridLayoutODT" ),
+    config->write(_T ( "repairsGridLayoutODT" ),
                  opt->repairsGridLayoutChoiceODT);
-    pConf->Write(_T ( "buypartsGridLayoutODT" ),
+    config->write(_T ( "buypartsGridLayoutODT" ),
                  opt->buypartsGridLayoutChoiceODT);
 
-    pConf->Write(_T ( "HTMLEditor" ), opt->htmlEditor);
-    pConf->Write(_T ( "ODTEditor" ), opt->odtEditor);
-    pConf->Write(_T ( "DataManager" ), opt->dataManager);
-    pConf->Write(_T ( "MailClient" ), opt->mailClient);
+    config->write(_T ( "HTMLEditor" ), opt->htmlEditor);
+    config->write(_T ( "ODTEditor" ), opt->odtEditor);
+    config->write(_T ( "DataManager" ), opt->dataManager);
+    config->write(_T ( "MailClient" ), opt->mailClient);
 
-    pConf->Write(_T ( "GPSWarning" ), opt->noGPS);
-    pConf->Write(_T ( "EngineMessageSails" ), opt->engineMessageSails);
-    pConf->Write(_T ( "WriteEngineRun" ), opt->engineMessageRunning);
-    pConf->Write(_T ( "SailsDown" ), opt->engineAllwaysSailsDown);
-    pConf->Write(_T ( "StatusBar" ), opt->statusbar);
-    pConf->Write(_T ( "WindSpeeds" ), opt->windspeeds);
-    pConf->Write(_T ( "OverviewLines" ), opt->overviewlines);
+    config->write(_T ( "GPSWarning" ), opt->noGPS);
+    config->write(_T ( "EngineMessageSails" ), opt->engineMessageSails);
+    config->write(_T ( "WriteEngineRun" ), opt->engineMessageRunning);
+    config->write(_T ( "SailsDown" ), opt->engineAllwaysSailsDown);
+    config->write(_T ( "StatusBar" ), opt->statusbar);
+    config->write(_T ( "WindSpeeds" ), opt->windspeeds);
+    config->write(_T ( "OverviewLines" ), opt->overviewlines);
 
     wxString str = wxEmptyString;
     for (int i = 0; i < 7; i++)
       str += wxString::Format("%i,%s,", opt->filterLayout[i],
                               opt->layoutPrefix[i].c_str());
     str.RemoveLast();
-    pConf->Write(_T ( "PrefixLayouts" ), str);
+    config->write(_T ( "PrefixLayouts" ), str);
 
     wxString kmlRouteTrack =
         wxString::Format("%i,%i", opt->kmlRoute, opt->kmlTrack);
-    pConf->Write(_T ( "KMLRouteTrack" ), kmlRouteTrack);
-    pConf->Write(_T ( "KMLWidth" ), opt->kmlLineWidth);
-    pConf->Write(_T ( "KMLTransp" ), opt->kmlLineTransparancy);
-    pConf->Write(_T ( "KMLRouteColor" ), opt->kmlRouteColor);
-    pConf->Write(_T ( "KMLTrackColor" ), opt->kmlTrackColor);
+    config->write(_T ( "KMLRouteTrack" ), kmlRouteTrack);
+    config->write(_T ( "KMLWidth" ), opt->kmlLineWidth);
+    config->write(_T ( "KMLTransp" ), opt->kmlLineTransparancy);
+    config->write(_T ( "KMLRouteColor" ), opt->kmlRouteColor);
+    config->write(_T ( "KMLTrackColor" ), opt->kmlTrackColor);
 
-    pConf->Write(_T ( "RPMIsChecked" ), opt->bRPMIsChecked);
-    pConf->Write(_T ( "Eng1RPMIsChecked" ), opt->bEng1RPMIsChecked);
-    pConf->Write(_T ( "Eng2RPMIsChecked" ), opt->bEng2RPMIsChecked);
-    pConf->Write(_T ( "GenRPMIsChecked" ), opt->bGenRPMIsChecked);
+    config->write(_T ( "RPMIsChecked" ), opt->bRPMIsChecked);
+    config->write(_T ( "Eng1RPMIsChecked" ), opt->bEng1RPMIsChecked);
+    config->write(_T ( "Eng2RPMIsChecked" ), opt->bEng2RPMIsChecked);
+    config->write(_T ( "GenRPMIsChecked" ), opt->bGenRPMIsChecked);
 
-    pConf->Write(_T ( "NMEAUseRPM" ), opt->NMEAUseERRPM);
-    pConf->Write(_T ( "Engine1" ), opt->engine1Id);
-    pConf->Write(_T ( "Engine2" ), opt->engine2Id);
-    pConf->Write(_T ( "Engine1Runs" ), opt->engine1Running);
-    pConf->Write(_T ( "Engine2Runs" ), opt->engine2Running);
+    config->write(_T ( "NMEAUseRPM" ), opt->NMEAUseERRPM);
+    config->write(_T ( "Engine1" ), opt->engine1Id);
+    config->write(_T ( "Engine2" ), opt->engine2Id);
+    config->write(_T ( "Engine1Runs" ), opt->engine1Running);
+    config->write(_T ( "Engine2Runs" ), opt->engine2Running);
 
-    pConf->Write(_T ( "Generator" ), opt->generator);
-    pConf->Write(_T ( "GeneratorId" ), opt->generatorId);
+    config->write(_T ( "Generator" ), opt->generator);
+    config->write(_T ( "GeneratorId" ), opt->generatorId);
 
-    pConf->Write(_T ( "GeneratorRuns" ), opt->generatorRunning);
+    config->write(_T ( "GeneratorRuns" ), opt->generatorRunning);
 
-    pConf->Write(_T ( "ShowLayoutP" ), opt->layoutShow);
+    config->write(_T ( "ShowLayoutP" ), opt->layoutShow);
 
-    pConf->Write(_T ( "toggleEngine1" ), opt->toggleEngine1);
-    pConf->Write(_T ( "toggleEngine2" ), opt->toggleEngine2);
-    pConf->Write(_T ( "toggleGenerator" ), opt->toggleGenerator);
-    pConf->Write(_T ( "numberofSails" ), opt->numberSails);
+    config->write(_T ( "toggleEngine1" ), opt->toggleEngine1);
+    config->write(_T ( "toggleEngine2" ), opt->toggleEngine2);
+    config->write(_T ( "toggleGenerator" ), opt->toggleGenerator);
+    config->write(_T ( "numberofSails" ), opt->numberSails);
 
     wxString sails = wxEmptyString;
     sails = wxString::Format("%i,%i,", opt->rowGap, opt->colGap);
@@ -973,49 +1144,46 @@ void logbookkonni_pi::SaveConfig() {
                                 opt->sailsName.Item(i).c_str(),
                                 opt->bSailIsChecked[i]);
     sails.RemoveLast();
-    pConf->Write(_T ( "Sails" ), sails);
+    config->write(_T ( "Sails" ), sails);
 
     if (opt->dtEngine1On.IsValid())
-      pConf->Write(_T ( "Engine1TimeStart" ),
+      config->write(_T ( "Engine1TimeStart" ),
                    opt->dtEngine1On.FormatISODate() + " " +
                        opt->dtEngine1On.FormatISOTime());
     else
-      pConf->Write(_T ( "Engine1TimeStart" ), wxEmptyString);
+      config->write(_T ( "Engine1TimeStart" ), wxEmptyString);
 
     if (opt->dtEngine2On.IsValid())
-      pConf->Write(_T ( "Engine2TimeStart" ),
+      config->write(_T ( "Engine2TimeStart" ),
                    opt->dtEngine2On.FormatISODate() + " " +
                        opt->dtEngine2On.FormatISOTime());
     else
-      pConf->Write(_T ( "Engine2TimeStart" ), wxEmptyString);
+      config->write(_T ( "Engine2TimeStart" ), wxEmptyString);
 
     if (opt->dtGeneratorOn.IsValid())
-      pConf->Write(_T ( "GeneratorTimeStart" ),
+      config->write(_T ( "GeneratorTimeStart" ),
                    opt->dtGeneratorOn.FormatISODate() + " " +
                        opt->dtGeneratorOn.FormatISOTime());
     else
-      pConf->Write(_T ( "GeneratorTimeStart" ), wxEmptyString);
-
-    writeCols(pConf, opt->NavColWidth, "NavGridColWidth");
-    writeCols(pConf, opt->WeatherColWidth, "WeatherGridColWidth");
-    writeCols(pConf, opt->MotorColWidth, "MotorGridColWidth");
-    writeCols(pConf, opt->CrewColWidth, "CrewGridColWidth");
-    writeCols(pConf, opt->WakeColWidth, "WakeGridColWidth");
-    writeCols(pConf, opt->EquipColWidth, "EquipGridColWidth");
-    writeCols(pConf, opt->OverviewColWidth, "OverviewGridColWidth");
-    writeCols(pConf, opt->ServiceColWidth, "ServiceGridColWidth");
-    writeCols(pConf, opt->RepairsColWidth, "RepairsGridColWidth");
-    writeCols(pConf, opt->BuyPartsColWidth, "BuyPartsGridColWidth");
+      config->write(_T ( "GeneratorTimeStart" ), wxEmptyString);
+
+    config->write(_T ( "GridColWidths" ), writeCols());
   }
 }
 
-void logbookkonni_pi::writeCols(wxFileConfig* pConf, ArrayOfGridColWidth ar,
-                                wxString entry) {
+// all grids in one entry: "Nav=80,120,...;Weather=...;..."
+wxString logbookkonni_pi::writeCols() {
   wxString str = wxEmptyString;
-  for (unsigned int i = 0; i < ar.Count(); i++)
-    str += wxString::Format("%i,", ar[i]);
+  for (size_t g = 0; g < WXSIZEOF(colRecords); g++) {
+    const ArrayOfGridColWidth& ar = opt->*colRecords[g].cols;
+    str += wxString(colRecords[g].name) + "=";
+    for (unsigned int i = 0; i < ar.Count(); i++)
+      str += wxString::Format("%i,", ar[i]);
+    if (ar.Count()) str.RemoveLast();
+    str += ";";
+  }
   str.RemoveLast();
-  pConf->Write(entry, str);
+  return str;
 }
 
 void logbookkonni_pi::LoadConfig() {
@@ -1036,6 +1204,17 @@ void logbookkonni_pi::LoadConfig() {
 #endif
     pConf->Read("DlgHeight", &opt->dlgHeight, 535);
     pConf->Read("Popup", &opt->popup, true);
+    pConf->Read("InstrumentRecorder", &opt->instrumentRecorder, false);
+    pConf->Read("Rollover", &opt->rollover, 0);
+    pConf->Read("RolloverRows", &opt->rolloverRows, 500);
+    pConf->Read("RolloverSize", &opt->rolloverSize, 256);
+    pConf->Read("SealArchives", &opt->sealArchives, false);
+    pConf->Read("LowMemory", &opt->lowMemory, opt->lowMemory);
+    pConf->Read("MemoryBudget", &opt->memoryBudget, 2048);
+    pConf->Read("FleetDirs", &opt->fleetDirs, wxEmptyString);
+    pConf->Read("NMEAPriority", &opt->nmeaPriority, wxEmptyString);
+    pConf->Read("NMEAFailover", &opt->nmeaFailover, 5);
+    pConf->Read("XDRChannels", &opt->xdrChannels, wxEmptyString);
     pConf->Read("AutoStartTimer", &opt->autostarttimer, false);
 
     pConf->Read(_T ( "DateFormat" ), &opt->dateformat, 0);
@@ -1266,76 +1445,34 @@ void logbookkonni_pi::LoadConfig() {
       if (dt.GetYear() != 1970) opt->dtGeneratorOn = dt;
     }
 
-    bool r;
-    r = pConf->Read(_T ( "NavGridColWidth" ), &str);
-    if (r)
-      opt->NavColWidth = readCols(opt->NavColWidth, str);
-    else
-      opt->NavColWidth =
-          readColsOld(pConf, opt->NavColWidth, _T ( "NavGridColWidth" ));
-
-    r = pConf->Read(_T ( "WeatherGridColWidth" ), &str);
-    if (r)
-      opt->WeatherColWidth = readCols(opt->WeatherColWidth, str);
-    else
-      opt->WeatherColWidth = readColsOld(pConf, opt->WeatherColWidth,
-                                         _T ( "WeatherGridColWidth" ));
-
-    r = pConf->Read(_T ( "MotorGridColWidth" ), &str);
-    if (r)
-      opt->MotorColWidth = readCols(opt->MotorColWidth, str);
-    else
-      opt->MotorColWidth =
-          readColsOld(pConf, opt->MotorColWidth, _T ( "MotorGridColWidth" ));
-
-    r = pConf->Read(_T ( "CrewGridColWidth" ), &str);
-    if (r)
-      opt->CrewColWidth = readCols(opt->CrewColWidth, str);
-    else
-      opt->CrewColWidth =
-          readColsOld(pConf, opt->CrewColWidth, _T ( "CrewGridColWidth" ));
-
-    r = pConf->Read(_T ( "WakeGridColWidth" ), &str);
-    if (r)
-      opt->WakeColWidth = readCols(opt->WakeColWidth, str);
-    else
-      opt->WakeColWidth =
-          readColsOld(pConf, opt->WakeColWidth, _T ( "WakeGridColWidth" ));
-
-    r = pConf->Read(_T ( "EquipGridColWidth" ), &str);
-    if (r)
-      opt->EquipColWidth = readCols(opt->EquipColWidth, str);
-    else
-      opt->EquipColWidth =
-          readColsOld(pConf, opt->EquipColWidth, _T ( "EquipGridColWidth" ));
-
-    r = pConf->Read(_T ( "OverviewGridColWidth" ), &str);
-    if (r)
-      opt->OverviewColWidth = readCols(opt->OverviewColWidth, str);
-    else
-      opt->OverviewColWidth = readColsOld(pConf, opt->OverviewColWidth,
-                                          _T ( "OverviewGridColWidth" ));
-
-    r = pConf->Read(_T ( "ServiceGridColWidth" ), &str);
-    if (r)
-      opt->ServiceColWidth = readCols(opt->ServiceColWidth, str);
-    else
-      opt->ServiceColWidth = readColsOld(pConf, opt->ServiceColWidth,
-                                         _T ( "ServiceGridColWidth" ));
-
-    r = pConf->Read(_T ( "RepairsGridColWidth" ), &str);
-    if (r)
-      opt->RepairsColWidth = readCols(opt->RepairsColWidth, str);
-    else
-      opt->RepairsColWidth = readColsOld(pConf, opt->RepairsColWidth,
-                                         _T ( "RepairsGridColWidth" ));
-
-    r = pConf->Read(_T ( "BuyPartsGridColWidth" ), &str);
-    if (r)
-      opt->BuyPartsColWidth = readCols(opt->BuyPartsColWidth, str);
-    else
-      opt->BuyPartsColWidth = readColsOld(pConf, opt->BuyPartsColWidth,
-                                          _T ( "BuyPartsGridColWidth" ));
+    // one entry since, before that one per grid, older still a group
+    if (pConf->Read(_T ( "GridColWidths" ), &str)) {
+      wxStringTokenizer grids(str, ";");
+      while (grids.HasMoreTokens()) {
+        wxString grid = grids.GetNextToken();
+        for (size_t g = 0; g < WXSIZEOF(colRecords); g++)
+          if (grid.BeforeFirst('=') == colRecords[g].name)
+            opt->*colRecords[g].cols =
+                readCols(opt->*colRecords[g].cols, grid.AfterFirst('='));
+      }
+    } else {
+      wxArrayString old;
+      for (size_t g = 0; g < WXSIZEOF(colRecords); g++) {
+        wxString entry = wxString(colRecords[g].name) + "GridColWidth";
+        ArrayOfGridColWidth& ar = opt->*colRecords[g].cols;
+        if (pConf->Read(entry, &str))
+          ar = readCols(ar, str);
+        else
+          ar = readColsOld(pConf, ar, entry);
+        old.Add(entry);
+      }
+      // the old entries go only once the new one is on disk
+      if (pConf->Write(_T ( "GridColWidths" ), writeCols()) && pConf->Flush())
+        for (size_t i = 0; i < old.Count(); i++) {
+          if (pConf->HasEntry(old[i])) pConf->DeleteEntry(old[i]);
+          if (pConf->HasGroup(old[i])) pConf->DeleteGroup(old[i]);
+        }
+    }
 
     pConf->DeleteEntry(_T ( "ShowAllLayout" ));
     pConf->DeleteEntry(_T ( "ShowFilteredLayout" ));
@@ -1373,7 +1510,6 @@ ArrayOfGridColWidth logbookkonni_pi::readColsOld(wxFileConfig* pConf,
     if (!r) break;
     ar.Add(val);
   }
-  pConf->DeleteGroup(wxString("/PlugIns/Logbook/") + entry);
 
   return ar;
 }
@@ -1510,8 +1646,6 @@ void logbookkonni_pi::loadLayouts(wxWindow* parent) {
 }
 
 ////////////////////////////////////////////////////////
-void LogbookTimer::OnTimer(wxTimerEvent& ev) { timerEvent(); }
-
 void LogbookTimer::timerEvent() {
   if (popUp()) plogbook_pi->m_plogbook_window->logbook->appendRow(true, true);
 }
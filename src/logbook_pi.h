@@ -55,6 +55,9 @@ class Logbook;
 class LogbookDialog;
 class LogbookTimer;
 class LogbookOptions;
+class MessageRouter;
+class RequestRunner;
+class ConfigStore;
 class Options;
 
 class logbookkonni_pi  :  public opencpn_plugin_116
@@ -72,7 +75,9 @@ public:
     LogbookOptions    *optionsDialog;
     wxFileConfig		*m_pconfig;
     Options			*opt;
-    wxTimer 		    *m_timer;
+    MessageRouter		*router;
+    RequestRunner		*requests;
+    ConfigStore		*config;
     wxColour			col,col1,gridline,uitext,udkrd,back_color,text_color;
     wxColour			mcol,mcol1,mgridline, muitext,mudkrd,mback_color,mtext_color;
     wxString			lastWaypointInRoute;
@@ -124,11 +129,36 @@ public:
     void shutdown( bool menu );
 
 private:
+    void					registerMessages();
+    void					onManOverboard( wxJSONValue& data, wxString& body );
+    void					onPolarSave( wxJSONValue& data, wxString& body );
+    void					onLastLineRequest( wxJSONValue& data, wxString& body );
+    void					onRangeRequest( wxJSONValue& data, wxString& body );
+    void					onQueryRequest( wxJSONValue& data, wxString& body );
+    void					onInstrumentsRangeRequest( wxJSONValue& data, wxString& body );
+    void					onFleetRequest( wxJSONValue& data, wxString& body );
+    void					onIsReadyRequest( wxJSONValue& data, wxString& body );
+    void					onBuyPartsAddLine( wxJSONValue& data, wxString& body );
+    void					onLogAddLine( wxJSONValue& data, wxString& body );
+    void					onWaypointArrived( wxJSONValue& data, wxString& body );
+    void					onRouteEnded( wxJSONValue& data, wxString& body );
+    void					onRouteDeactivated( wxJSONValue& data, wxString& body );
+    void					onRouteActivated( wxJSONValue& data, wxString& body );
+    void					onTrackActivated( wxJSONValue& data, wxString& body );
+    void					onTrackDeactivated( wxJSONValue& data, wxString& body );
+    void					onTrackPoint( wxJSONValue& data, wxString& body );
+    void					onTracksMerged( wxJSONValue& data, wxString& body );
+    void					onRouteResponse( wxJSONValue& data, wxString& body );
+    void					onRouteListResponse( wxJSONValue& data, wxString& body );
+#ifdef PLUGIN_BENCHMARK
+    void					onBenchmarkRequest( wxJSONValue& data, wxString& body );
+#endif
+
     void					OnTimer( wxTimerEvent& ev );
     void					SaveConfig();
     void					LoadConfig();
     ArrayOfGridColWidth	readCols( ArrayOfGridColWidth ar, wxString str );
-    void					writeCols( wxFileConfig *pConf, ArrayOfGridColWidth ar, wxString entry );
+    wxString				writeCols();
     ArrayOfGridColWidth	readColsOld( wxFileConfig *pConf, ArrayOfGridColWidth ar, wxString entry );
     void					dialogDimmer( PI_ColorScheme cs,wxWindow* ctrl,wxColour col,wxColour col1, wxColour back_color,wxColour text_color, wxColour uitext, wxColour udkrd );
     wxAuiManager     *m_pauimgr;
@@ -151,7 +181,6 @@ public:
         plogbook_pi = l;
     }
 
-    void		OnTimer( wxTimerEvent& ev );
     bool		popUp();
     void		timerEvent();
 